@@ -0,0 +1,452 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <regex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <vectra/vectra.hpp>
+#include <vectra/version.hpp>
+
+#include "../bench_common.hpp"
+#include "ulp.hpp"
+
+
+/*
+ * Accuracy versus throughput of every ComputeBackend function, at each
+ * accuracy tier, SIMD level enabled at compile time and precision.
+ *
+ * Each row sweeps the domain of the function evenly (dense), then at
+ * random, and reports the maximum and mean error in ULP against a long
+ * double reference, with the argument of the maximum. Special values
+ * (zeros, +-1, the domain bounds, denormals, extremes, infinities and
+ * NaN) are reported apart, as their maximum error only: a NaN or an
+ * infinity where the reference has none is an infinite error.
+ *
+ * Throughput is measured by transform() over the same arguments
+ * (512 KB in float, 1 MB in double, hence within L2 or L3), in elements
+ * per second and reference (time stamp counter) cycles per element.
+ *
+ * Usage: vectra_accuracy [--json] [--filter=<regex>] [--min_time=<s>]
+ * The filter applies to "<level>/<type>/<function>/<tier>" names.
+ * Non finite values are written as null in JSON.
+ */
+
+namespace
+{
+
+using namespace vectra;
+using namespace vectra::bench;
+using vectra::test::ulpError;
+
+struct options
+{
+	bool        json     = false;
+	double      min_time = 0.02;
+	std::regex  filter   { ".*" };
+};
+
+struct row
+{
+	std::string level;
+	std::string type;
+	std::string function;
+	std::string tier;
+	double      max_ulp            = 0;
+	double      mean_ulp           = 0;
+	long double worst_x            = 0;
+	long double worst_y            = 0;
+	double      special_max_ulp    = 0;
+	double      items_per_second   = 0;
+	double      cycles_per_element = 0;
+};
+
+enum class scale { linear, logarithmic };
+
+// [lo ; hi], sampled evenly or with evenly spread exponents (lo > 0)
+struct domain
+{
+	long double lo;
+	long double hi;
+	scale       spacing = scale::linear;
+};
+
+constexpr std::size_t dense_count  = std::size_t(1) << 16;
+constexpr std::size_t random_count = std::size_t(1) << 16;
+constexpr std::size_t grid_side    = 256; // dense_count for binary functions
+
+template <typename T>
+T at(const domain& d, long double t)
+{
+	if (d.spacing == scale::logarithmic)
+		return static_cast<T>(d.lo * std::pow(d.hi / d.lo, t));
+	return static_cast<T>(d.lo + (d.hi - d.lo) * t);
+}
+
+template <typename T>
+std::vector<T> specials(const domain& d)
+{
+	using limits = std::numeric_limits<T>;
+	return { T(0), -T(0), T(1), T(-1), static_cast<T>(d.lo), static_cast<T>(d.hi),
+	         limits::denorm_min(), limits::min(), limits::max(), -limits::max(),
+	         limits::infinity(), -limits::infinity(), limits::quiet_NaN() };
+}
+
+// Arguments of a function of arity 1 or 2: the dense sweep (a grid for
+// binary functions), then random ones
+template <typename T, std::size_t arity>
+std::array<aligned_vector<T>, arity> sweep(const std::array<domain, arity>& domains)
+{
+	std::array<aligned_vector<T>, arity> x;
+	for (auto& v : x)
+		v.resize(dense_count + random_count);
+
+	for (std::size_t i = 0; i < dense_count; ++i)
+	{
+		if constexpr (arity == 1)
+			x[0][i] = at<T>(domains[0], static_cast<long double>(i) / (dense_count - 1));
+		else
+		{
+			x[0][i] = at<T>(domains[0], static_cast<long double>(i % grid_side) / (grid_side - 1));
+			x[1][i] = at<T>(domains[1], static_cast<long double>(i / grid_side) / (grid_side - 1));
+		}
+	}
+
+	std::mt19937_64 generator(42);
+	std::uniform_real_distribution<long double> distribution(0.L, 1.L);
+
+	for (std::size_t i = dense_count; i < dense_count + random_count; ++i)
+		for (std::size_t k = 0; k < arity; ++k)
+			x[k][i] = at<T>(domains[k], distribution(generator));
+
+	return x;
+}
+
+// Every special value, for each argument
+template <typename T, std::size_t arity>
+std::array<aligned_vector<T>, arity> specialArguments(const std::array<domain, arity>& domains)
+{
+	std::array<aligned_vector<T>, arity> x;
+
+	if constexpr (arity == 1)
+	{
+		const std::vector<T> s = specials<T>(domains[0]);
+		x[0].assign(s.begin(), s.end());
+	}
+	else
+	{
+		const std::vector<T> s0 = specials<T>(domains[0]);
+		const std::vector<T> s1 = specials<T>(domains[1]);
+		for (T a : s0)
+			for (T b : s1)
+			{
+				x[0].push_back(a);
+				x[1].push_back(b);
+			}
+	}
+
+	return x;
+}
+
+template <SIMDLevel level, typename T, std::size_t arity, typename Op>
+void apply(const std::array<aligned_vector<T>, arity>& in, aligned_vector<T>& out, Op op)
+{
+	using vct = Vectratype<T, level>;
+
+	out.resize(in[0].size());
+
+	if constexpr (arity == 1)
+		transform<level>(in[0].data(), out.data(), out.size(), [op](vct x) { return vct(op(x.value)); });
+	else
+		transform<level>(in[0].data(), in[1].data(), out.data(), out.size(), [op](vct x, vct y) { return vct(op(x.value, y.value)); });
+}
+
+template <typename T, std::size_t arity, typename Reference>
+double error(const std::array<aligned_vector<T>, arity>& in, const aligned_vector<T>& out, std::size_t i, Reference reference)
+{
+	if constexpr (arity == 1)
+		return ulpError(out[i], reference(static_cast<long double>(in[0][i])));
+	else
+		return ulpError(out[i], reference(static_cast<long double>(in[0][i]), static_cast<long double>(in[1][i])));
+}
+
+template <typename T, SIMDLevel level, std::size_t arity, typename Op, typename Reference>
+row measure(const std::array<domain, arity>& domains, Op op, Reference reference, const options& opt)
+{
+	row r;
+
+	const std::array<aligned_vector<T>, arity> in = sweep<T>(domains);
+	aligned_vector<T> out;
+
+	apply<level>(in, out, op);
+
+	double total = 0;
+	for (std::size_t i = 0; i < out.size(); ++i)
+	{
+		const double e = error<T>(in, out, i, reference);
+		total += e;
+
+		if (e > r.max_ulp)
+		{
+			r.max_ulp = e;
+			r.worst_x = in[0][i];
+			if constexpr (arity == 2)
+				r.worst_y = in[1][i];
+		}
+	}
+	r.mean_ulp = total / double(out.size());
+
+	const std::array<aligned_vector<T>, arity> special = specialArguments<T>(domains);
+	apply<level>(special, out, op);
+
+	for (std::size_t i = 0; i < out.size(); ++i)
+		r.special_max_ulp = std::max(r.special_max_ulp, error<T>(special, out, i, reference));
+
+	// Throughput, over the sweep arguments
+	apply<level>(in, out, op);
+
+	using clock = std::chrono::steady_clock;
+
+	std::size_t passes = 0;
+	const clock::time_point start = clock::now();
+	const std::uint64_t     ticks = cycles();
+	double elapsed = 0;
+
+	do
+	{
+		apply<level>(in, out, op);
+		benchmark::DoNotOptimize(out.data());
+		++passes;
+		elapsed = std::chrono::duration<double>(clock::now() - start).count();
+	}
+	while (elapsed < opt.min_time);
+
+	const double elements = double(passes) * double(out.size());
+	r.items_per_second   = elements / elapsed;
+	r.cycles_per_element = double(cycles() - ticks) / elements;
+
+	return r;
+}
+
+template <typename T, SIMDLevel level>
+class suite
+{
+public:
+	suite(std::vector<row>& rows, const options& opt) : rows_(rows), opt_(opt) {}
+
+	template <typename Op, typename Reference>
+	void unary(const char* function, const char* tier, domain d, Op op, Reference reference)
+	{
+		add<1>(function, tier, { d }, op, reference);
+	}
+
+	template <typename Op, typename Reference>
+	void binary(const char* function, const char* tier, domain dx, domain dy, Op op, Reference reference)
+	{
+		add<2>(function, tier, { dx, dy }, op, reference);
+	}
+
+private:
+	template <std::size_t arity, typename Op, typename Reference>
+	void add(const char* function, const char* tier, const std::array<domain, arity>& domains, Op op, Reference reference)
+	{
+		const std::string name = std::string(toString(level)) + "/" + typeName<T>() + "/" + function + "/" + tier;
+		if (!std::regex_search(name, opt_.filter))
+			return;
+
+		row r = measure<T, level>(domains, op, reference, opt_);
+		r.level    = toString(level);
+		r.type     = typeName<T>();
+		r.function = function;
+		r.tier     = tier;
+		rows_.push_back(r);
+	}
+
+	std::vector<row>& rows_;
+	const options&    opt_;
+};
+
+// Functions of the backends are the precise tier. The fast and balanced
+// ones are the kernels of the accuracy policies.
+template <typename T, SIMDLevel level>
+void measureBackend(std::vector<row>& rows, const options& opt)
+{
+	using b    = ComputeBackend<T, level>;
+	using type = typename b::type;
+	using ld   = long double;
+
+	constexpr bool single = std::is_same_v<T, float>;
+
+	const ld big = single ? 1e30L : 1e300L;
+
+	const domain trig     { -8192, 8192 };
+	const domain unit     { -1, 1 };
+	const domain wide     { -100, 100 };
+	const domain positive { 1 / big, big, scale::logarithmic };
+	const domain exponent { single ? -87 : -708, single ? 88 : 709 };
+	const domain binary   { single ? -126 : -1022, single ? 127 : 1023 };
+	const domain small    { -10, 10 };
+	const domain near_one { -0.5L, 1 };
+	const domain base     { 1e-3L, 1e3L, scale::logarithmic };
+
+	// The double estimates are seeded in float, hence this range for
+	// every tier of rcp and rsqrt
+	const domain inverse  { 1e-30L, 1e30L, scale::logarithmic };
+
+	suite<T, level> s(rows, opt);
+
+	s.unary("sin",   "precise",  trig,     [](type x) { return b::sin(x); },                                     [](ld x) { return std::sin(x); });
+	s.unary("sin",   "balanced", trig,     [](type x) { return accuracy::balanced::sin<T, b>(x); },              [](ld x) { return std::sin(x); });
+	s.unary("sin",   "fast",     trig,     [](type x) { return accuracy::fast::sin<T, b>(x); },                  [](ld x) { return std::sin(x); });
+	s.unary("cos",   "precise",  trig,     [](type x) { return b::cos(x); },                                     [](ld x) { return std::cos(x); });
+	s.unary("cos",   "balanced", trig,     [](type x) { return accuracy::balanced::cos<T, b>(x); },              [](ld x) { return std::cos(x); });
+	s.unary("cos",   "fast",     trig,     [](type x) { return accuracy::fast::cos<T, b>(x); },                  [](ld x) { return std::cos(x); });
+	s.unary("asin",  "precise",  unit,     [](type x) { return b::asin(x); },                                    [](ld x) { return std::asin(x); });
+	s.unary("acos",  "precise",  unit,     [](type x) { return b::acos(x); },                                    [](ld x) { return std::acos(x); });
+	s.unary("atan",  "precise",  wide,     [](type x) { return b::atan(x); },                                    [](ld x) { return std::atan(x); });
+	s.binary("atan2", "precise", wide, wide, [](type y, type x) { return b::atan2(y, x); },                      [](ld y, ld x) { return std::atan2(y, x); });
+	s.unary("exp",   "precise",  exponent, [](type x) { return b::exp(x); },                                     [](ld x) { return std::exp(x); });
+	s.unary("exp",   "balanced", exponent, [](type x) { return accuracy::balanced::exp<T, b>(x); },              [](ld x) { return std::exp(x); });
+	s.unary("exp",   "fast",     exponent, [](type x) { return accuracy::fast::exp<T, b>(x); },                  [](ld x) { return std::exp(x); });
+	s.unary("exp2",  "precise",  binary,   [](type x) { return b::exp2(x); },                                    [](ld x) { return std::exp2(x); });
+	s.unary("exp2",  "balanced", binary,   [](type x) { return accuracy::balanced::exp2<T, b>(x); },             [](ld x) { return std::exp2(x); });
+	s.unary("exp2",  "fast",     binary,   [](type x) { return accuracy::fast::exp2<T, b>(x); },                 [](ld x) { return std::exp2(x); });
+	s.unary("expm1", "precise",  small,    [](type x) { return b::expm1(x); },                                   [](ld x) { return std::expm1(x); });
+	s.unary("log",   "precise",  positive, [](type x) { return b::log(x); },                                     [](ld x) { return std::log(x); });
+	s.unary("log",   "balanced", positive, [](type x) { return accuracy::balanced::log<T, b>(x); },              [](ld x) { return std::log(x); });
+	s.unary("log",   "fast",     positive, [](type x) { return accuracy::fast::log<T, b>(x); },                  [](ld x) { return std::log(x); });
+	s.unary("log2",  "precise",  positive, [](type x) { return b::log2(x); },                                    [](ld x) { return std::log2(x); });
+	s.unary("log2",  "balanced", positive, [](type x) { return accuracy::balanced::log2<T, b>(x); },             [](ld x) { return std::log2(x); });
+	s.unary("log2",  "fast",     positive, [](type x) { return accuracy::fast::log2<T, b>(x); },                 [](ld x) { return std::log2(x); });
+	s.unary("log1p", "precise",  near_one, [](type x) { return b::log1p(x); },                                   [](ld x) { return std::log1p(x); });
+	s.binary("pow",  "precise",  base, small, [](type x, type y) { return b::pow(x, y); },                       [](ld x, ld y) { return std::pow(x, y); });
+	s.unary("cbrt",  "precise",  positive, [](type x) { return b::cbrt(x); },                                    [](ld x) { return std::cbrt(x); });
+	s.unary("sqrt",  "precise",  positive, [](type x) { return b::sqrt(x); },                                    [](ld x) { return std::sqrt(x); });
+	s.unary("rcp",   "precise",  inverse,  [](type x) { return accuracy::precise::rcp<T, b>(x); },               [](ld x) { return 1 / x; });
+	s.unary("rcp",   "balanced", inverse,  [](type x) { return accuracy::balanced::rcp<T, b>(x); },              [](ld x) { return 1 / x; });
+	s.unary("rcp",   "fast",     inverse,  [](type x) { return accuracy::fast::rcp<T, b>(x); },                  [](ld x) { return 1 / x; });
+	s.unary("rsqrt", "precise",  inverse,  [](type x) { return accuracy::precise::rsqrt<T, b>(x); },             [](ld x) { return 1 / std::sqrt(x); });
+	s.unary("rsqrt", "balanced", inverse,  [](type x) { return accuracy::balanced::rsqrt<T, b>(x); },            [](ld x) { return 1 / std::sqrt(x); });
+	s.unary("rsqrt", "fast",     inverse,  [](type x) { return accuracy::fast::rsqrt<T, b>(x); },                [](ld x) { return 1 / std::sqrt(x); });
+}
+
+template <SIMDLevel level>
+void measureLevel(std::vector<row>& rows, const options& opt)
+{
+	measureBackend<float,  level>(rows, opt);
+	measureBackend<double, level>(rows, opt);
+}
+
+// JSON has no infinity nor NaN
+void printNumber(long double x)
+{
+	if (std::isfinite(x))
+		std::printf("%.9Lg", x);
+	else
+		std::printf("null");
+}
+
+void printJson(const std::vector<row>& rows)
+{
+	std::printf("{\n  \"context\": {\n");
+	std::printf("    \"vectra_version\": \"%s\",\n", VECTRA_VERSION_FULL);
+	std::printf("    \"compiled_level\": \"%s\",\n", toString(compiletimeSIMDLevel()));
+	std::printf("    \"runtime_level\": \"%s\",\n", toString(highestRuntimeSIMDLevel()));
+	std::printf("    \"reference_digits\": %d,\n", std::numeric_limits<long double>::digits);
+	std::printf("    \"cycles_per_element\": \"time stamp counter (reference) cycles\"\n  },\n");
+	std::printf("  \"results\": [\n");
+
+	for (std::size_t i = 0; i < rows.size(); ++i)
+	{
+		const row& r = rows[i];
+
+		std::printf("    { \"level\": \"%s\", \"type\": \"%s\", \"function\": \"%s\", \"tier\": \"%s\", ", r.level.c_str(), r.type.c_str(), r.function.c_str(), r.tier.c_str());
+		std::printf("\"max_ulp\": ");            printNumber(r.max_ulp);
+		std::printf(", \"mean_ulp\": ");         printNumber(r.mean_ulp);
+		std::printf(", \"worst_x\": ");          printNumber(r.worst_x);
+		std::printf(", \"worst_y\": ");          printNumber(r.worst_y);
+		std::printf(", \"special_max_ulp\": ");  printNumber(r.special_max_ulp);
+		std::printf(", \"items_per_second\": "); printNumber(r.items_per_second);
+		std::printf(", \"cycles_per_element\": "); printNumber(r.cycles_per_element);
+		std::printf(" }%s\n", i + 1 < rows.size() ? "," : "");
+	}
+
+	std::printf("  ]\n}\n");
+}
+
+void printTable(const std::vector<row>& rows)
+{
+	std::printf("%-7s %-7s %-6s %-9s %12s %12s %14s %12s %12s %10s\n",
+	            "level", "type", "func", "tier", "max_ulp", "mean_ulp", "worst_x", "special_ulp", "Melem/s", "cyc/elem");
+
+	for (const row& r : rows)
+	{
+		std::printf("%-7s %-7s %-6s %-9s %12.4g %12.4g %14.7Lg %12.4g %12.1f %10.2f\n",
+		            r.level.c_str(), r.type.c_str(), r.function.c_str(), r.tier.c_str(),
+		            r.max_ulp, r.mean_ulp, r.worst_x, r.special_max_ulp,
+		            r.items_per_second * 1e-6, r.cycles_per_element);
+	}
+}
+
+bool parse(int argc, char** argv, options& opt)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* arg = argv[i];
+
+		if (std::strcmp(arg, "--json") == 0)
+			opt.json = true;
+		else if (std::strncmp(arg, "--filter=", 9) == 0)
+			opt.filter = std::regex(arg + 9);
+		else if (std::strncmp(arg, "--min_time=", 11) == 0)
+			opt.min_time = std::atof(arg + 11);
+		else
+		{
+			std::fprintf(stderr, "unrecognized argument: %s\nusage: %s [--json] [--filter=<regex>] [--min_time=<seconds>]\n", arg, argv[0]);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	options opt;
+	if (!parse(argc, argv, opt))
+		return 1;
+
+	std::vector<row> rows;
+
+	measureLevel<SIMDLevel::None>(rows, opt);
+#if defined(__SSE4_1__)
+	measureLevel<SIMDLevel::SSE41>(rows, opt);
+#endif
+#if defined(__AVX__)
+	measureLevel<SIMDLevel::AVX>(rows, opt);
+#endif
+#if defined(__AVX2__) && defined(__FMA__)
+	measureLevel<SIMDLevel::AVX2>(rows, opt);
+#endif
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+	measureLevel<SIMDLevel::AVX512>(rows, opt);
+#endif
+
+	if (opt.json)
+		printJson(rows);
+	else
+		printTable(rows);
+
+	return 0;
+}
@@ -0,0 +1,122 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <vectra/vectra.hpp>
+
+#include "bench_common.hpp"
+
+
+namespace
+{
+
+using namespace vectra;
+using namespace vectra::bench;
+
+// Reductions over one (or two) arrays filling the working set
+template <typename T, SIMDLevel level, int inputs, typename Reduce>
+void reduction(benchmark::State& state, Reduce reduce)
+{
+	const std::size_t n = std::size_t(state.range(0)) / sizeof(T) / inputs;
+
+	const aligned_vector<T> a = arguments<T>(n);
+	const aligned_vector<T> b = arguments<T>(inputs > 1 ? n : 0);
+
+	const std::uint64_t start = cycles();
+	for (auto _ : state)
+		benchmark::DoNotOptimize(reduce(a.data(), b.data(), n));
+	report(state, cycles() - start, double(state.iterations()) * double(n));
+}
+
+template <typename T, SIMDLevel level, int inputs, typename Reduce>
+void add(const char* op, Reduce f)
+{
+	benchmark::RegisterBenchmark(name<T, level>("reduce", op).c_str(), [f](benchmark::State& s) { reduction<T, level, inputs>(s, f); })
+		->ArgName("bytes")
+		->Args({ working_sets[0] })
+		->Args({ working_sets[1] })
+		->Args({ working_sets[2] })
+		->Args({ working_sets[3] });
+}
+
+template <typename T, SIMDLevel level>
+void addReductions()
+{
+	add<T, level, 1>("sum",             [](const T* a, const T*, std::size_t n) { return sum<level>(a, n); });
+	add<T, level, 1>("sum_compensated", [](const T* a, const T*, std::size_t n) { return sum<level>(a, n, accumulation::compensated); });
+	add<T, level, 2>("dot",             [](const T* a, const T* b, std::size_t n) { return dot<level>(a, b, n); });
+	add<T, level, 2>("dot_compensated", [](const T* a, const T* b, std::size_t n) { return dot<level>(a, b, n, accumulation::compensated); });
+	add<T, level, 1>("min",             [](const T* a, const T*, std::size_t n) { return min<level>(a, n); });
+	add<T, level, 1>("argmin",          [](const T* a, const T*, std::size_t n) { return argmin<level>(a, n); });
+}
+
+// Table lookups out[i] = table[idx[i]], at random indices into a
+// table filling the working set
+template <typename T, SIMDLevel level>
+void lookup(benchmark::State& state)
+{
+	using index = detail::index_t<T>;
+
+	const std::size_t size = std::size_t(state.range(0)) / sizeof(T);
+	const std::size_t n    = std::size_t(1) << 16;
+
+	const aligned_vector<T> table = arguments<T>(size);
+	aligned_vector<index> idx(n);
+	aligned_vector<T>     out(n);
+
+	std::mt19937_64 generator(42);
+	std::uniform_int_distribution<std::size_t> uniform(0, size - 1);
+	for (index& i : idx)
+		i = static_cast<index>(uniform(generator));
+
+	const std::uint64_t start = cycles();
+	for (auto _ : state)
+	{
+		gather<level>(table.data(), idx.data(), out.data(), n);
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	report(state, cycles() - start, double(state.iterations()) * double(n));
+}
+
+template <typename T, SIMDLevel level>
+void addLookups()
+{
+	benchmark::RegisterBenchmark(name<T, level>("lookup", "gather").c_str(), lookup<T, level>)
+		->ArgName("bytes")
+		->Args({ working_sets[0] })
+		->Args({ working_sets[1] })
+		->Args({ working_sets[2] })
+		->Args({ working_sets[3] });
+}
+
+template <SIMDLevel level>
+void addLevel()
+{
+	addReductions<float,  level>();
+	addReductions<double, level>();
+	addLookups<float,  level>();
+	addLookups<double, level>();
+}
+
+const bool registered = []
+{
+	addLevel<SIMDLevel::None>();
+#if defined(__SSE4_1__)
+	addLevel<SIMDLevel::SSE41>();
+#endif
+#if defined(__AVX__)
+	addLevel<SIMDLevel::AVX>();
+#endif
+#if defined(__AVX2__) && defined(__FMA__)
+	addLevel<SIMDLevel::AVX2>();
+#endif
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+	addLevel<SIMDLevel::AVX512>();
+#endif
+	return true;
+}();
+
+}
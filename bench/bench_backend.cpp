@@ -0,0 +1,156 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <vectra/vectra.hpp>
+
+#include "bench_common.hpp"
+
+
+namespace
+{
+
+using namespace vectra;
+using namespace vectra::bench;
+
+/*
+ * Throughput: op over a whole array, through transform(), the input
+ * and output arrays sharing the working set. Small working sets show
+ * the cost of the operation, large ones the memory bandwidth.
+ */
+template <typename T, SIMDLevel level, typename Op>
+void throughput(benchmark::State& state, Op op)
+{
+	using vct = Vectratype<T, level>;
+
+	const std::size_t n = std::size_t(state.range(0)) / sizeof(T) / 2;
+
+	const aligned_vector<T> in = arguments<T>(n);
+	aligned_vector<T> out(n);
+
+	auto kernel = [op](vct x) { return vct(op(x.value)); };
+
+	const std::uint64_t start = cycles();
+	for (auto _ : state)
+	{
+		transform<level>(in.data(), out.data(), n, kernel);
+		benchmark::ClobberMemory();
+	}
+	report(state, cycles() - start, double(state.iterations()) * double(n));
+}
+
+/*
+ * Latency: a chain of dependent operations on one register. Each step
+ * is x = fma(op(x), eps, x0), which keeps x close to x0, inside the
+ * domain of op: "copy" gives the latency of the fma alone, to be
+ * subtracted from the others. cycles_per_element is per operation,
+ * items_per_second counts every lane.
+ */
+template <typename T, SIMDLevel level, typename Op>
+void latency(benchmark::State& state, Op op)
+{
+	using backend = ComputeBackend<T, level>;
+
+	constexpr int chain = 256;
+
+	const typename backend::type x0  = backend::set(T(0.5));
+	const typename backend::type eps = backend::set(T(1e-3));
+
+	typename backend::type x = x0;
+
+	const std::uint64_t start = cycles();
+	for (auto _ : state)
+	{
+		for (int k = 0; k < chain; ++k)
+			x = backend::fma(op(x), eps, x0);
+		benchmark::DoNotOptimize(x);
+	}
+
+	const double steps = double(state.iterations()) * chain;
+	state.SetItemsProcessed(static_cast<std::int64_t>(steps * backend::width()));
+	state.counters["cycles_per_element"] = double(cycles() - start) / steps;
+}
+
+template <typename T, SIMDLevel level, typename Op>
+void add(const char* op, Op f)
+{
+	benchmark::RegisterBenchmark(name<T, level>("throughput", op).c_str(), [f](benchmark::State& s) { throughput<T, level>(s, f); })
+		->ArgName("bytes")
+		->Args({ working_sets[0] })
+		->Args({ working_sets[1] })
+		->Args({ working_sets[2] })
+		->Args({ working_sets[3] });
+
+	benchmark::RegisterBenchmark(name<T, level>("latency", op).c_str(), [f](benchmark::State& s) { latency<T, level>(s, f); });
+}
+
+// Every arithmetic and math operation of the backend. The second
+// operand of binary ones is a constant register.
+template <typename T, SIMDLevel level>
+void addBackend()
+{
+	using b    = ComputeBackend<T, level>;
+	using type = typename b::type;
+
+	const type c = b::set(T(0.75));
+
+	add<T, level>("copy",          [](type x)  { return x; });
+	add<T, level>("add",           [c](type x) { return b::add(x, c); });
+	add<T, level>("sub",           [c](type x) { return b::sub(x, c); });
+	add<T, level>("mul",           [c](type x) { return b::mul(x, c); });
+	add<T, level>("div",           [c](type x) { return b::div(x, c); });
+	add<T, level>("fma",           [c](type x) { return b::fma(x, c, c); });
+	add<T, level>("min",           [c](type x) { return b::min(x, c); });
+	add<T, level>("max",           [c](type x) { return b::max(x, c); });
+	add<T, level>("abs",           [](type x)  { return b::abs(x); });
+	add<T, level>("floor",         [](type x)  { return b::floor(x); });
+	add<T, level>("round",         [](type x)  { return b::round(x); });
+	add<T, level>("sqrt",          [](type x)  { return b::sqrt(x); });
+	add<T, level>("rcp",           [](type x)  { return b::rcp(x); });
+	add<T, level>("rcp_refined",   [](type x)  { return b::rcp_refined(x); });
+	add<T, level>("rsqrt",         [](type x)  { return b::rsqrt(x); });
+	add<T, level>("rsqrt_refined", [](type x)  { return b::rsqrt_refined(x); });
+	add<T, level>("cbrt",          [](type x)  { return b::cbrt(x); });
+	add<T, level>("sin",           [](type x)  { return b::sin(x); });
+	add<T, level>("cos",           [](type x)  { return b::cos(x); });
+	add<T, level>("asin",          [](type x)  { return b::asin(x); });
+	add<T, level>("acos",          [](type x)  { return b::acos(x); });
+	add<T, level>("atan",          [](type x)  { return b::atan(x); });
+	add<T, level>("atan2",         [c](type x) { return b::atan2(x, c); });
+	add<T, level>("exp",           [](type x)  { return b::exp(x); });
+	add<T, level>("exp2",          [](type x)  { return b::exp2(x); });
+	add<T, level>("expm1",         [](type x)  { return b::expm1(x); });
+	add<T, level>("log",           [](type x)  { return b::log(x); });
+	add<T, level>("log2",          [](type x)  { return b::log2(x); });
+	add<T, level>("log1p",         [](type x)  { return b::log1p(x); });
+	add<T, level>("pow",           [c](type x) { return b::pow(x, c); });
+}
+
+template <SIMDLevel level>
+void addLevel()
+{
+	addBackend<float,  level>();
+	addBackend<double, level>();
+}
+
+// The scalar backend is the baseline of every other one
+const bool registered = []
+{
+	addLevel<SIMDLevel::None>();
+#if defined(__SSE4_1__)
+	addLevel<SIMDLevel::SSE41>();
+#endif
+#if defined(__AVX__)
+	addLevel<SIMDLevel::AVX>();
+#endif
+#if defined(__AVX2__) && defined(__FMA__)
+	addLevel<SIMDLevel::AVX2>();
+#endif
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+	addLevel<SIMDLevel::AVX512>();
+#endif
+	return true;
+}();
+
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include <vectra/vectra.hpp>
+
+
+namespace vectra::bench
+{
+
+template <typename T>
+using aligned_vector = std::vector<T, aligned_allocator<T>>;
+
+// Working sets, in bytes: within L1, L2 and L3 on most x86 cores,
+// then well beyond the last level cache (DRAM)
+inline const std::vector<std::int64_t> working_sets = { 16 << 10, 256 << 10, 4 << 20, 128 << 20 };
+
+// Time stamp counter: reference cycles, at the nominal frequency
+// whatever the turbo state. Zero on other architectures.
+inline std::uint64_t cycles() noexcept
+{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+template <typename T>
+constexpr const char* typeName() noexcept { return sizeof(T) == 4 ? "float" : "double"; }
+
+// e.g. "throughput/AVX2/float/sin", the working set being appended
+// by Google Benchmark
+template <typename T, SIMDLevel level>
+std::string name(const char* kind, const char* op)
+{
+	return std::string(kind) + "/" + toString(level) + "/" + typeName<T>() + "/" + op;
+}
+
+// items_per_second is the number of elements per second, and
+// cycles_per_element the reference cycles per element
+inline void report(benchmark::State& state, std::uint64_t elapsed, double elements)
+{
+	state.SetItemsProcessed(static_cast<std::int64_t>(elements));
+	state.counters["cycles_per_element"] = elements > 0 ? double(elapsed) / elements : 0.;
+}
+
+// Arguments in [0.1 ; 0.9], inside the domain of every operation
+template <typename T>
+aligned_vector<T> arguments(std::size_t n)
+{
+	aligned_vector<T> x(n);
+	for (std::size_t i = 0; i < n; ++i)
+		x[i] = T(0.1) + T(0.8) * T(i % 1024) / T(1024);
+	return x;
+}
+
+}
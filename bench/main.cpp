@@ -0,0 +1,31 @@
+#include <benchmark/benchmark.h>
+
+#include <vectra/vectra.hpp>
+#include <vectra/version.hpp>
+
+
+/*
+ * Benchmarks are registered by the other translation units, for every
+ * backend enabled at compile time and both precisions:
+ *  - throughput/<level>/<type>/<op>/bytes:<working set>
+ *  - latency/<level>/<type>/<op>
+ *  - reduce/<level>/<type>/<op>/bytes:<working set>
+ *
+ * Use --benchmark_format=json (or --benchmark_out=<file> with
+ * --benchmark_out_format=json) for machine-readable results.
+ */
+int main(int argc, char** argv)
+{
+	benchmark::AddCustomContext("vectra_version",   VECTRA_VERSION_FULL);
+	benchmark::AddCustomContext("compiled_level",   vectra::toString(vectra::compiletimeSIMDLevel()));
+	benchmark::AddCustomContext("runtime_level",    vectra::toString(vectra::highestRuntimeSIMDLevel()));
+	benchmark::AddCustomContext("cycles_per_element", "time stamp counter (reference) cycles");
+
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
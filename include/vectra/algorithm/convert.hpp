@@ -0,0 +1,101 @@
+#pragma once
+
+
+#include <cstddef>
+
+#include <vectra/backend/compute_backend.hpp>
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/half.hpp>
+#include <vectra/core/simd_level.hpp>
+#include <vectra/parallel/parallel_for.hpp>
+
+
+namespace vectra
+{
+
+namespace detail
+{
+
+// Converts [0 ; n[ register by register, with the loadu / unloadu
+// overloads of the float backend for the 16-bit side. Two registers
+// per iteration, so that loads and conversions overlap.
+template <SIMDLevel level, typename From, typename To>
+void convertRange(const From* FORCE_RESTRICT in, To* FORCE_RESTRICT out, std::size_t n) noexcept
+{
+	using backend = ComputeBackend<float, level>;
+
+	constexpr std::size_t w = backend::width();
+
+	std::size_t i = 0;
+	for (; i + 2 * w <= n; i += 2 * w)
+	{
+		const typename backend::type a = backend::loadu(in + i);
+		const typename backend::type b = backend::loadu(in + i + w);
+		backend::unloadu(out + i,     a);
+		backend::unloadu(out + i + w, b);
+	}
+
+	for (; i + w <= n; i += w)
+		backend::unloadu(out + i, backend::loadu(in + i));
+
+	if (i < n)
+		backend::unloadu_partial(out + i, backend::loadu_partial(in + i, n - i), n - i);
+}
+
+template <SIMDLevel level, typename From, typename To>
+void convertPolicy(execution policy, const From* in, To* out, std::size_t n)
+{
+	if (policy == execution::sequential)
+	{
+		convertRange<level>(in, out, n);
+		return;
+	}
+
+	parallel_for<level>(out, n, [in, out](std::size_t begin, std::size_t end)
+	{
+		convertRange<level>(in + begin, out + begin, end - begin);
+	});
+}
+
+}
+
+/*
+ * @brief Converts n values between float and 16-bit storage.
+ *
+ * Widening (half or bfloat16 to float) is exact, narrowing rounds to
+ * nearest even, infinities and NaN are kept (NaN are quieted), and
+ * floats beyond the half range become infinite. Results are the same
+ * at every SIMD level, and the same as the scalar conversions of
+ * half and bfloat16. The arrays must not overlap.
+ *
+ * Reading 16-bit data halves the memory traffic of bandwidth-bound
+ * passes: kernels can also widen it on the fly, with the Vectratype
+ * constructors from const half* and const bfloat16*.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel()>
+void convert(const half* in, float* out, std::size_t n) noexcept { detail::convertRange<level>(in, out, n); }
+
+template <SIMDLevel level = compiletimeSIMDLevel()>
+void convert(const float* in, half* out, std::size_t n) noexcept { detail::convertRange<level>(in, out, n); }
+
+template <SIMDLevel level = compiletimeSIMDLevel()>
+void convert(const bfloat16* in, float* out, std::size_t n) noexcept { detail::convertRange<level>(in, out, n); }
+
+template <SIMDLevel level = compiletimeSIMDLevel()>
+void convert(const float* in, bfloat16* out, std::size_t n) noexcept { detail::convertRange<level>(in, out, n); }
+
+// Same, split across the threads of the global pool with
+// execution::parallel, in chunks aligned on the output cache lines
+template <SIMDLevel level = compiletimeSIMDLevel()>
+void convert(execution policy, const half* in, float* out, std::size_t n) { detail::convertPolicy<level>(policy, in, out, n); }
+
+template <SIMDLevel level = compiletimeSIMDLevel()>
+void convert(execution policy, const float* in, half* out, std::size_t n) { detail::convertPolicy<level>(policy, in, out, n); }
+
+template <SIMDLevel level = compiletimeSIMDLevel()>
+void convert(execution policy, const bfloat16* in, float* out, std::size_t n) { detail::convertPolicy<level>(policy, in, out, n); }
+
+template <SIMDLevel level = compiletimeSIMDLevel()>
+void convert(execution policy, const float* in, bfloat16* out, std::size_t n) { detail::convertPolicy<level>(policy, in, out, n); }
+
+}
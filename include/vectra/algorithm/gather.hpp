@@ -0,0 +1,108 @@
+#pragma once
+
+
+#include <cstddef>
+
+#include <vectra/backend/compute_backend.hpp>
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/simd_level.hpp>
+#include <vectra/detail/gather.hpp>
+#include <vectra/parallel/parallel_for.hpp>
+
+
+namespace vectra
+{
+
+namespace detail
+{
+
+// The tail is one partial register, gathered under the mask of its
+// n - i lanes: the missing indices, loaded as zeros, are never
+// dereferenced, table[0] not being in range when indices are negative.
+template <SIMDLevel level, typename T>
+void gatherRange(const T* table, const index_t<T>* idx, T* out, std::size_t n) noexcept
+{
+	using backend = ComputeBackend<T, level>;
+	using indices = ComputeBackend<index_t<T>, level>;
+
+	constexpr std::size_t w = backend::width();
+
+	std::size_t i = 0;
+	for (; i + 2 * w <= n; i += 2 * w)
+	{
+		const typename backend::type a = backend::gather(table, indices::loadu(idx + i));
+		const typename backend::type b = backend::gather(table, indices::loadu(idx + i + w));
+		backend::unloadu(out + i,     a);
+		backend::unloadu(out + i + w, b);
+	}
+
+	for (; i + w <= n; i += w)
+		backend::unloadu(out + i, backend::gather(table, indices::loadu(idx + i)));
+
+	if (i < n)
+	{
+		T ones[w];
+		for (std::size_t k = 0; k < w; ++k)
+			ones[k] = T(1);
+
+		const typename backend::mask tail = backend::cmpneq(backend::loadu_partial(ones, n - i), backend::zero());
+		backend::unloadu_partial(out + i, backend::mask_gather(backend::zero(), tail, table, indices::loadu_partial(idx + i, n - i)), n - i);
+	}
+}
+
+}
+
+/*
+ * @brief Indexed copies, for lookup tables and permutations:
+ * gather() computes out[i] = table[idx[i]] and scatter() does
+ * table[idx[i]] = in[i], for i in [0 ; n[.
+ *
+ * Indices are signed and have the width of T: int32_t for float and
+ * int32_t, int64_t for double and int64_t. They must be in range.
+ * When they repeat in a scatter, the last one in array order wins.
+ * Gathers run on the gather instructions of AVX2 and AVX-512, and
+ * scatters on those of AVX-512; other levels move lanes one by one.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void gather(const T* table, const detail::index_t<T>* idx, T* out, std::size_t n) noexcept
+{
+	detail::gatherRange<level>(table, idx, out, n);
+}
+
+// Same, split across the threads of the global pool with
+// execution::parallel. table must not overlap out.
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void gather(execution policy, const T* table, const detail::index_t<T>* idx, T* out, std::size_t n)
+{
+	if (policy == execution::sequential)
+	{
+		detail::gatherRange<level>(table, idx, out, n);
+		return;
+	}
+
+	parallel_for<level>(out, n, [table, idx, out](std::size_t begin, std::size_t end)
+	{
+		detail::gatherRange<level>(table, idx + begin, out + begin, end - begin);
+	});
+}
+
+// Sequential only: the order of the writes decides repeated indices.
+// The tail is scattered lane by lane, a partial register having no
+// safe index for its missing lanes.
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void scatter(const T* in, const detail::index_t<T>* idx, T* table, std::size_t n) noexcept
+{
+	using backend = ComputeBackend<T, level>;
+	using indices = ComputeBackend<detail::index_t<T>, level>;
+
+	constexpr std::size_t w = backend::width();
+
+	std::size_t i = 0;
+	for (; i + w <= n; i += w)
+		backend::scatter(table, indices::loadu(idx + i), backend::loadu(in + i));
+
+	for (; i < n; ++i)
+		table[idx[i]] = in[i];
+}
+
+}
@@ -0,0 +1,229 @@
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <vectra/algorithm/transform.hpp>
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/simd_level.hpp>
+#include <vectra/math/geodesic.hpp>
+#include <vectra/types/vectratype.hpp>
+
+
+namespace vectra
+{
+
+// Mean radius of the Earth (IUGG), in meters
+inline constexpr double earth_radius = 6371008.8;
+
+/*
+ * @brief Formula of the great-circle distance kernels.
+ *
+ *  - haversine        : accurate at every scale, the default.
+ *  - spherical_cosines: a bit cheaper, but loses precision for short
+ *                       distances (below a few km in float).
+ *  - equirectangular  : planar approximation, several times cheaper.
+ *                       Good for short distances, e.g. to filter
+ *                       candidates before an exact check.
+ */
+enum class great_circle : std::uint8_t
+{
+	haversine,
+	spherical_cosines,
+	equirectangular
+};
+
+namespace detail
+{
+
+template <typename T>
+inline constexpr T deg_to_rad = T(0.01745329251994329576924);
+
+template <typename T>
+inline constexpr T rad_to_deg = T(57.2957795130823208768);
+
+// lon2 - lon1 in radians, brought back to [-pi ; pi] so that points
+// across the antimeridian are close. Both the difference and the
+// wrap are exact in degrees.
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type deltaLongitude(typename Backend::type lon1, typename Backend::type lon2) noexcept
+{
+	typename Backend::type d = Backend::sub(lon2, lon1);
+	d = Backend::fnma(Backend::round(Backend::mul(d, Backend::set(T(1) / T(360)))), Backend::set(T(360)), d);
+	return Backend::mul(d, Backend::set(deg_to_rad<T>));
+}
+
+// Distance between (lat1, lon1) and (lat2, lon2), in degrees, with
+// the sine and cosine of lat1 given by the caller. Only the ones
+// needed by the formula are used.
+template <great_circle formula, typename T, typename Backend>
+FORCE_INLINE typename Backend::type distance(typename Backend::type lat1, typename Backend::type sin1, typename Backend::type cos1,
+                                             typename Backend::type lon1, typename Backend::type lat2, typename Backend::type lon2) noexcept
+{
+	const typename Backend::type deg  = Backend::set(deg_to_rad<T>);
+	const typename Backend::type r2   = Backend::mul(lat2, deg);
+	const typename Backend::type dlat = Backend::mul(Backend::sub(lat2, lat1), deg);
+	const typename Backend::type dlon = deltaLongitude<T, Backend>(lon1, lon2);
+
+	if constexpr (formula == great_circle::haversine)         return math::haversine        <T, Backend>(cos1, r2, dlat, dlon);
+	if constexpr (formula == great_circle::spherical_cosines) return math::spherical_cosines<T, Backend>(sin1, cos1, r2, dlon);
+	if constexpr (formula == great_circle::equirectangular)   return math::equirectangular  <T, Backend>(Backend::mul(lat1, deg), r2, dlat, dlon);
+}
+
+// Bearing in degrees, in [0 ; 360]
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type bearing(typename Backend::type sin1, typename Backend::type cos1,
+                                            typename Backend::type lon1, typename Backend::type lat2, typename Backend::type lon2) noexcept
+{
+	const typename Backend::type r2   = Backend::mul(lat2, Backend::set(deg_to_rad<T>));
+	const typename Backend::type dlon = deltaLongitude<T, Backend>(lon1, lon2);
+
+	typename Backend::type b = Backend::mul(math::initial_bearing<T, Backend>(sin1, cos1, r2, dlon), Backend::set(rad_to_deg<T>));
+	return Backend::select(Backend::cmplt(b, Backend::zero()), Backend::add(b, Backend::set(T(360))), b);
+}
+
+template <great_circle formula, SIMDLevel level, typename T>
+void distancePairwise(const T* lat1, const T* lon1, const T* lat2, const T* lon2, T* out, std::size_t n, T radius)
+{
+	using vct     = Vectratype<T, level>;
+	using backend = typename vct::backend;
+
+	const typename backend::type r = backend::set(radius);
+
+	auto op = [&](vct la1, vct lo1, vct la2, vct lo2)
+	{
+		const typename backend::type rad  = backend::mul(la1.value, backend::set(deg_to_rad<T>));
+		const typename backend::type sin1 = formula == great_circle::spherical_cosines ? backend::sin(rad) : rad;
+		const typename backend::type cos1 = formula != great_circle::equirectangular   ? backend::cos(rad) : rad;
+
+		return vct(backend::mul(r, distance<formula, T, backend>(la1.value, sin1, cos1, lo1.value, la2.value, lo2.value)));
+	};
+	transformImpl<level>(out, n, op, lat1, lon1, lat2, lon2);
+}
+
+template <great_circle formula, SIMDLevel level, typename T>
+void distanceOneToMany(T lat, T lon, const T* lat2, const T* lon2, T* out, std::size_t n, T radius)
+{
+	using vct     = Vectratype<T, level>;
+	using backend = typename vct::backend;
+
+	// Everything about the first point is computed once, with the same
+	// backend calls as the pairwise path. Results agree to a few ULP:
+	// compilers may contract multiply-add pairs (-ffp-contract=fast)
+	// differently in the two loops.
+	const typename backend::type lat1 = backend::set(lat);
+	const typename backend::type rad  = backend::mul(lat1, backend::set(deg_to_rad<T>));
+	const typename backend::type sin1 = backend::sin(rad);
+	const typename backend::type cos1 = backend::cos(rad);
+	const typename backend::type lon1 = backend::set(lon);
+	const typename backend::type r    = backend::set(radius);
+
+	auto op = [&](vct la, vct lo)
+	{
+		return vct(backend::mul(r, distance<formula, T, backend>(lat1, sin1, cos1, lon1, la.value, lo.value)));
+	};
+	transformImpl<level>(out, n, op, lat2, lon2);
+}
+
+// Runs impl<formula>() with the formula chosen at runtime, so that
+// the loops themselves are specialized and branch free
+template <typename Impl>
+FORCE_INLINE void dispatchFormula(great_circle formula, Impl impl)
+{
+	switch (formula)
+	{
+	case great_circle::haversine:         impl(std::integral_constant<great_circle, great_circle::haversine>{});         break;
+	case great_circle::spherical_cosines: impl(std::integral_constant<great_circle, great_circle::spherical_cosines>{}); break;
+	case great_circle::equirectangular:   impl(std::integral_constant<great_circle, great_circle::equirectangular>{});   break;
+	}
+}
+
+}
+
+/*
+ * @brief Great-circle distances between pairs of points.
+ *
+ * out[i] is the distance between (lat1[i], lon1[i]) and (lat2[i],
+ * lon2[i]), with coordinates in degrees. Distances are in the unit
+ * of radius, meters on Earth by default. Points are on a sphere: the
+ * flattening of the Earth makes them off by up to 0.5%.
+ *
+ * With the haversine formula, float is accurate to a few meters on
+ * Earth (a few tens of meters for nearly antipodal points), double to
+ * well below a millimeter.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void great_circle_distance(const T* lat1, const T* lon1, const T* lat2, const T* lon2, T* out, std::size_t n,
+                           great_circle formula = great_circle::haversine, T radius = T(earth_radius))
+{
+	detail::dispatchFormula(formula, [&](auto f) { detail::distancePairwise<f(), level>(lat1, lon1, lat2, lon2, out, n, radius); });
+}
+
+// One-to-many variant, out[i] is the distance from (lat, lon) to the
+// i-th point of (lat2, lon2). The trigonometry of (lat, lon) is done
+// once for the whole batch.
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void great_circle_distance(T lat, T lon, const T* lat2, const T* lon2, T* out, std::size_t n,
+                           great_circle formula = great_circle::haversine, T radius = T(earth_radius))
+{
+	detail::dispatchFormula(formula, [&](auto f) { detail::distanceOneToMany<f(), level>(lat, lon, lat2, lon2, out, n, radius); });
+}
+
+/*
+ * @brief Many-to-many great-circle distances.
+ *
+ * out is the m x n row-major matrix of the distances from the m
+ * points of (lat1, lon1) to the n points of (lat2, lon2), each row
+ * being a one-to-many batch.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void great_circle_matrix(const T* lat1, const T* lon1, std::size_t m, const T* lat2, const T* lon2, std::size_t n, T* out,
+                         great_circle formula = great_circle::haversine, T radius = T(earth_radius))
+{
+	detail::dispatchFormula(formula, [&](auto f)
+	{
+		for (std::size_t i = 0; i < m; ++i)
+			detail::distanceOneToMany<f(), level>(lat1[i], lon1[i], lat2, lon2, out + i * n, n, radius);
+	});
+}
+
+/*
+ * @brief Initial bearings between pairs of points.
+ *
+ * out[i] is the direction to follow from (lat1[i], lon1[i]) to reach
+ * (lat2[i], lon2[i]) along the great circle, in degrees clockwise
+ * from north, in [0 ; 360]. Coordinates are in degrees.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void initial_bearing(const T* lat1, const T* lon1, const T* lat2, const T* lon2, T* out, std::size_t n)
+{
+	using vct     = Vectratype<T, level>;
+	using backend = typename vct::backend;
+
+	auto op = [](vct la1, vct lo1, vct la2, vct lo2)
+	{
+		const typename backend::type rad = backend::mul(la1.value, backend::set(detail::deg_to_rad<T>));
+		return vct(detail::bearing<T, backend>(backend::sin(rad), backend::cos(rad), lo1.value, la2.value, lo2.value));
+	};
+	detail::transformImpl<level>(out, n, op, lat1, lon1, lat2, lon2);
+}
+
+// One-to-many variant, from (lat, lon) to every point of (lat2, lon2)
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void initial_bearing(T lat, T lon, const T* lat2, const T* lon2, T* out, std::size_t n)
+{
+	using vct     = Vectratype<T, level>;
+	using backend = typename vct::backend;
+
+	const typename backend::type rad  = backend::mul(backend::set(lat), backend::set(detail::deg_to_rad<T>));
+	const typename backend::type sin1 = backend::sin(rad);
+	const typename backend::type cos1 = backend::cos(rad);
+	const typename backend::type lon1 = backend::set(lon);
+
+	auto op = [&](vct la2, vct lo2) { return vct(detail::bearing<T, backend>(sin1, cos1, lon1, la2.value, lo2.value)); };
+	detail::transformImpl<level>(out, n, op, lat2, lon2);
+}
+
+}
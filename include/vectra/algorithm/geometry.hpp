@@ -0,0 +1,207 @@
+#pragma once
+
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <vectra/algorithm/transform.hpp>
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/simd_level.hpp>
+#include <vectra/types/vectratype.hpp>
+
+
+namespace vectra
+{
+
+/*
+ * @brief Precision of normalize3().
+ *
+ *  - exact: each component is divided by the length, correctly
+ *           rounded as a scalar division would be.
+ *  - fast : the reciprocal of the length is computed once with a
+ *           refined rsqrt estimate, then multiplied with each of the
+ *           components. No division nor square root, results within
+ *           a few ULP over the same range of lengths as exact.
+ */
+enum class normalization : std::uint8_t
+{
+	exact,
+	fast
+};
+
+namespace detail
+{
+
+template <typename Vct>
+FORCE_INLINE Vct dot3(Vct ax, Vct ay, Vct az, Vct bx, Vct by, Vct bz) noexcept
+{
+	return Vct::fma(ax, bx, Vct::fma(ay, by, az * bz));
+}
+
+template <typename Vct>
+FORCE_INLINE std::array<Vct, 3> cross3(Vct ax, Vct ay, Vct az, Vct bx, Vct by, Vct bz) noexcept
+{
+	return { Vct::fma(ay, bz, -(az * by)), Vct::fma(az, bx, -(ax * bz)), Vct::fma(ax, by, -(ay * bx)) };
+}
+
+// Same as transformImpl, for ops returning N registers written to
+// N outputs. Every input is loaded before the first store, so that
+// outputs may be equal to inputs (in-place).
+template <SIMDLevel level, typename T, std::size_t N, typename Op, typename... In>
+void transformN(T* const (&out)[N], std::size_t n, Op& op, const In*... in)
+{
+	using vct     = Vectratype<T, level>;
+	using backend = typename vct::backend;
+
+	constexpr std::size_t w = backend::width();
+
+	std::size_t i = 0;
+	for (; i + w <= n; i += w)
+	{
+		const std::array<vct, N> r = op(vct(backend::loadu(in + i))...);
+		for (std::size_t k = 0; k < N; ++k)
+			backend::unloadu(out[k] + i, r[k].value);
+	}
+
+	if (i < n)
+	{
+		const std::size_t rem = n - i;
+		const std::array<vct, N> r = op(vct(backend::loadu_partial(in + i, rem))...);
+		for (std::size_t k = 0; k < N; ++k)
+			backend::unloadu_partial(out[k] + i, r[k].value, rem);
+	}
+}
+
+}
+
+/*
+ * @brief Batched 3D vector kernels, on structure-of-arrays data.
+ *
+ * Vectors are given as one array per component, e.g. the columns of
+ * a soa_vector<T, T, T>, and processed a register at a time: element
+ * i of every array belongs to vector i. Outputs may be equal to the
+ * inputs, but must not partially overlap them.
+ */
+
+// out[i] = a[i] . b[i]
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void dot3(const T* ax, const T* ay, const T* az, const T* bx, const T* by, const T* bz, T* out, std::size_t n)
+{
+	using vct = Vectratype<T, level>;
+
+	auto op = [](vct ax, vct ay, vct az, vct bx, vct by, vct bz) { return detail::dot3(ax, ay, az, bx, by, bz); };
+	detail::transformImpl<level>(out, n, op, ax, ay, az, bx, by, bz);
+}
+
+// o[i] = a[i] x b[i]
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void cross3(const T* ax, const T* ay, const T* az, const T* bx, const T* by, const T* bz, T* ox, T* oy, T* oz, std::size_t n)
+{
+	using vct = Vectratype<T, level>;
+
+	T* const out[] = { ox, oy, oz };
+	auto op = [](vct ax, vct ay, vct az, vct bx, vct by, vct bz) { return detail::cross3(ax, ay, az, bx, by, bz); };
+	detail::transformN<level>(out, n, op, ax, ay, az, bx, by, bz);
+}
+
+// out[i] = |v[i]|. Not rescaled: squares may overflow for huge components.
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void length3(const T* x, const T* y, const T* z, T* out, std::size_t n)
+{
+	using vct = Vectratype<T, level>;
+
+	auto op = [](vct x, vct y, vct z) { return vct::sqrt(detail::dot3(x, y, z, x, y, z)); };
+	detail::transformImpl<level>(out, n, op, x, y, z);
+}
+
+/*
+ * @brief o[i] = v[i] / |v[i]|.
+ *
+ * Zero vectors are left to zero rather than turned into NaN, which is
+ * what collision code usually expects from degenerate normals.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void normalize3(const T* x, const T* y, const T* z, T* ox, T* oy, T* oz, std::size_t n, normalization mode = normalization::exact)
+{
+	using vct = Vectratype<T, level>;
+
+	T* const out[] = { ox, oy, oz };
+
+	if (mode == normalization::fast)
+	{
+		auto op = [](vct x, vct y, vct z)
+		{
+			const vct len2 = detail::dot3(x, y, z, x, y, z);
+			const vct inv  = vct::select(len2 == vct(T(0)), vct(T(0)), vct::rsqrt_refined(len2));
+			return std::array<vct, 3>{ x * inv, y * inv, z * inv };
+		};
+		detail::transformN<level>(out, n, op, x, y, z);
+		return;
+	}
+
+	auto op = [](vct x, vct y, vct z)
+	{
+		const vct len = vct::sqrt(detail::dot3(x, y, z, x, y, z));
+		const vct div = vct::select(len == vct(T(0)), vct(T(1)), len);
+		return std::array<vct, 3>{ x / div, y / div, z / div };
+	};
+	detail::transformN<level>(out, n, op, x, y, z);
+}
+
+/*
+ * @brief out[i] = angle between a[i] and b[i], in radians in [0 ; pi].
+ *
+ * Computed as atan2(|a x b|, a . b) rather than acos(a . b / (|a| |b|)):
+ * acos is ill-conditioned close to 0 and pi, where it loses half of
+ * the digits (no angle below 3e-4 rad in float), while atan2 stays
+ * accurate over the whole range. No normalization is needed either.
+ * The angle involving a zero vector is 0.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void angle3(const T* ax, const T* ay, const T* az, const T* bx, const T* by, const T* bz, T* out, std::size_t n)
+{
+	using vct = Vectratype<T, level>;
+
+	auto op = [](vct ax, vct ay, vct az, vct bx, vct by, vct bz)
+	{
+		// Adding zero turns a -0 dot product into +0, atan2(0, -0) being pi
+		const std::array<vct, 3> c = detail::cross3(ax, ay, az, bx, by, bz);
+		return vct::atan2(vct::sqrt(detail::dot3(c[0], c[1], c[2], c[0], c[1], c[2])), detail::dot3(ax, ay, az, bx, by, bz) + vct(T(0)));
+	};
+	detail::transformImpl<level>(out, n, op, ax, ay, az, bx, by, bz);
+}
+
+// o[i] = projection of a[i] onto b[i], (a . b / b . b) b. Zero when b is zero.
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void project3(const T* ax, const T* ay, const T* az, const T* bx, const T* by, const T* bz, T* ox, T* oy, T* oz, std::size_t n)
+{
+	using vct = Vectratype<T, level>;
+
+	T* const out[] = { ox, oy, oz };
+	auto op = [](vct ax, vct ay, vct az, vct bx, vct by, vct bz)
+	{
+		const vct bb = detail::dot3(bx, by, bz, bx, by, bz);
+		const vct s  = vct::select(bb == vct(T(0)), vct(T(0)), detail::dot3(ax, ay, az, bx, by, bz) / bb);
+		return std::array<vct, 3>{ s * bx, s * by, s * bz };
+	};
+	detail::transformN<level>(out, n, op, ax, ay, az, bx, by, bz);
+}
+
+// o[i] = reflection of v[i] on the plane of normal m[i], v - 2 (v . m) m.
+// As for GLSL reflect(), normals are expected to be unit vectors.
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void reflect3(const T* vx, const T* vy, const T* vz, const T* mx, const T* my, const T* mz, T* ox, T* oy, T* oz, std::size_t n)
+{
+	using vct = Vectratype<T, level>;
+
+	T* const out[] = { ox, oy, oz };
+	auto op = [](vct vx, vct vy, vct vz, vct mx, vct my, vct mz)
+	{
+		const vct d = vct(T(-2)) * detail::dot3(vx, vy, vz, mx, my, mz);
+		return std::array<vct, 3>{ vct::fma(d, mx, vx), vct::fma(d, my, vy), vct::fma(d, mz, vz) };
+	};
+	detail::transformN<level>(out, n, op, vx, vy, vz, mx, my, mz);
+}
+
+}
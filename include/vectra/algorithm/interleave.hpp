@@ -0,0 +1,146 @@
+#pragma once
+
+
+#include <cstddef>
+#include <utility>
+
+#include <vectra/backend/compute_backend.hpp>
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/simd_level.hpp>
+
+
+namespace vectra
+{
+
+namespace detail
+{
+
+// Splits (or merges) one register of records of 2, 3 or 4 elements
+// each, with the backend shuffles.
+template <typename Backend, typename T>
+FORCE_INLINE void deinterleaveRegister(const T* in, typename Backend::type& a, typename Backend::type& b) noexcept { Backend::deinterleave2(in, a, b); }
+template <typename Backend, typename T>
+FORCE_INLINE void deinterleaveRegister(const T* in, typename Backend::type& a, typename Backend::type& b, typename Backend::type& c) noexcept { Backend::deinterleave3(in, a, b, c); }
+template <typename Backend, typename T>
+FORCE_INLINE void deinterleaveRegister(const T* in, typename Backend::type& a, typename Backend::type& b, typename Backend::type& c, typename Backend::type& d) noexcept { Backend::deinterleave4(in, a, b, c, d); }
+
+template <typename Backend, typename T>
+FORCE_INLINE void interleaveRegister(T* out, typename Backend::type a, typename Backend::type b) noexcept { Backend::interleave2(out, a, b); }
+template <typename Backend, typename T>
+FORCE_INLINE void interleaveRegister(T* out, typename Backend::type a, typename Backend::type b, typename Backend::type c) noexcept { Backend::interleave3(out, a, b, c); }
+template <typename Backend, typename T>
+FORCE_INLINE void interleaveRegister(T* out, typename Backend::type a, typename Backend::type b, typename Backend::type c, typename Backend::type d) noexcept { Backend::interleave4(out, a, b, c, d); }
+
+template <SIMDLevel level, typename T, std::size_t... K>
+FORCE_INLINE void deinterleaveImpl(const T* in, T* const (&out)[sizeof...(K)], std::size_t n, std::index_sequence<K...>) noexcept
+{
+	using backend = ComputeBackend<T, level>;
+
+	constexpr std::size_t w = backend::width();
+	constexpr std::size_t s = sizeof...(K);
+
+	typename backend::type v[s];
+
+	std::size_t i = 0;
+	for (; i + w <= n; i += w)
+	{
+		deinterleaveRegister<backend>(in + i * s, v[K]...);
+		(backend::unloadu(out[K] + i, v[K]), ...);
+	}
+
+	// The last records go through a zero-padded stack buffer, so
+	// that the shuffles never read past the end of the input
+	if (i < n)
+	{
+		const std::size_t r = n - i;
+
+		T tmp[w * s] = {};
+		for (std::size_t j = 0; j < r * s; ++j)
+			tmp[j] = in[i * s + j];
+
+		deinterleaveRegister<backend>(tmp, v[K]...);
+		(backend::unloadu_partial(out[K] + i, v[K], r), ...);
+	}
+}
+
+template <SIMDLevel level, typename T, std::size_t... K>
+FORCE_INLINE void interleaveImpl(const T* const (&in)[sizeof...(K)], T* out, std::size_t n, std::index_sequence<K...>) noexcept
+{
+	using backend = ComputeBackend<T, level>;
+
+	constexpr std::size_t w = backend::width();
+	constexpr std::size_t s = sizeof...(K);
+
+	std::size_t i = 0;
+	for (; i + w <= n; i += w)
+		interleaveRegister<backend>(out + i * s, backend::loadu(in[K] + i)...);
+
+	// Same for the output, only the valid records are copied back
+	if (i < n)
+	{
+		const std::size_t r = n - i;
+
+		T tmp[w * s];
+		interleaveRegister<backend>(tmp, backend::loadu_partial(in[K] + i, r)...);
+
+		for (std::size_t j = 0; j < r * s; ++j)
+			out[i * s + j] = tmp[j];
+	}
+}
+
+}
+
+/*
+ * @brief Splits n interleaved records into one array per component.
+ *
+ * in holds a0 b0 a1 b1 ... (stride 2), a0 b0 c0 a1 b1 c1 ... (stride
+ * 3) or a0 b0 c0 d0 ... (stride 4), e.g. xyz points from upstream
+ * buffers, and component arrays can be used directly with loadu, or
+ * as the columns of a soa_vector. Each register of records is split
+ * with a few in-register shuffles instead of a strided scalar loop.
+ * The arrays must not overlap.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void deinterleave(const T* in, T* a, T* b, std::size_t n) noexcept
+{
+	T* const out[] = { a, b };
+	detail::deinterleaveImpl<level>(in, out, n, std::make_index_sequence<2>{});
+}
+
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void deinterleave(const T* in, T* a, T* b, T* c, std::size_t n) noexcept
+{
+	T* const out[] = { a, b, c };
+	detail::deinterleaveImpl<level>(in, out, n, std::make_index_sequence<3>{});
+}
+
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void deinterleave(const T* in, T* a, T* b, T* c, T* d, std::size_t n) noexcept
+{
+	T* const out[] = { a, b, c, d };
+	detail::deinterleaveImpl<level>(in, out, n, std::make_index_sequence<4>{});
+}
+
+// Inverse of deinterleave(), writes n interleaved records to out
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void interleave(const T* a, const T* b, T* out, std::size_t n) noexcept
+{
+	const T* const in[] = { a, b };
+	detail::interleaveImpl<level>(in, out, n, std::make_index_sequence<2>{});
+}
+
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void interleave(const T* a, const T* b, const T* c, T* out, std::size_t n) noexcept
+{
+	const T* const in[] = { a, b, c };
+	detail::interleaveImpl<level>(in, out, n, std::make_index_sequence<3>{});
+}
+
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+void interleave(const T* a, const T* b, const T* c, const T* d, T* out, std::size_t n) noexcept
+{
+	const T* const in[] = { a, b, c, d };
+	detail::interleaveImpl<level>(in, out, n, std::make_index_sequence<4>{});
+}
+
+}
@@ -0,0 +1,460 @@
+#pragma once
+
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include <vectra/algorithm/transform.hpp>
+#include <vectra/backend/compute_backend.hpp>
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/simd_level.hpp>
+#include <vectra/math/compensated.hpp>
+#include <vectra/parallel/parallel_for.hpp>
+
+
+namespace vectra
+{
+
+/*
+ * @brief Accumulation mode of the sum-based reductions.
+ *
+ *  - fast       : plain vector accumulators. The error grows with n
+ *                 and the condition number of the sum.
+ *  - compensated: every rounding error is accumulated separately
+ *                 with error-free transformations (Neumaier / Dot2),
+ *                 as accurate as summing in twice the precision. It
+ *                 costs about 2 to 4 times more arithmetic.
+ */
+enum class accumulation : std::uint8_t
+{
+	fast,
+	compensated
+};
+
+namespace detail
+{
+
+// Independent accumulators. Four of them hide the latency of the
+// additions, each one depending only on the previous iteration.
+inline constexpr std::size_t reduce_accumulators = transform_unroll;
+
+// Feeds n elements of each input to step(k, registers...), which
+// updates accumulator k. Full registers rotate over accumulators,
+// then the remainder is loaded with zeros in the unused lanes.
+template <SIMDLevel level, typename T, typename Step, typename... In>
+FORCE_INLINE void accumulate(std::size_t n, Step& step, const In*... in)
+{
+	using backend = ComputeBackend<T, level>;
+
+	constexpr std::size_t w = backend::width();
+
+	std::size_t i = 0;
+	for (; i + reduce_accumulators * w <= n; i += reduce_accumulators * w)
+	{
+		step(0, backend::loadu(in + i        )...);
+		step(1, backend::loadu(in + i +     w)...);
+		step(2, backend::loadu(in + i + 2 * w)...);
+		step(3, backend::loadu(in + i + 3 * w)...);
+	}
+
+	for (; i + w <= n; i += w)
+		step(0, backend::loadu(in + i)...);
+
+	if (i < n)
+		step(1, backend::loadu_partial(in + i, n - i)...);
+}
+
+template <typename Backend>
+FORCE_INLINE typename Backend::type combine(const typename Backend::type (&acc)[reduce_accumulators]) noexcept
+{
+	return Backend::add(Backend::add(acc[0], acc[1]), Backend::add(acc[2], acc[3]));
+}
+
+// Sums the lanes of every (s, c) accumulator pair, still compensated
+template <typename T, SIMDLevel level>
+T combineCompensated(const typename ComputeBackend<T, level>::type (&s)[reduce_accumulators],
+                     const typename ComputeBackend<T, level>::type (&c)[reduce_accumulators]) noexcept
+{
+	using backend = ComputeBackend<T, level>;
+	using scalar  = ComputeBackend<T, SIMDLevel::None>;
+
+	alignas(backend::alignment()) T sl[backend::width()];
+	alignas(backend::alignment()) T cl[backend::width()];
+
+	T sum = T(0);
+	T err = T(0);
+	for (std::size_t k = 0; k < reduce_accumulators; ++k)
+	{
+		backend::unloada(sl, s[k]);
+		backend::unloada(cl, c[k]);
+
+		for (std::size_t j = 0; j < backend::width(); ++j)
+		{
+			T e;
+			sum = math::two_sum<scalar>(sum, sl[j], e);
+			err += e + cl[j];
+		}
+	}
+	return sum + err;
+}
+
+// Reduces x with op, which must be idempotent (min or max), and
+// returns the resulting register. The remainder is handled with a
+// final register overlapping the previous one, or with the lanes
+// padded with identity when x is shorter than a register.
+template <SIMDLevel level, typename T, typename Op>
+FORCE_INLINE typename ComputeBackend<T, level>::type reduceIdempotent(const T* x, std::size_t n, T identity, Op op) noexcept
+{
+	using backend = ComputeBackend<T, level>;
+	using type    = typename backend::type;
+
+	constexpr std::size_t w = backend::width();
+
+	type acc[reduce_accumulators] = { backend::set(identity), backend::set(identity), backend::set(identity), backend::set(identity) };
+	auto step = [&](std::size_t k, type v) { acc[k] = op(v, acc[k]); };
+
+	if (n >= w)
+	{
+		accumulate<level, T>(n - n % w, step, x);
+		if (n % w != 0)
+			step(1, backend::loadu(x + n - w));
+	}
+	else
+	{
+		alignas(backend::alignment()) T padded[w];
+		for (std::size_t j = 0; j < w; ++j)
+			padded[j] = j < n ? x[j] : identity;
+		step(0, backend::loada(padded));
+	}
+
+	return op(op(acc[0], acc[1]), op(acc[2], acc[3]));
+}
+
+// Scalar reduction of the lanes of a register
+template <typename T, SIMDLevel level, typename Op>
+T reduceLanes(typename ComputeBackend<T, level>::type x, Op op) noexcept
+{
+	using backend = ComputeBackend<T, level>;
+
+	alignas(backend::alignment()) T lanes[backend::width()];
+	backend::unloada(lanes, x);
+
+	T result = lanes[0];
+	for (std::size_t j = 1; j < backend::width(); ++j)
+		result = op(lanes[j], result);
+	return result;
+}
+
+}
+
+/*
+ * @brief Sum of the n elements of x.
+ *
+ * Uses four independent vector accumulators, so that the additions
+ * run at throughput rather than latency. The order of the additions
+ * differs from a sequential loop, so results may differ slightly.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+T sum(const T* x, std::size_t n, accumulation mode = accumulation::fast) noexcept
+{
+	using backend = ComputeBackend<T, level>;
+	using type    = typename backend::type;
+
+	if (mode == accumulation::compensated)
+	{
+		type s[detail::reduce_accumulators] = { backend::zero(), backend::zero(), backend::zero(), backend::zero() };
+		type c[detail::reduce_accumulators] = { backend::zero(), backend::zero(), backend::zero(), backend::zero() };
+
+		auto step = [&](std::size_t k, type v)
+		{
+			type e;
+			s[k] = math::two_sum<backend>(s[k], v, e);
+			c[k] = backend::add(c[k], e);
+		};
+		detail::accumulate<level, T>(n, step, x);
+
+		return detail::combineCompensated<T, level>(s, c);
+	}
+
+	type acc[detail::reduce_accumulators] = { backend::zero(), backend::zero(), backend::zero(), backend::zero() };
+	auto step = [&](std::size_t k, type v) { acc[k] = backend::add(acc[k], v); };
+	detail::accumulate<level, T>(n, step, x);
+
+	return backend::hsum(detail::combine<backend>(acc));
+}
+
+/*
+ * @brief Dot product of the n elements of a and b.
+ *
+ * Each step is a single fused multiply-add on backends having FMA.
+ * In compensated mode, the rounding errors of both products and sums
+ * are accumulated (Ogita, Rump and Oishi's Dot2 algorithm).
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+T dot(const T* a, const T* b, std::size_t n, accumulation mode = accumulation::fast) noexcept
+{
+	using backend = ComputeBackend<T, level>;
+	using type    = typename backend::type;
+
+	if (mode == accumulation::compensated)
+	{
+		type s[detail::reduce_accumulators] = { backend::zero(), backend::zero(), backend::zero(), backend::zero() };
+		type c[detail::reduce_accumulators] = { backend::zero(), backend::zero(), backend::zero(), backend::zero() };
+
+		auto step = [&](std::size_t k, type x, type y)
+		{
+			type ep, es;
+			type p = math::two_prod<T, backend>(x, y, ep);
+			s[k] = math::two_sum<backend>(s[k], p, es);
+			c[k] = backend::add(c[k], backend::add(ep, es));
+		};
+		detail::accumulate<level, T>(n, step, a, b);
+
+		return detail::combineCompensated<T, level>(s, c);
+	}
+
+	type acc[detail::reduce_accumulators] = { backend::zero(), backend::zero(), backend::zero(), backend::zero() };
+	auto step = [&](std::size_t k, type x, type y) { acc[k] = backend::fma(x, y, acc[k]); };
+	detail::accumulate<level, T>(n, step, a, b);
+
+	return backend::hsum(detail::combine<backend>(acc));
+}
+
+/*
+ * @brief Euclidean norm of the n elements of x, sqrt(dot(x, x)).
+ *
+ * Squares are not rescaled: the result overflows when the sum of
+ * squares does (|x| around 1e19 for float), unlike std::hypot.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+T norm(const T* x, std::size_t n, accumulation mode = accumulation::fast) noexcept
+{
+	return std::sqrt(dot<level>(x, x, n, mode));
+}
+
+/*
+ * @brief Smallest element of x.
+ *
+ * NaN elements are ignored. Returns +inf when n is zero, or when
+ * every element is NaN.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+T min(const T* x, std::size_t n) noexcept
+{
+	using backend = ComputeBackend<T, level>;
+
+	// The accumulator is the second operand, that min() returns when
+	// the other is NaN: NaN elements never reach the accumulators.
+	auto op = [](typename backend::type v, typename backend::type acc) { return backend::min(v, acc); };
+	auto r  = detail::reduceIdempotent<level>(x, n, std::numeric_limits<T>::infinity(), op);
+	return detail::reduceLanes<T, level>(r, [](T v, T acc) { return v < acc ? v : acc; });
+}
+
+/*
+ * @brief Largest element of x.
+ *
+ * NaN elements are ignored. Returns -inf when n is zero, or when
+ * every element is NaN.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+T max(const T* x, std::size_t n) noexcept
+{
+	using backend = ComputeBackend<T, level>;
+
+	auto op = [](typename backend::type v, typename backend::type acc) { return backend::max(v, acc); };
+	auto r  = detail::reduceIdempotent<level>(x, n, -std::numeric_limits<T>::infinity(), op);
+	return detail::reduceLanes<T, level>(r, [](T v, T acc) { return v > acc ? v : acc; });
+}
+
+namespace detail
+{
+
+// Block size of argmin / argmax, small enough to stay in L1 cache
+inline constexpr std::size_t arg_block = 1024;
+
+// Vectorized min (or max) of every block, then a scalar search of
+// the first matching element, starting at the first block holding
+// the extremum, so that memory is mostly streamed once. better(a, b)
+// is a < b for min. Blocks only made of NaN reduce to the identity,
+// which is why the search may go on past the block.
+template <SIMDLevel level, typename T, typename Reduce, typename Better>
+std::size_t argReduce(const T* x, std::size_t n, Reduce reduce, Better better) noexcept
+{
+	if (n == 0)
+		return 0;
+
+	std::size_t block = 0;
+	T best = reduce(x, n < arg_block ? n : arg_block);
+
+	for (std::size_t i = arg_block; i < n; i += arg_block)
+	{
+		const T value = reduce(x + i, n - i < arg_block ? n - i : arg_block);
+		if (better(value, best))
+		{
+			best  = value;
+			block = i;
+		}
+	}
+
+	for (std::size_t i = block; i < n; ++i)
+		if (x[i] == best)
+			return i;
+	return n;
+}
+
+}
+
+/*
+ * @brief Index of the first smallest element of x.
+ *
+ * NaN elements are ignored. Returns n when n is zero, or when every
+ * element is NaN.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+std::size_t argmin(const T* x, std::size_t n) noexcept
+{
+	return detail::argReduce<level>(x, n,
+		[](const T* p, std::size_t m) { return min<level>(p, m); },
+		[](T a, T b) { return a < b; });
+}
+
+/*
+ * @brief Index of the first largest element of x.
+ *
+ * NaN elements are ignored. Returns n when n is zero, or when every
+ * element is NaN.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+std::size_t argmax(const T* x, std::size_t n) noexcept
+{
+	return detail::argReduce<level>(x, n,
+		[](const T* p, std::size_t m) { return max<level>(p, m); },
+		[](T a, T b) { return a > b; });
+}
+
+namespace detail
+{
+
+// Sum of the chunk sums. In compensated mode, the rounding errors of
+// the final additions are accumulated too.
+template <SIMDLevel level, typename T, typename Map>
+T parallelSum(const T* x, std::size_t n, accumulation mode, Map map)
+{
+	using scalar = ComputeBackend<T, SIMDLevel::None>;
+	using pair   = std::pair<T, T>;
+
+	if (mode == accumulation::fast)
+		return parallel_reduce<level>(x, n, T(0), map, [](T a, T b) { return a + b; });
+
+	const pair r = parallel_reduce<level>(x, n, pair(T(0), T(0)),
+		[&](std::size_t begin, std::size_t end) { return pair(map(begin, end), T(0)); },
+		[](pair a, pair b)
+		{
+			T e;
+			const T s = math::two_sum<scalar>(a.first, b.first, e);
+			return pair(s, a.second + b.second + e);
+		});
+	return r.first + r.second;
+}
+
+// First index of the extremum of the chunk extrema. Chunks only made
+// of NaN return (identity, n), which is never better than a real one.
+template <SIMDLevel level, typename T, typename Arg, typename Better>
+std::size_t parallelArg(const T* x, std::size_t n, T identity, Arg arg, Better better)
+{
+	using pair = std::pair<T, std::size_t>;
+
+	const pair r = parallel_reduce<level>(x, n, pair(identity, n),
+		[&](std::size_t begin, std::size_t end)
+		{
+			const std::size_t i = arg(x + begin, end - begin);
+			return i < end - begin ? pair(x[begin + i], begin + i) : pair(identity, n);
+		},
+		[&](pair a, pair b) { return b.second != n && (a.second == n || better(b.first, a.first)) ? b : a; });
+	return r.second;
+}
+
+}
+
+/*
+ * @brief Reductions with an execution policy.
+ *
+ * With execution::parallel, each chunk of the arrays is reduced by
+ * one thread of thread_pool::global(), then the partial results are
+ * combined in the order of the chunks. Sums are thus added in another
+ * order than the sequential ones, which depends on the number of
+ * threads but not on the scheduling: results are reproducible on a
+ * given machine. min, max, argmin and argmax are exact.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+T sum(execution policy, const T* x, std::size_t n, accumulation mode = accumulation::fast)
+{
+	if (policy == execution::sequential)
+		return sum<level>(x, n, mode);
+
+	return detail::parallelSum<level>(x, n, mode, [&](std::size_t begin, std::size_t end) { return sum<level>(x + begin, end - begin, mode); });
+}
+
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+T dot(execution policy, const T* a, const T* b, std::size_t n, accumulation mode = accumulation::fast)
+{
+	if (policy == execution::sequential)
+		return dot<level>(a, b, n, mode);
+
+	return detail::parallelSum<level>(a, n, mode, [&](std::size_t begin, std::size_t end) { return dot<level>(a + begin, b + begin, end - begin, mode); });
+}
+
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+T norm(execution policy, const T* x, std::size_t n, accumulation mode = accumulation::fast)
+{
+	return std::sqrt(dot<level>(policy, x, x, n, mode));
+}
+
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+T min(execution policy, const T* x, std::size_t n)
+{
+	if (policy == execution::sequential)
+		return min<level>(x, n);
+
+	return parallel_reduce<level>(x, n, std::numeric_limits<T>::infinity(),
+		[&](std::size_t begin, std::size_t end) { return min<level>(x + begin, end - begin); },
+		[](T a, T b) { return b < a ? b : a; });
+}
+
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+T max(execution policy, const T* x, std::size_t n)
+{
+	if (policy == execution::sequential)
+		return max<level>(x, n);
+
+	return parallel_reduce<level>(x, n, -std::numeric_limits<T>::infinity(),
+		[&](std::size_t begin, std::size_t end) { return max<level>(x + begin, end - begin); },
+		[](T a, T b) { return b > a ? b : a; });
+}
+
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+std::size_t argmin(execution policy, const T* x, std::size_t n)
+{
+	if (policy == execution::sequential)
+		return argmin<level>(x, n);
+
+	return detail::parallelArg<level>(x, n, std::numeric_limits<T>::infinity(),
+		[](const T* p, std::size_t m) { return argmin<level>(p, m); },
+		[](T a, T b) { return a < b; });
+}
+
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T>
+std::size_t argmax(execution policy, const T* x, std::size_t n)
+{
+	if (policy == execution::sequential)
+		return argmax<level>(x, n);
+
+	return detail::parallelArg<level>(x, n, -std::numeric_limits<T>::infinity(),
+		[](const T* p, std::size_t m) { return argmax<level>(p, m); },
+		[](T a, T b) { return a > b; });
+}
+
+}
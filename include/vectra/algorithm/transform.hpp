@@ -0,0 +1,217 @@
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/simd_level.hpp>
+#include <vectra/parallel/parallel_for.hpp>
+#include <vectra/types/vectratype.hpp>
+
+
+namespace vectra
+{
+
+namespace detail
+{
+
+// Number of independent registers processed per iteration of the
+// main loop, enough to hide the latency of most kernels.
+inline constexpr std::size_t transform_unroll = 4;
+
+template <std::size_t Alignment, typename T>
+FORCE_INLINE bool isAligned(const T* ptr) noexcept
+{
+	return reinterpret_cast<std::uintptr_t>(ptr) % Alignment == 0;
+}
+
+template <bool aligned, typename Backend, typename T>
+FORCE_INLINE typename Backend::type load(const T* ptr) noexcept
+{
+	if constexpr (aligned) return Backend::loada(ptr);
+	else                   return Backend::loadu(ptr);
+}
+
+// Outputs of at least this many bytes are written with streaming
+// stores, when aligned and not in-place: larger than the share of
+// the last level cache of most cores, they would only evict useful
+// lines, and cost a read for ownership of every line written.
+inline constexpr std::size_t stream_threshold = std::size_t(4) << 20;
+
+template <bool aligned, bool streaming, typename Backend, typename T>
+FORCE_INLINE void store(T* ptr, typename Backend::type x) noexcept
+{
+	if constexpr (streaming)    Backend::stream(ptr, x);
+	else if constexpr (aligned) Backend::unloada(ptr, x);
+	else                        Backend::unloadu(ptr, x);
+}
+
+// Streaming is decided once for the whole output, chunks of parallel
+// transforms being below the threshold
+template <typename T, typename... In>
+FORCE_INLINE bool streamOutput(const T* out, std::size_t n, const In*... in) noexcept
+{
+	return n * sizeof(T) >= stream_threshold && ((static_cast<const void*>(out) != static_cast<const void*>(in)) && ...);
+}
+
+// Full registers, unrolled then one at a time. Returns the number
+// of elements processed, always a multiple of the register width.
+// Loads are aligned with aligned, stores are streamed with streaming
+// (out being aligned) or follow aligned.
+template <bool aligned, bool streaming, SIMDLevel level, typename T, typename Op, typename... In>
+FORCE_INLINE std::size_t transformBody(T* out, std::size_t n, Op& op, const In*... in)
+{
+	using vct     = Vectratype<T, level>;
+	using backend = typename vct::backend;
+
+	constexpr std::size_t w = backend::width();
+
+	std::size_t i = 0;
+	for (; i + transform_unroll * w <= n; i += transform_unroll * w)
+	{
+		// Every result is computed before the first store, so that
+		// the four dependency chains are interleaved in the pipeline
+		vct r0 = op(vct(load<aligned, backend>(in + i        ))...);
+		vct r1 = op(vct(load<aligned, backend>(in + i +     w))...);
+		vct r2 = op(vct(load<aligned, backend>(in + i + 2 * w))...);
+		vct r3 = op(vct(load<aligned, backend>(in + i + 3 * w))...);
+
+		store<aligned, streaming, backend>(out + i        , r0.value);
+		store<aligned, streaming, backend>(out + i +     w, r1.value);
+		store<aligned, streaming, backend>(out + i + 2 * w, r2.value);
+		store<aligned, streaming, backend>(out + i + 3 * w, r3.value);
+	}
+
+	for (; i + w <= n; i += w)
+		store<aligned, streaming, backend>(out + i, op(vct(load<aligned, backend>(in + i))...).value);
+
+	return i;
+}
+
+template <SIMDLevel level, typename T, typename Op, typename... In>
+FORCE_INLINE void transformRange(bool stream, T* out, std::size_t n, Op& op, const In*... in)
+{
+	using vct     = Vectratype<T, level>;
+	using backend = typename vct::backend;
+
+	// Buffers from aligned_allocator (or any aligned storage) take
+	// the aligned path. Mixed alignments fall back to unaligned.
+	const bool alignedOut = isAligned<backend::alignment()>(out);
+	const bool aligned    = alignedOut && (isAligned<backend::alignment()>(in) && ...);
+
+	std::size_t i = 0;
+	if (stream && alignedOut)
+	{
+		i = aligned
+			? transformBody<true,  true, level>(out, n, op, in...)
+			: transformBody<false, true, level>(out, n, op, in...);
+
+		// Streamed data is visible to other threads once fenced
+		backend::sfence();
+	}
+	else
+	{
+		i = aligned
+			? transformBody<true,  false, level>(out, n, op, in...)
+			: transformBody<false, false, level>(out, n, op, in...);
+	}
+
+	// Remaining elements are handled by a single masked register,
+	// lanes past the end being neither read nor written.
+	if (i < n)
+	{
+		const std::size_t r = n - i;
+		backend::unloadu_partial(out + i, op(vct(backend::loadu_partial(in + i, r))...).value, r);
+	}
+}
+
+template <SIMDLevel level, typename T, typename Op, typename... In>
+FORCE_INLINE void transformImpl(T* out, std::size_t n, Op& op, const In*... in)
+{
+	transformRange<level>(streamOutput(out, n, in...), out, n, op, in...);
+}
+
+// Each chunk is an independent transform, aligned on the cache lines
+// of out: chunks keep the aligned path of aligned buffers.
+template <SIMDLevel level, typename T, typename Op, typename... In>
+void transformPolicy(execution policy, T* out, std::size_t n, Op& op, const In*... in)
+{
+	if (policy == execution::sequential)
+	{
+		transformImpl<level>(out, n, op, in...);
+		return;
+	}
+
+	const bool stream = streamOutput(out, n, in...);
+	parallel_for<level>(out, n, [&](std::size_t begin, std::size_t end)
+	{
+		transformRange<level>(stream, out + begin, end - begin, op, (in + begin)...);
+	});
+}
+
+}
+
+/*
+ * @brief Applies op to every element of in, and writes it to out.
+ *
+ * op is called with Vectratype<T, level> arguments and must return
+ * a Vectratype<T, level>, e.g. [](auto x) { return x * x; }.
+ *
+ * The main loop is unrolled, and uses aligned loads and stores when
+ * every pointer is aligned on backend::alignment(), as is the case
+ * with aligned_allocator. Aligned outputs of detail::stream_threshold
+ * bytes or more, other than the input, are written with streaming
+ * stores that bypass the caches. The remainder is processed with a
+ * masked partial register rather than a scalar loop, so op is always
+ * run on the SIMD path.
+ *
+ * out may be equal to in (in-place), but must not partially overlap
+ * it. level defaults to the highest backend enabled at compile time.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T, typename Op>
+void transform(const T* in, T* out, std::size_t n, Op op)
+{
+	detail::transformImpl<level>(out, n, op, in);
+}
+
+// Binary variant, op is called with one element of a and one of b
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T, typename Op>
+void transform(const T* a, const T* b, T* out, std::size_t n, Op op)
+{
+	detail::transformImpl<level>(out, n, op, a, b);
+}
+
+// Ternary variant, e.g. for fused multiply-add on three arrays
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T, typename Op>
+void transform(const T* a, const T* b, const T* c, T* out, std::size_t n, Op op)
+{
+	detail::transformImpl<level>(out, n, op, a, b, c);
+}
+
+/*
+ * @brief Same as transform(), with an execution policy.
+ *
+ * With execution::parallel, op is called concurrently by the threads
+ * of thread_pool::global(), and must be safe to do so (no mutable
+ * captured state). Results are the same as the sequential ones.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T, typename Op>
+void transform(execution policy, const T* in, T* out, std::size_t n, Op op)
+{
+	detail::transformPolicy<level>(policy, out, n, op, in);
+}
+
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T, typename Op>
+void transform(execution policy, const T* a, const T* b, T* out, std::size_t n, Op op)
+{
+	detail::transformPolicy<level>(policy, out, n, op, a, b);
+}
+
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T, typename Op>
+void transform(execution policy, const T* a, const T* b, const T* c, T* out, std::size_t n, Op op)
+{
+	detail::transformPolicy<level>(policy, out, n, op, a, b, c);
+}
+
+}
@@ -1,10 +1,21 @@
 #pragma once
 
+#include <cstdint>
+
 #include <immintrin.h>
 
 #include <vectra/core/simd_level.hpp>
 #include <vectra/core/attributes.hpp>
 #include <vectra/core/constants.hpp>
+#include <vectra/core/half.hpp>
+#include <vectra/detail/gather.hpp>
+#include <vectra/detail/tail_mask.hpp>
+#include <vectra/math/exponential.hpp>
+#include <vectra/math/inverse_trigonometric.hpp>
+#include <vectra/math/logarithmic.hpp>
+#include <vectra/math/power.hpp>
+#include <vectra/math/reciprocal.hpp>
+#include <vectra/math/trigonometric.hpp>
 
 
 namespace vectra
@@ -13,6 +24,12 @@ namespace vectra
 template <>
 struct ComputeBackend<float, SIMDLevel::AVX> {
 	using type = __m256;
+	using mask = __m256; // All bits set in the lanes where true
+	using index = __m256i; // Indices of gather() and scatter(), int32_t lanes
+	// SVML provides vectorized transcendental functions, but it
+	// is only shipped with MSVC and the Intel compilers. Unless
+	// VECTRA_USE_SVML is defined, we rely on in-house kernels.
+	#ifdef VECTRA_USE_SVML
 	FORCE_INLINE static type sin (type x)		  noexcept { return _mm256_sin_ps(x); }
 	FORCE_INLINE static type cos (type x)		  noexcept { return _mm256_cos_ps(x); }
 	// Since our approximation of arccos is not defined only over
@@ -22,9 +39,41 @@ struct ComputeBackend<float, SIMDLevel::AVX> {
 	#else
 	FORCE_INLINE static type acos(type x)		  noexcept { return _mm256_acos_ps(_mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-1.f)), _mm256_set1_ps(1.f))); }
 	#endif
-	FORCE_INLINE static type sqrt(type x)		  noexcept { return _mm256_sqrt_ps(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return _mm256_asin_ps(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return _mm256_atan_ps(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return _mm256_atan2_ps(y, x); }
 	FORCE_INLINE static type cbrt(type x)		  noexcept { return _mm256_cbrt_ps(x); }
 	FORCE_INLINE static type exp (type x)		  noexcept { return _mm256_exp_ps(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return _mm256_exp2_ps(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return _mm256_expm1_ps(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return _mm256_log_ps(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return _mm256_log2_ps(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return _mm256_log1p_ps(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return _mm256_pow_ps(a, b); }
+	#else
+	FORCE_INLINE static type sin (type x)		  noexcept { return math::sin<float, ComputeBackend>(x); }
+	FORCE_INLINE static type cos (type x)		  noexcept { return math::cos<float, ComputeBackend>(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return math::asin <float, ComputeBackend>(x); }
+	FORCE_INLINE static type acos(type x)		  noexcept { return math::acos <float, ComputeBackend>(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return math::atan <float, ComputeBackend>(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return math::atan2<float, ComputeBackend>(y, x); }
+	FORCE_INLINE static type cbrt(type x)		  noexcept { return math::cbrt <float, ComputeBackend>(x); }
+	FORCE_INLINE static type exp (type x)		  noexcept { return math::exp  <float, ComputeBackend>(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return math::exp2 <float, ComputeBackend>(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return math::expm1<float, ComputeBackend>(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return math::log  <float, ComputeBackend>(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return math::log2 <float, ComputeBackend>(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return math::log1p<float, ComputeBackend>(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return math::pow  <float, ComputeBackend>(a, b); }
+	#endif
+	FORCE_INLINE static type sqrt(type x)		  noexcept { return _mm256_sqrt_ps(x); }
+
+	// Estimates of 1/x and 1/sqrt(x), relative error below 1.5 * 2^-12,
+	// refined by one Newton step to a few ULP (see math/reciprocal.hpp)
+	FORCE_INLINE static type rcp  (type x) noexcept { return math::rcp_estimate  <float, ComputeBackend>(x, [](type v) { return _mm256_rcp_ps(v); }); }
+	FORCE_INLINE static type rsqrt(type x) noexcept { return math::rsqrt_estimate<float, ComputeBackend>(x, [](type v) { return _mm256_rsqrt_ps(v); }); }
+	FORCE_INLINE static type rcp_refined  (type x) noexcept { return math::rcp_newton  <float, ComputeBackend, 1>(x, rcp(x)); }
+	FORCE_INLINE static type rsqrt_refined(type x) noexcept { return math::rsqrt_newton<float, ComputeBackend, 1>(x, rsqrt(x)); }
 	FORCE_INLINE static type add (type a, type b) noexcept { return _mm256_add_ps(a, b); }
 	FORCE_INLINE static type sub (type a, type b) noexcept { return _mm256_sub_ps(a, b); }
 	FORCE_INLINE static type mul (type a, type b) noexcept { return _mm256_mul_ps(a, b); }
@@ -32,6 +81,46 @@ struct ComputeBackend<float, SIMDLevel::AVX> {
 	FORCE_INLINE static type min (type a, type b) noexcept { return _mm256_min_ps(a, b); }
 	FORCE_INLINE static type max (type a, type b) noexcept { return _mm256_max_ps(a, b); }
 	FORCE_INLINE static type abs (type x)         noexcept { return _mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF))); }
+	FORCE_INLINE static type round(type x)        noexcept { return _mm256_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	FORCE_INLINE static type floor(type x)        noexcept { return _mm256_floor_ps(x); }
+
+	// Multiply-add primitives. There is no FMA at this level, so
+	// they are emulated and rounded twice: a * b, then the sum.
+	FORCE_INLINE static constexpr bool has_fma() noexcept { return false; }
+	FORCE_INLINE static type fma (type a, type b, type c) noexcept { return _mm256_add_ps(_mm256_mul_ps(a, b), c); } //   a * b + c
+	FORCE_INLINE static type fms (type a, type b, type c) noexcept { return _mm256_sub_ps(_mm256_mul_ps(a, b), c); } //   a * b - c
+	FORCE_INLINE static type fnma(type a, type b, type c) noexcept { return _mm256_sub_ps(c, _mm256_mul_ps(a, b)); } // -(a * b) + c
+
+	// Bitwise operations on the IEEE-754 representation
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm256_and_ps   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm256_or_ps    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm256_xor_ps   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm256_andnot_ps(a, b); } // ~a & b
+
+	// Exponent manipulation, for positive normal values x and for
+	// integral values n in the normal exponent range [-126 ; 127]
+	// NB: AVX has no 256-bit integer shifts, so exponent fields are
+	//     moved with exact conversions and products by 2^23 instead
+	FORCE_INLINE static type getexp (type x) noexcept { return _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_castps_si256(_mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000))))), _mm256_set1_ps(1.f / 8388608.f)), _mm256_set1_ps(127.f)); } // floor(log2(x))
+	FORCE_INLINE static type getmant(type x) noexcept { return _mm256_or_ps(_mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x007FFFFF))), _mm256_set1_ps(1.f)); } // In [1 ; 2[
+	FORCE_INLINE static type exp2i  (type n) noexcept { return _mm256_castsi256_ps(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_add_ps(n, _mm256_set1_ps(127.f)), _mm256_set1_ps(8388608.f)))); } // 2^n
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm256_blendv_ps(b, a, m); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return _mm256_and_ps(a, b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return _mm256_or_ps(a, b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return _mm256_xor_ps(m, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return static_cast<unsigned>(_mm256_movemask_ps(m)); }
+	FORCE_INLINE static bool any(mask m)              noexcept { return movemask(m) != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return movemask(m) == 0xFFu; }
 
 	FORCE_INLINE static type one()				  noexcept { return _mm256_set1_ps(1.f); }
 	FORCE_INLINE static type zero()				  noexcept { return _mm256_setzero_ps(); }
@@ -71,11 +160,130 @@ struct ComputeBackend<float, SIMDLevel::AVX> {
 	FORCE_INLINE static void unloadu(float* FORCE_RESTRICT ptr, type x) { _mm256_storeu_ps(ptr, x); } // Unaligned
 	FORCE_INLINE static void unloada(float* FORCE_RESTRICT ptr, type x) { _mm256_store_ps (ptr, x); } // Aligned
 
+	// Non-temporal store to aligned memory, bypassing the caches, for
+	// write-once outputs larger than the last level cache. Streamed
+	// stores are only ordered with the other ones after sfence().
+	FORCE_INLINE static void stream(float* FORCE_RESTRICT ptr, type x) noexcept { _mm256_stream_ps(ptr, x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+
+	// Fetches the cache line of ptr into every cache level
+	FORCE_INLINE static void prefetch(const float* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+
+	// Partial loads and stores of the first n < width() lanes, for
+	// array tails. Masked lanes are never accessed, so reading past
+	// the end of the array cannot fault; they are loaded as zeros.
+	FORCE_INLINE static __m256i tail_mask(size_t n) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(detail::tail_mask_epi32 + 8 - n)); }
+	FORCE_INLINE static type loadu_partial(const float* FORCE_RESTRICT ptr, size_t n) noexcept { return _mm256_maskload_ps(ptr, tail_mask(n)); }
+	FORCE_INLINE static void unloadu_partial(float* FORCE_RESTRICT ptr, type x, size_t n) noexcept { _mm256_maskstore_ps(ptr, tail_mask(n), x); }
+
+	// 16-bit storage (see half.hpp), widened to float and narrowed back
+	// rounding to nearest even. Halves are converted by F16C when it is
+	// enabled; otherwise, and for bfloat16 which needs integer shifts,
+	// each 128-bit half goes through the SSE4.1 conversions.
+	FORCE_INLINE static type loadu(const half* ptr) noexcept {
+	#if defined(VECTRA_HAS_F16C)
+		return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+	#else
+		using sse = ComputeBackend<float, SIMDLevel::SSE41>;
+		return _mm256_set_m128(sse::loadu(ptr + 4), sse::loadu(ptr));
+	#endif
+	}
+	FORCE_INLINE static void unloadu(half* ptr, type x) noexcept {
+	#if defined(VECTRA_HAS_F16C)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT));
+	#else
+		using sse = ComputeBackend<float, SIMDLevel::SSE41>;
+		sse::unloadu(ptr,     _mm256_castps256_ps128(x));
+		sse::unloadu(ptr + 4, _mm256_extractf128_ps(x, 1));
+	#endif
+	}
+	FORCE_INLINE static type loadu(const bfloat16* ptr) noexcept {
+		using sse = ComputeBackend<float, SIMDLevel::SSE41>;
+		return _mm256_set_m128(sse::loadu(ptr + 4), sse::loadu(ptr));
+	}
+	FORCE_INLINE static void unloadu(bfloat16* ptr, type x) noexcept {
+		using sse = ComputeBackend<float, SIMDLevel::SSE41>;
+		sse::unloadu(ptr,     _mm256_castps256_ps128(x));
+		sse::unloadu(ptr + 4, _mm256_extractf128_ps(x, 1));
+	}
+	FORCE_INLINE static type loadu_partial(const half*     ptr, size_t n) noexcept { return detail::loadPartial16<ComputeBackend>(ptr, n); }
+	FORCE_INLINE static type loadu_partial(const bfloat16* ptr, size_t n) noexcept { return detail::loadPartial16<ComputeBackend>(ptr, n); }
+	FORCE_INLINE static void unloadu_partial(half*     ptr, type x, size_t n) noexcept { detail::storePartial16<ComputeBackend>(ptr, x, n); }
+	FORCE_INLINE static void unloadu_partial(bfloat16* ptr, type x, size_t n) noexcept { detail::storePartial16<ComputeBackend>(ptr, x, n); }
+
+	// Interleaved records (a0 b0 a1 b1 ... for two components), one
+	// register of records per call, loaded as one register per
+	// component by deinterleaveN and stored back by interleaveN.
+	// AVX shuffles do not cross 128-bit lanes, so the records 0-3
+	// are loaded in the low lane and 4-7 in the high one, and both
+	// lanes then follow the SSE4.1 algorithm.
+	FORCE_INLINE static type load_lanes(const float* lo, const float* hi) noexcept {
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1);
+	}
+	FORCE_INLINE static void store_lanes(float* lo, float* hi, type x) noexcept {
+		_mm_storeu_ps(lo, _mm256_castps256_ps128(x));
+		_mm_storeu_ps(hi, _mm256_extractf128_ps(x, 1));
+	}
+	FORCE_INLINE static void transpose4(type& a, type& b, type& c, type& d) noexcept {
+		__m256 t0 = _mm256_unpacklo_ps(a, b), t1 = _mm256_unpacklo_ps(c, d);
+		__m256 t2 = _mm256_unpackhi_ps(a, b), t3 = _mm256_unpackhi_ps(c, d);
+		a = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t0), _mm256_castps_pd(t1)));
+		b = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t0), _mm256_castps_pd(t1)));
+		c = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t2), _mm256_castps_pd(t3)));
+		d = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t2), _mm256_castps_pd(t3)));
+	}
+	FORCE_INLINE static void deinterleave2(const float* ptr, type& a, type& b) noexcept {
+		__m256 v0 = load_lanes(ptr, ptr + 8), v1 = load_lanes(ptr + 4, ptr + 12);
+		a = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+		b = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+	}
+	FORCE_INLINE static void deinterleave3(const float* ptr, type& a, type& b, type& c) noexcept {
+		__m256 v0 = load_lanes(ptr, ptr + 12), v1 = load_lanes(ptr + 4, ptr + 16), v2 = load_lanes(ptr + 8, ptr + 20);
+		__m256 ta = _mm256_blend_ps(_mm256_blend_ps(v0, v1, 0x44), v2, 0x22);
+		__m256 tb = _mm256_blend_ps(_mm256_blend_ps(v0, v1, 0x99), v2, 0x44);
+		__m256 tc = _mm256_blend_ps(_mm256_blend_ps(v0, v1, 0x22), v2, 0x99);
+		a = _mm256_shuffle_ps(ta, ta, _MM_SHUFFLE(1, 2, 3, 0));
+		b = _mm256_shuffle_ps(tb, tb, _MM_SHUFFLE(2, 3, 0, 1));
+		c = _mm256_shuffle_ps(tc, tc, _MM_SHUFFLE(3, 0, 1, 2));
+	}
+	FORCE_INLINE static void deinterleave4(const float* ptr, type& a, type& b, type& c, type& d) noexcept {
+		a = load_lanes(ptr, ptr + 16); b = load_lanes(ptr + 4, ptr + 20); c = load_lanes(ptr + 8, ptr + 24); d = load_lanes(ptr + 12, ptr + 28);
+		transpose4(a, b, c, d);
+	}
+	FORCE_INLINE static void interleave2(float* ptr, type a, type b) noexcept {
+		store_lanes(ptr,     ptr + 8,  _mm256_unpacklo_ps(a, b));
+		store_lanes(ptr + 4, ptr + 12, _mm256_unpackhi_ps(a, b));
+	}
+	FORCE_INLINE static void interleave3(float* ptr, type a, type b, type c) noexcept {
+		__m256 ta = _mm256_shuffle_ps(a, a, _MM_SHUFFLE(1, 2, 3, 0));
+		__m256 tb = _mm256_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1));
+		__m256 tc = _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 1, 2));
+		store_lanes(ptr,     ptr + 12, _mm256_blend_ps(_mm256_blend_ps(ta, tb, 0x22), tc, 0x44));
+		store_lanes(ptr + 4, ptr + 16, _mm256_blend_ps(_mm256_blend_ps(tb, tc, 0x22), ta, 0x44));
+		store_lanes(ptr + 8, ptr + 20, _mm256_blend_ps(_mm256_blend_ps(tc, ta, 0x22), tb, 0x44));
+	}
+	FORCE_INLINE static void interleave4(float* ptr, type a, type b, type c, type d) noexcept {
+		transpose4(a, b, c, d);
+		store_lanes(ptr, ptr + 16, a); store_lanes(ptr + 4, ptr + 20, b); store_lanes(ptr + 8, ptr + 24, c); store_lanes(ptr + 12, ptr + 28, d);
+	}
+
+	// Indexed accesses, lane i being base[idx[i]]. There are no gather
+	// nor scatter instructions: lanes are moved one by one.
+	FORCE_INLINE static type gather(const float* base, index idx) noexcept { return detail::gatherLanes<ComputeBackend>(base, idx); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const float* base, index idx) noexcept { return detail::maskGatherLanes<ComputeBackend>(src, m, base, idx); }
+	FORCE_INLINE static void scatter(float* base, index idx, type x) noexcept { detail::scatterLanes<ComputeBackend>(base, idx, x); }
+	FORCE_INLINE static void mask_scatter(float* base, mask m, index idx, type x) noexcept { detail::maskScatterLanes<ComputeBackend>(base, m, idx, x); }
 };
 
 template <>
 struct ComputeBackend<double, SIMDLevel::AVX> {
 	using type = __m256d;
+	using mask = __m256d; // All bits set in the lanes where true
+	using index = __m256i; // Indices of gather() and scatter(), int64_t lanes
+	// SVML provides vectorized transcendental functions, but it
+	// is only shipped with MSVC and the Intel compilers. Unless
+	// VECTRA_USE_SVML is defined, we rely on in-house kernels.
+	#ifdef VECTRA_USE_SVML
 	FORCE_INLINE static type sin (type x)		  noexcept { return _mm256_sin_pd(x); }
 	FORCE_INLINE static type cos (type x)		  noexcept { return _mm256_cos_pd(x); }
 	// Since our approximation of arccos is not defined only over
@@ -85,16 +293,99 @@ struct ComputeBackend<double, SIMDLevel::AVX> {
 	#else
 	FORCE_INLINE static type acos(type x)		  noexcept { return _mm256_acos_pd(_mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(-1.0)), _mm256_set1_pd(1.0))); }
 	#endif
-	FORCE_INLINE static type sqrt(type x)		  noexcept { return _mm256_sqrt_pd(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return _mm256_asin_pd(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return _mm256_atan_pd(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return _mm256_atan2_pd(y, x); }
 	FORCE_INLINE static type cbrt(type x)		  noexcept { return _mm256_cbrt_pd(x); }
 	FORCE_INLINE static type exp (type x)		  noexcept { return _mm256_exp_pd(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return _mm256_exp2_pd(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return _mm256_expm1_pd(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return _mm256_log_pd(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return _mm256_log2_pd(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return _mm256_log1p_pd(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return _mm256_pow_pd(a, b); }
+	#else
+	FORCE_INLINE static type sin (type x)		  noexcept { return math::sin<double, ComputeBackend>(x); }
+	FORCE_INLINE static type cos (type x)		  noexcept { return math::cos<double, ComputeBackend>(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return math::asin <double, ComputeBackend>(x); }
+	FORCE_INLINE static type acos(type x)		  noexcept { return math::acos <double, ComputeBackend>(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return math::atan <double, ComputeBackend>(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return math::atan2<double, ComputeBackend>(y, x); }
+	FORCE_INLINE static type cbrt(type x)		  noexcept { return math::cbrt <double, ComputeBackend>(x); }
+	FORCE_INLINE static type exp (type x)		  noexcept { return math::exp  <double, ComputeBackend>(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return math::exp2 <double, ComputeBackend>(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return math::expm1<double, ComputeBackend>(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return math::log  <double, ComputeBackend>(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return math::log2 <double, ComputeBackend>(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return math::log1p<double, ComputeBackend>(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return math::pow  <double, ComputeBackend>(a, b); }
+	#endif
+	FORCE_INLINE static type sqrt(type x)		  noexcept { return _mm256_sqrt_pd(x); }
+
+	// Estimates seeded in float on the significand (see math/reciprocal.hpp),
+	// refined by three Newton steps (12, 24 then 48 bits and beyond)
+	FORCE_INLINE static type rcp  (type x) noexcept { return math::rcp_estimate  <double, ComputeBackend>(x, [](type m) { return _mm256_cvtps_pd(_mm_rcp_ps(_mm256_cvtpd_ps(m))); }); }
+	FORCE_INLINE static type rsqrt(type x) noexcept { return math::rsqrt_estimate<double, ComputeBackend>(x, [](type m) { return _mm256_cvtps_pd(_mm_rsqrt_ps(_mm256_cvtpd_ps(m))); }); }
+	FORCE_INLINE static type rcp_refined  (type x) noexcept { return math::rcp_newton  <double, ComputeBackend, 3>(x, rcp(x)); }
+	FORCE_INLINE static type rsqrt_refined(type x) noexcept { return math::rsqrt_newton<double, ComputeBackend, 3>(x, rsqrt(x)); }
 	FORCE_INLINE static type add (type a, type b) noexcept { return _mm256_add_pd(a, b); }
 	FORCE_INLINE static type sub (type a, type b) noexcept { return _mm256_sub_pd(a, b); }
 	FORCE_INLINE static type mul (type a, type b) noexcept { return _mm256_mul_pd(a, b); }
 	FORCE_INLINE static type div (type a, type b) noexcept { return _mm256_div_pd(a, b); }
 	FORCE_INLINE static type min (type a, type b) noexcept { return _mm256_min_pd(a, b); }
 	FORCE_INLINE static type max (type a, type b) noexcept { return _mm256_max_pd(a, b); }
-	FORCE_INLINE static type abs (type x)         noexcept { return _mm256_and_pd(x, _mm256_castsi256_pd(_mm256_set1_epi32(0x7FFFFFFF))); }
+	FORCE_INLINE static type abs (type x)         noexcept { return _mm256_and_pd(x, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF))); }
+	FORCE_INLINE static type round(type x)        noexcept { return _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	FORCE_INLINE static type floor(type x)        noexcept { return _mm256_floor_pd(x); }
+
+	// Multiply-add primitives. There is no FMA at this level, so
+	// they are emulated and rounded twice: a * b, then the sum.
+	FORCE_INLINE static constexpr bool has_fma() noexcept { return false; }
+	FORCE_INLINE static type fma (type a, type b, type c) noexcept { return _mm256_add_pd(_mm256_mul_pd(a, b), c); } //   a * b + c
+	FORCE_INLINE static type fms (type a, type b, type c) noexcept { return _mm256_sub_pd(_mm256_mul_pd(a, b), c); } //   a * b - c
+	FORCE_INLINE static type fnma(type a, type b, type c) noexcept { return _mm256_sub_pd(c, _mm256_mul_pd(a, b)); } // -(a * b) + c
+
+	// Bitwise operations on the IEEE-754 representation
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm256_and_pd   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm256_or_pd    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm256_xor_pd   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm256_andnot_pd(a, b); } // ~a & b
+
+	// Exponent manipulation, for positive normal values x and for
+	// integral values n in the normal exponent range [-1022 ; 1023]
+	// NB: AVX has no 256-bit integer shifts. Exponents fit in the
+	//     upper 32-bit word of each lane, which are packed into one
+	//     128-bit register to be processed with SSE integer ops.
+	FORCE_INLINE static type getexp (type x) noexcept {
+		__m256  xs = _mm256_castpd_ps(x);
+		__m128i hi = _mm_castps_si128(_mm_shuffle_ps(_mm256_castps256_ps128(xs), _mm256_extractf128_ps(xs, 1), _MM_SHUFFLE(3, 1, 3, 1)));
+		__m128i e  = _mm_sub_epi32(_mm_srli_epi32(_mm_and_si128(hi, _mm_set1_epi32(0x7FF00000)), 20), _mm_set1_epi32(1023));
+		return _mm256_cvtepi32_pd(e); // floor(log2(x))
+	}
+	FORCE_INLINE static type getmant(type x) noexcept { return _mm256_or_pd(_mm256_and_pd(x, _mm256_castsi256_pd(_mm256_set1_epi64x(0x000FFFFFFFFFFFFF))), _mm256_set1_pd(1.0)); } // In [1 ; 2[
+	FORCE_INLINE static type exp2i  (type n) noexcept {
+		__m128i e  = _mm_slli_epi32(_mm_add_epi32(_mm256_cvtpd_epi32(n), _mm_set1_epi32(1023)), 20);
+		__m128i lo = _mm_unpacklo_epi32(_mm_setzero_si128(), e);
+		__m128i hi = _mm_unpackhi_epi32(_mm_setzero_si128(), e);
+		return _mm256_castsi256_pd(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1)); // 2^n
+	}
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm256_blendv_pd(b, a, m); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return _mm256_and_pd(a, b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return _mm256_or_pd(a, b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return _mm256_xor_pd(m, _mm256_castsi256_pd(_mm256_set1_epi32(-1))); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return static_cast<unsigned>(_mm256_movemask_pd(m)); }
+	FORCE_INLINE static bool any(mask m)              noexcept { return movemask(m) != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return movemask(m) == 0xFu; }
 
 	FORCE_INLINE static type one()				  noexcept { return _mm256_set1_pd(1.0); }
 	FORCE_INLINE static type zero()				  noexcept { return _mm256_setzero_pd(); }
@@ -134,6 +425,259 @@ struct ComputeBackend<double, SIMDLevel::AVX> {
 	FORCE_INLINE static void unloadu(double* FORCE_RESTRICT ptr, type x) { _mm256_storeu_pd(ptr, x); } // Unaligned
 	FORCE_INLINE static void unloada(double* FORCE_RESTRICT ptr, type x) { _mm256_store_pd (ptr, x); } // Aligned
 
+	// Non-temporal store to aligned memory, bypassing the caches, for
+	// write-once outputs larger than the last level cache. Streamed
+	// stores are only ordered with the other ones after sfence().
+	FORCE_INLINE static void stream(double* FORCE_RESTRICT ptr, type x) noexcept { _mm256_stream_pd(ptr, x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+
+	// Fetches the cache line of ptr into every cache level
+	FORCE_INLINE static void prefetch(const double* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+
+	// Partial loads and stores of the first n < width() lanes, for
+	// array tails. Masked lanes are never accessed, so reading past
+	// the end of the array cannot fault; they are loaded as zeros.
+	FORCE_INLINE static __m256i tail_mask(size_t n) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(detail::tail_mask_epi64 + 4 - n)); }
+	FORCE_INLINE static type loadu_partial(const double* FORCE_RESTRICT ptr, size_t n) noexcept { return _mm256_maskload_pd(ptr, tail_mask(n)); }
+	FORCE_INLINE static void unloadu_partial(double* FORCE_RESTRICT ptr, type x, size_t n) noexcept { _mm256_maskstore_pd(ptr, tail_mask(n), x); }
+
+	// Interleaved records (a0 b0 a1 b1 ... for two components), one
+	// register of records per call, loaded as one register per
+	// component by deinterleaveN and stored back by interleaveN.
+	// Records 0-1 are loaded in the low 128-bit lane and 2-3 in the
+	// high one, then both lanes follow the SSE4.1 algorithm.
+	FORCE_INLINE static type load_lanes(const double* lo, const double* hi) noexcept {
+		return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(lo)), _mm_loadu_pd(hi), 1);
+	}
+	FORCE_INLINE static void store_lanes(double* lo, double* hi, type x) noexcept {
+		_mm_storeu_pd(lo, _mm256_castpd256_pd128(x));
+		_mm_storeu_pd(hi, _mm256_extractf128_pd(x, 1));
+	}
+	FORCE_INLINE static void deinterleave2(const double* ptr, type& a, type& b) noexcept {
+		__m256d v0 = load_lanes(ptr, ptr + 4), v1 = load_lanes(ptr + 2, ptr + 6);
+		a = _mm256_unpacklo_pd(v0, v1);
+		b = _mm256_unpackhi_pd(v0, v1);
+	}
+	FORCE_INLINE static void deinterleave3(const double* ptr, type& a, type& b, type& c) noexcept {
+		__m256d v0 = load_lanes(ptr, ptr + 6), v1 = load_lanes(ptr + 2, ptr + 8), v2 = load_lanes(ptr + 4, ptr + 10);
+		a = _mm256_blend_pd(v0, v1, 0xA);
+		b = _mm256_shuffle_pd(v0, v2, 0x5);
+		c = _mm256_blend_pd(v1, v2, 0xA);
+	}
+	FORCE_INLINE static void deinterleave4(const double* ptr, type& a, type& b, type& c, type& d) noexcept {
+		__m256d v0 = load_lanes(ptr, ptr + 8), v1 = load_lanes(ptr + 2, ptr + 10), v2 = load_lanes(ptr + 4, ptr + 12), v3 = load_lanes(ptr + 6, ptr + 14);
+		a = _mm256_unpacklo_pd(v0, v2); b = _mm256_unpackhi_pd(v0, v2);
+		c = _mm256_unpacklo_pd(v1, v3); d = _mm256_unpackhi_pd(v1, v3);
+	}
+	FORCE_INLINE static void interleave2(double* ptr, type a, type b) noexcept {
+		store_lanes(ptr,     ptr + 4, _mm256_unpacklo_pd(a, b));
+		store_lanes(ptr + 2, ptr + 6, _mm256_unpackhi_pd(a, b));
+	}
+	FORCE_INLINE static void interleave3(double* ptr, type a, type b, type c) noexcept {
+		store_lanes(ptr,     ptr + 6,  _mm256_unpacklo_pd(a, b));
+		store_lanes(ptr + 2, ptr + 8,  _mm256_blend_pd(c, a, 0xA));
+		store_lanes(ptr + 4, ptr + 10, _mm256_unpackhi_pd(b, c));
+	}
+	FORCE_INLINE static void interleave4(double* ptr, type a, type b, type c, type d) noexcept {
+		store_lanes(ptr,     ptr + 8,  _mm256_unpacklo_pd(a, b)); store_lanes(ptr + 2, ptr + 10, _mm256_unpacklo_pd(c, d));
+		store_lanes(ptr + 4, ptr + 12, _mm256_unpackhi_pd(a, b)); store_lanes(ptr + 6, ptr + 14, _mm256_unpackhi_pd(c, d));
+	}
+
+	// Indexed accesses, lane i being base[idx[i]]. There are no gather
+	// nor scatter instructions: lanes are moved one by one.
+	FORCE_INLINE static type gather(const double* base, index idx) noexcept { return detail::gatherLanes<ComputeBackend>(base, idx); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const double* base, index idx) noexcept { return detail::maskGatherLanes<ComputeBackend>(src, m, base, idx); }
+	FORCE_INLINE static void scatter(double* base, index idx, type x) noexcept { detail::scatterLanes<ComputeBackend>(base, idx, x); }
+	FORCE_INLINE static void mask_scatter(double* base, mask m, index idx, type x) noexcept { detail::maskScatterLanes<ComputeBackend>(base, m, idx, x); }
+};
+
+// Integer lanes, see the scalar backend for their semantics. AVX has
+// no 256-bit integer arithmetic: the two 128-bit halves go through the
+// SSE4.1 backend, bitwise operations and memory accesses are native.
+template <>
+struct ComputeBackend<std::int32_t, SIMDLevel::AVX> {
+	using type     = __m256i;
+	using mask     = __m256i; // All bits set in the lanes where true
+	using index    = __m256i; // Indices of gather() and scatter(), int32_t lanes
+	using floating = __m256;
+	using half_backend = ComputeBackend<std::int32_t, SIMDLevel::SSE41>;
+
+	// Applies f to the 128-bit halves of the arguments
+	template <typename F>
+	FORCE_INLINE static type halves(type x, F f) noexcept { return _mm256_setr_m128i(f(_mm256_castsi256_si128(x)), f(_mm256_extractf128_si256(x, 1))); }
+	template <typename F>
+	FORCE_INLINE static type halves(type a, type b, F f) noexcept {
+		return _mm256_setr_m128i(f(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b)), f(_mm256_extractf128_si256(a, 1), _mm256_extractf128_si256(b, 1)));
+	}
+
+	FORCE_INLINE static type add(type a, type b) noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::add(x, y); }); }
+	FORCE_INLINE static type sub(type a, type b) noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::sub(x, y); }); }
+	FORCE_INLINE static type mul(type a, type b) noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::mul(x, y); }); }
+	FORCE_INLINE static type min(type a, type b) noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::min(x, y); }); }
+	FORCE_INLINE static type max(type a, type b) noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::max(x, y); }); }
+	FORCE_INLINE static type abs(type x)         noexcept { return halves(x,    [](__m128i y)            { return half_backend::abs(y); }); }
+
+	// Shifts by n in [0 ; 32[, shr() being arithmetic
+	FORCE_INLINE static type shl        (type x, int n) noexcept { return halves(x, [n](__m128i y) { return half_backend::shl        (y, n); }); }
+	FORCE_INLINE static type shr        (type x, int n) noexcept { return halves(x, [n](__m128i y) { return half_backend::shr        (y, n); }); }
+	FORCE_INLINE static type shr_logical(type x, int n) noexcept { return halves(x, [n](__m128i y) { return half_backend::shr_logical(y, n); }); }
+
+	// Bitwise operations, in the floating-point domain
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm256_castps_si256(_mm256_and_ps   (_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm256_castps_si256(_mm256_or_ps    (_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm256_castps_si256(_mm256_xor_ps   (_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm256_castps_si256(_mm256_andnot_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); } // ~a & b
+	FORCE_INLINE static type bit_not   (type x)         noexcept { return bit_xor(x, _mm256_set1_epi32(-1)); }
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::cmpeq(x, y); }); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::cmpgt(x, y); }); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return cmpgt(b, a); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return mask_not(cmpgt(a, b)); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return mask_not(cmpeq(a, b)); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return mask_not(cmpgt(b, a)); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(b), _mm256_castsi256_ps(a), _mm256_castsi256_ps(m))); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return bit_and(a, b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return bit_or(a, b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return bit_not(m); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(m))); }
+	FORCE_INLINE static bool any(mask m)              noexcept { return movemask(m) != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return movemask(m) == 0xFFu; }
+
+	FORCE_INLINE static type one()  noexcept { return _mm256_set1_epi32(1); }
+	FORCE_INLINE static type zero() noexcept { return _mm256_setzero_si256(); }
+	FORCE_INLINE static type set(std::int32_t x) noexcept { return _mm256_set1_epi32(x); }
+
+	// Wrapping sum of the lanes
+	FORCE_INLINE static std::int32_t hsum(type x) noexcept { return half_backend::hsum(half_backend::add(_mm256_castsi256_si128(x), _mm256_extractf128_si256(x, 1))); }
+
+	FORCE_INLINE static constexpr size_t width() noexcept { return 8; }
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Memory operations, see the float backend
+	FORCE_INLINE static type loadu(const std::int32_t* FORCE_RESTRICT ptr) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); }
+	FORCE_INLINE static type loada(const std::int32_t* FORCE_RESTRICT ptr) noexcept { return _mm256_load_si256 (reinterpret_cast<const __m256i*>(ptr)); }
+	FORCE_INLINE static void unloadu(std::int32_t* FORCE_RESTRICT ptr, type x) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), x); }
+	FORCE_INLINE static void unloada(std::int32_t* FORCE_RESTRICT ptr, type x) noexcept { _mm256_store_si256 (reinterpret_cast<__m256i*>(ptr), x); }
+	FORCE_INLINE static void stream (std::int32_t* FORCE_RESTRICT ptr, type x) noexcept { _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+	FORCE_INLINE static void prefetch(const std::int32_t* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+	FORCE_INLINE static type loadu_partial(const std::int32_t* FORCE_RESTRICT ptr, size_t n) noexcept {
+		return _mm256_castps_si256(_mm256_maskload_ps(reinterpret_cast<const float*>(ptr), ComputeBackend<float, SIMDLevel::AVX>::tail_mask(n)));
+	}
+	FORCE_INLINE static void unloadu_partial(std::int32_t* FORCE_RESTRICT ptr, type x, size_t n) noexcept {
+		_mm256_maskstore_ps(reinterpret_cast<float*>(ptr), ComputeBackend<float, SIMDLevel::AVX>::tail_mask(n), _mm256_castsi256_ps(x));
+	}
+
+	// Conversions with float lanes
+	FORCE_INLINE static type from_float      (floating x) noexcept { return _mm256_cvtps_epi32 (x); }
+	FORCE_INLINE static type from_float_trunc(floating x) noexcept { return _mm256_cvttps_epi32(x); }
+	FORCE_INLINE static floating to_float(type x) noexcept { return _mm256_cvtepi32_ps(x); }
+
+	// Indexed accesses, lane i being base[idx[i]]. There are no gather
+	// nor scatter instructions: lanes are moved one by one.
+	FORCE_INLINE static type gather(const std::int32_t* base, index idx) noexcept { return detail::gatherLanes<ComputeBackend>(base, idx); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const std::int32_t* base, index idx) noexcept { return detail::maskGatherLanes<ComputeBackend>(src, m, base, idx); }
+	FORCE_INLINE static void scatter(std::int32_t* base, index idx, type x) noexcept { detail::scatterLanes<ComputeBackend>(base, idx, x); }
+	FORCE_INLINE static void mask_scatter(std::int32_t* base, mask m, index idx, type x) noexcept { detail::maskScatterLanes<ComputeBackend>(base, m, idx, x); }
+};
+
+template <>
+struct ComputeBackend<std::int64_t, SIMDLevel::AVX> {
+	using type     = __m256i;
+	using mask     = __m256i; // All bits set in the lanes where true
+	using index    = __m256i; // Indices of gather() and scatter(), int64_t lanes
+	using floating = __m256d;
+	using half_backend = ComputeBackend<std::int64_t, SIMDLevel::SSE41>;
+
+	// Applies f to the 128-bit halves of the arguments
+	template <typename F>
+	FORCE_INLINE static type halves(type x, F f) noexcept { return _mm256_setr_m128i(f(_mm256_castsi256_si128(x)), f(_mm256_extractf128_si256(x, 1))); }
+	template <typename F>
+	FORCE_INLINE static type halves(type a, type b, F f) noexcept {
+		return _mm256_setr_m128i(f(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b)), f(_mm256_extractf128_si256(a, 1), _mm256_extractf128_si256(b, 1)));
+	}
+
+	FORCE_INLINE static type add(type a, type b) noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::add(x, y); }); }
+	FORCE_INLINE static type sub(type a, type b) noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::sub(x, y); }); }
+	FORCE_INLINE static type mul(type a, type b) noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::mul(x, y); }); }
+	FORCE_INLINE static type min(type a, type b) noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::min(x, y); }); }
+	FORCE_INLINE static type max(type a, type b) noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::max(x, y); }); }
+	FORCE_INLINE static type abs(type x)         noexcept { return halves(x,    [](__m128i y)            { return half_backend::abs(y); }); }
+
+	// Shifts by n in [0 ; 64[, shr() being arithmetic
+	FORCE_INLINE static type shl        (type x, int n) noexcept { return halves(x, [n](__m128i y) { return half_backend::shl        (y, n); }); }
+	FORCE_INLINE static type shr        (type x, int n) noexcept { return halves(x, [n](__m128i y) { return half_backend::shr        (y, n); }); }
+	FORCE_INLINE static type shr_logical(type x, int n) noexcept { return halves(x, [n](__m128i y) { return half_backend::shr_logical(y, n); }); }
+
+	// Bitwise operations, in the floating-point domain
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm256_castps_si256(_mm256_and_ps   (_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm256_castps_si256(_mm256_or_ps    (_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm256_castps_si256(_mm256_xor_ps   (_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm256_castps_si256(_mm256_andnot_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); } // ~a & b
+	FORCE_INLINE static type bit_not   (type x)         noexcept { return bit_xor(x, _mm256_set1_epi32(-1)); }
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::cmpeq(x, y); }); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return halves(a, b, [](__m128i x, __m128i y) { return half_backend::cmpgt(x, y); }); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return cmpgt(b, a); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return mask_not(cmpgt(a, b)); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return mask_not(cmpeq(a, b)); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return mask_not(cmpgt(b, a)); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(b), _mm256_castsi256_ps(a), _mm256_castsi256_ps(m))); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return bit_and(a, b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return bit_or(a, b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return bit_not(m); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(m))); }
+	FORCE_INLINE static bool any(mask m)              noexcept { return movemask(m) != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return movemask(m) == 0xFu; }
+
+	FORCE_INLINE static type one()  noexcept { return _mm256_set1_epi64x(1); }
+	FORCE_INLINE static type zero() noexcept { return _mm256_setzero_si256(); }
+	FORCE_INLINE static type set(std::int64_t x) noexcept { return _mm256_set1_epi64x(x); }
+
+	// Wrapping sum of the lanes
+	FORCE_INLINE static std::int64_t hsum(type x) noexcept { return half_backend::hsum(half_backend::add(_mm256_castsi256_si128(x), _mm256_extractf128_si256(x, 1))); }
+
+	FORCE_INLINE static constexpr size_t width() noexcept { return 4; }
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Memory operations, see the float backend
+	FORCE_INLINE static type loadu(const std::int64_t* FORCE_RESTRICT ptr) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); }
+	FORCE_INLINE static type loada(const std::int64_t* FORCE_RESTRICT ptr) noexcept { return _mm256_load_si256 (reinterpret_cast<const __m256i*>(ptr)); }
+	FORCE_INLINE static void unloadu(std::int64_t* FORCE_RESTRICT ptr, type x) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), x); }
+	FORCE_INLINE static void unloada(std::int64_t* FORCE_RESTRICT ptr, type x) noexcept { _mm256_store_si256 (reinterpret_cast<__m256i*>(ptr), x); }
+	FORCE_INLINE static void stream (std::int64_t* FORCE_RESTRICT ptr, type x) noexcept { _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+	FORCE_INLINE static void prefetch(const std::int64_t* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+	FORCE_INLINE static type loadu_partial(const std::int64_t* FORCE_RESTRICT ptr, size_t n) noexcept {
+		return _mm256_castpd_si256(_mm256_maskload_pd(reinterpret_cast<const double*>(ptr), ComputeBackend<double, SIMDLevel::AVX>::tail_mask(n)));
+	}
+	FORCE_INLINE static void unloadu_partial(std::int64_t* FORCE_RESTRICT ptr, type x, size_t n) noexcept {
+		_mm256_maskstore_pd(reinterpret_cast<double*>(ptr), ComputeBackend<double, SIMDLevel::AVX>::tail_mask(n), _mm256_castsi256_pd(x));
+	}
+
+	// Conversions with double lanes, by halves (see the SSE4.1 backend)
+	FORCE_INLINE static type from_float(floating x) noexcept {
+		return _mm256_setr_m128i(half_backend::from_float(_mm256_castpd256_pd128(x)), half_backend::from_float(_mm256_extractf128_pd(x, 1)));
+	}
+	FORCE_INLINE static type from_float_trunc(floating x) noexcept {
+		return _mm256_setr_m128i(half_backend::from_float_trunc(_mm256_castpd256_pd128(x)), half_backend::from_float_trunc(_mm256_extractf128_pd(x, 1)));
+	}
+	FORCE_INLINE static floating to_float(type x) noexcept {
+		return _mm256_setr_m128d(half_backend::to_float(_mm256_castsi256_si128(x)), half_backend::to_float(_mm256_extractf128_si256(x, 1)));
+	}
+
+	// Indexed accesses, lane i being base[idx[i]]. There are no gather
+	// nor scatter instructions: lanes are moved one by one.
+	FORCE_INLINE static type gather(const std::int64_t* base, index idx) noexcept { return detail::gatherLanes<ComputeBackend>(base, idx); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const std::int64_t* base, index idx) noexcept { return detail::maskGatherLanes<ComputeBackend>(src, m, base, idx); }
+	FORCE_INLINE static void scatter(std::int64_t* base, index idx, type x) noexcept { detail::scatterLanes<ComputeBackend>(base, idx, x); }
+	FORCE_INLINE static void mask_scatter(std::int64_t* base, mask m, index idx, type x) noexcept { detail::maskScatterLanes<ComputeBackend>(base, m, idx, x); }
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,594 @@
+#pragma once
+
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include <vectra/core/simd_level.hpp>
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/constants.hpp>
+#include <vectra/core/half.hpp>
+#include <vectra/detail/gather.hpp>
+#include <vectra/detail/tail_mask.hpp>
+#include <vectra/math/exponential.hpp>
+#include <vectra/math/inverse_trigonometric.hpp>
+#include <vectra/math/logarithmic.hpp>
+#include <vectra/math/power.hpp>
+#include <vectra/math/reciprocal.hpp>
+#include <vectra/math/trigonometric.hpp>
+
+
+namespace vectra
+{
+
+template <>
+struct ComputeBackend<float, SIMDLevel::AVX2> {
+	using type = __m256;
+	using mask = __m256; // All bits set in the lanes where true
+	using index = __m256i; // Indices of gather() and scatter(), int32_t lanes
+	// SVML provides vectorized transcendental functions, but it
+	// is only shipped with MSVC and the Intel compilers. Unless
+	// VECTRA_USE_SVML is defined, we rely on in-house kernels.
+	#ifdef VECTRA_USE_SVML
+	FORCE_INLINE static type sin (type x)		  noexcept { return _mm256_sin_ps(x); }
+	FORCE_INLINE static type cos (type x)		  noexcept { return _mm256_cos_ps(x); }
+	// Since our approximation of arccos is not defined only over
+	// [-1 ; 1], we can then avoid the cost of clamping argument.
+	#ifndef HAS_MM_ACOS_PS
+	FORCE_INLINE static type acos(type x)		  noexcept { return _mm256_acos_ps(x); }
+	#else
+	FORCE_INLINE static type acos(type x)		  noexcept { return _mm256_acos_ps(_mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-1.f)), _mm256_set1_ps(1.f))); }
+	#endif
+	FORCE_INLINE static type asin(type x)		  noexcept { return _mm256_asin_ps(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return _mm256_atan_ps(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return _mm256_atan2_ps(y, x); }
+	FORCE_INLINE static type cbrt(type x)		  noexcept { return _mm256_cbrt_ps(x); }
+	FORCE_INLINE static type exp (type x)		  noexcept { return _mm256_exp_ps(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return _mm256_exp2_ps(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return _mm256_expm1_ps(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return _mm256_log_ps(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return _mm256_log2_ps(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return _mm256_log1p_ps(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return _mm256_pow_ps(a, b); }
+	#else
+	FORCE_INLINE static type sin (type x)		  noexcept { return math::sin<float, ComputeBackend>(x); }
+	FORCE_INLINE static type cos (type x)		  noexcept { return math::cos<float, ComputeBackend>(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return math::asin <float, ComputeBackend>(x); }
+	FORCE_INLINE static type acos(type x)		  noexcept { return math::acos <float, ComputeBackend>(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return math::atan <float, ComputeBackend>(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return math::atan2<float, ComputeBackend>(y, x); }
+	FORCE_INLINE static type cbrt(type x)		  noexcept { return math::cbrt <float, ComputeBackend>(x); }
+	FORCE_INLINE static type exp (type x)		  noexcept { return math::exp  <float, ComputeBackend>(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return math::exp2 <float, ComputeBackend>(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return math::expm1<float, ComputeBackend>(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return math::log  <float, ComputeBackend>(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return math::log2 <float, ComputeBackend>(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return math::log1p<float, ComputeBackend>(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return math::pow  <float, ComputeBackend>(a, b); }
+	#endif
+	FORCE_INLINE static type sqrt(type x)		  noexcept { return _mm256_sqrt_ps(x); }
+
+	// Estimates of 1/x and 1/sqrt(x), relative error below 1.5 * 2^-12,
+	// refined by one Newton step to a few ULP (see math/reciprocal.hpp)
+	FORCE_INLINE static type rcp  (type x) noexcept { return math::rcp_estimate  <float, ComputeBackend>(x, [](type v) { return _mm256_rcp_ps(v); }); }
+	FORCE_INLINE static type rsqrt(type x) noexcept { return math::rsqrt_estimate<float, ComputeBackend>(x, [](type v) { return _mm256_rsqrt_ps(v); }); }
+	FORCE_INLINE static type rcp_refined  (type x) noexcept { return math::rcp_newton  <float, ComputeBackend, 1>(x, rcp(x)); }
+	FORCE_INLINE static type rsqrt_refined(type x) noexcept { return math::rsqrt_newton<float, ComputeBackend, 1>(x, rsqrt(x)); }
+	FORCE_INLINE static type add (type a, type b) noexcept { return _mm256_add_ps(a, b); }
+	FORCE_INLINE static type sub (type a, type b) noexcept { return _mm256_sub_ps(a, b); }
+	FORCE_INLINE static type mul (type a, type b) noexcept { return _mm256_mul_ps(a, b); }
+	FORCE_INLINE static type div (type a, type b) noexcept { return _mm256_div_ps(a, b); }
+	FORCE_INLINE static type min (type a, type b) noexcept { return _mm256_min_ps(a, b); }
+	FORCE_INLINE static type max (type a, type b) noexcept { return _mm256_max_ps(a, b); }
+	FORCE_INLINE static type abs (type x)         noexcept { return _mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF))); }
+	FORCE_INLINE static type round(type x)        noexcept { return _mm256_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	FORCE_INLINE static type floor(type x)        noexcept { return _mm256_floor_ps(x); }
+
+	// Fused multiply-add primitives, rounded only once
+	FORCE_INLINE static constexpr bool has_fma() noexcept { return true; }
+	FORCE_INLINE static type fma (type a, type b, type c) noexcept { return _mm256_fmadd_ps (a, b, c); } //   a * b + c
+	FORCE_INLINE static type fms (type a, type b, type c) noexcept { return _mm256_fmsub_ps (a, b, c); } //   a * b - c
+	FORCE_INLINE static type fnma(type a, type b, type c) noexcept { return _mm256_fnmadd_ps(a, b, c); } // -(a * b) + c
+
+	// Bitwise operations on the IEEE-754 representation
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm256_and_ps   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm256_or_ps    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm256_xor_ps   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm256_andnot_ps(a, b); } // ~a & b
+
+	// Exponent manipulation, for positive normal values x and for
+	// integral values n in the normal exponent range [-126 ; 127]
+	FORCE_INLINE static type getexp (type x) noexcept { return _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(_mm256_and_si256(_mm256_castps_si256(x), _mm256_set1_epi32(0x7F800000)), 23), _mm256_set1_epi32(127))); } // floor(log2(x))
+	FORCE_INLINE static type getmant(type x) noexcept { return _mm256_or_ps(_mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x007FFFFF))), _mm256_set1_ps(1.f)); } // In [1 ; 2[
+	FORCE_INLINE static type exp2i  (type n) noexcept { return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23)); } // 2^n
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm256_blendv_ps(b, a, m); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return _mm256_and_ps(a, b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return _mm256_or_ps(a, b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return _mm256_xor_ps(m, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return static_cast<unsigned>(_mm256_movemask_ps(m)); }
+	FORCE_INLINE static bool any(mask m)              noexcept { return movemask(m) != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return movemask(m) == 0xFFu; }
+
+	FORCE_INLINE static type one()				  noexcept { return _mm256_set1_ps(1.f); }
+	FORCE_INLINE static type zero()				  noexcept { return _mm256_setzero_ps(); }
+	FORCE_INLINE static type half_pi()			  noexcept { return _mm256_set1_ps(HALF_PI_F); }
+	FORCE_INLINE static type pi()			      noexcept { return _mm256_set1_ps(PI_F); }
+	FORCE_INLINE static type two_pi()			  noexcept { return _mm256_set1_ps(TWO_PI_F); }
+
+	// Conversion function from scalar value to SIMD
+	FORCE_INLINE static type set(float x) noexcept { return _mm256_set1_ps(x); }
+
+	// Returns the SIMD register width, in terms of
+	// the number of elements processed in parallel
+	// NB: this implementation is faster than using
+	//     the _mm_hadd_ps
+	// Source: stackoverflow.com/a/35270026/8885740
+	//         Peter Cordes - 2016
+	FORCE_INLINE static float hsum(type x) noexcept {
+		__m128 vlow = _mm256_castps256_ps128(x);
+		__m128 vhigh = _mm256_extractf128_ps(x, 1);
+		vlow = _mm_add_ps(vlow, vhigh);
+
+		return ComputeBackend<float, SIMDLevel::SSE41>::hsum(vlow);
+	}
+
+	// Returns the SIMD register width, in terms of
+	// the number of elements processed in parallel
+	FORCE_INLINE static constexpr size_t width() noexcept { return 8; }
+
+	// Returns the memory alignment for the register 
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Loads value from pointer to associated data type
+	FORCE_INLINE static type loadu(const float* FORCE_RESTRICT ptr) noexcept { return _mm256_loadu_ps(ptr); } // Unaligned
+	FORCE_INLINE static type loada(const float* FORCE_RESTRICT ptr) noexcept { return _mm256_load_ps (ptr); } // Aligned
+
+	// Unloads SIMD value to scalar buffers
+	FORCE_INLINE static void unloadu(float* FORCE_RESTRICT ptr, type x) { _mm256_storeu_ps(ptr, x); } // Unaligned
+	FORCE_INLINE static void unloada(float* FORCE_RESTRICT ptr, type x) { _mm256_store_ps (ptr, x); } // Aligned
+
+	// Non-temporal store to aligned memory, bypassing the caches, for
+	// write-once outputs larger than the last level cache. Streamed
+	// stores are only ordered with the other ones after sfence().
+	FORCE_INLINE static void stream(float* FORCE_RESTRICT ptr, type x) noexcept { _mm256_stream_ps(ptr, x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+
+	// Fetches the cache line of ptr into every cache level
+	FORCE_INLINE static void prefetch(const float* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+
+	// Partial loads and stores of the first n < width() lanes, for
+	// array tails. Masked lanes are never accessed, so reading past
+	// the end of the array cannot fault; they are loaded as zeros.
+	FORCE_INLINE static __m256i tail_mask(size_t n) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(detail::tail_mask_epi32 + 8 - n)); }
+	FORCE_INLINE static type loadu_partial(const float* FORCE_RESTRICT ptr, size_t n) noexcept { return _mm256_maskload_ps(ptr, tail_mask(n)); }
+	FORCE_INLINE static void unloadu_partial(float* FORCE_RESTRICT ptr, type x, size_t n) noexcept { _mm256_maskstore_ps(ptr, tail_mask(n), x); }
+
+	// 16-bit storage (see half.hpp), widened to float and narrowed back
+	// rounding to nearest even. Halves are converted by F16C when it is
+	// enabled, which -mavx2 alone does not imply, by the SSE4.1 integer
+	// conversions otherwise. bfloat16 is the high half of a float.
+	FORCE_INLINE static type loadu(const half* ptr) noexcept {
+	#if defined(VECTRA_HAS_F16C)
+		return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+	#else
+		using sse = ComputeBackend<float, SIMDLevel::SSE41>;
+		return _mm256_set_m128(sse::loadu(ptr + 4), sse::loadu(ptr));
+	#endif
+	}
+	FORCE_INLINE static void unloadu(half* ptr, type x) noexcept {
+	#if defined(VECTRA_HAS_F16C)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT));
+	#else
+		using sse = ComputeBackend<float, SIMDLevel::SSE41>;
+		sse::unloadu(ptr,     _mm256_castps256_ps128(x));
+		sse::unloadu(ptr + 4, _mm256_extractf128_ps(x, 1));
+	#endif
+	}
+	FORCE_INLINE static type loadu(const bfloat16* ptr) noexcept {
+		return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))), 16));
+	}
+	FORCE_INLINE static void unloadu(bfloat16* ptr, type x) noexcept {
+		const __m256i bits = _mm256_castps_si256(x);
+		const __m256i odd  = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+		const __m256i nan  = _mm256_or_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(0x40));
+		__m256i b = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(bits, _mm256_set1_epi32(0x7FFF)), odd), 16);
+		b = _mm256_blendv_epi8(b, nan, _mm256_castps_si256(_mm256_cmp_ps(x, x, _CMP_UNORD_Q)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm_packus_epi32(_mm256_castsi256_si128(b), _mm256_extracti128_si256(b, 1)));
+	}
+	FORCE_INLINE static type loadu_partial(const half*     ptr, size_t n) noexcept { return detail::loadPartial16<ComputeBackend>(ptr, n); }
+	FORCE_INLINE static type loadu_partial(const bfloat16* ptr, size_t n) noexcept { return detail::loadPartial16<ComputeBackend>(ptr, n); }
+	FORCE_INLINE static void unloadu_partial(half*     ptr, type x, size_t n) noexcept { detail::storePartial16<ComputeBackend>(ptr, x, n); }
+	FORCE_INLINE static void unloadu_partial(bfloat16* ptr, type x, size_t n) noexcept { detail::storePartial16<ComputeBackend>(ptr, x, n); }
+
+	// Interleaved records, same shuffles as the AVX backend
+	FORCE_INLINE static void deinterleave2(const float* ptr, type& a, type& b)                  noexcept { ComputeBackend<float, SIMDLevel::AVX>::deinterleave2(ptr, a, b); }
+	FORCE_INLINE static void deinterleave3(const float* ptr, type& a, type& b, type& c)         noexcept { ComputeBackend<float, SIMDLevel::AVX>::deinterleave3(ptr, a, b, c); }
+	FORCE_INLINE static void deinterleave4(const float* ptr, type& a, type& b, type& c, type& d) noexcept { ComputeBackend<float, SIMDLevel::AVX>::deinterleave4(ptr, a, b, c, d); }
+	FORCE_INLINE static void interleave2(float* ptr, type a, type b)                 noexcept { ComputeBackend<float, SIMDLevel::AVX>::interleave2(ptr, a, b); }
+	FORCE_INLINE static void interleave3(float* ptr, type a, type b, type c)         noexcept { ComputeBackend<float, SIMDLevel::AVX>::interleave3(ptr, a, b, c); }
+	FORCE_INLINE static void interleave4(float* ptr, type a, type b, type c, type d) noexcept { ComputeBackend<float, SIMDLevel::AVX>::interleave4(ptr, a, b, c, d); }
+
+	// Indexed accesses, lane i being base[idx[i]]. Masked-off lanes of
+	// mask_gather() are not read. AVX2 has no scatter instruction:
+	// lanes are stored one by one.
+	FORCE_INLINE static type gather(const float* base, index idx) noexcept { return _mm256_i32gather_ps(base, idx, 4); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const float* base, index idx) noexcept { return _mm256_mask_i32gather_ps(src, base, idx, m, 4); }
+	FORCE_INLINE static void scatter(float* base, index idx, type x) noexcept { detail::scatterLanes<ComputeBackend>(base, idx, x); }
+	FORCE_INLINE static void mask_scatter(float* base, mask m, index idx, type x) noexcept { detail::maskScatterLanes<ComputeBackend>(base, m, idx, x); }
+};
+
+template <>
+struct ComputeBackend<double, SIMDLevel::AVX2> {
+	using type = __m256d;
+	using mask = __m256d; // All bits set in the lanes where true
+	using index = __m256i; // Indices of gather() and scatter(), int64_t lanes
+	// SVML provides vectorized transcendental functions, but it
+	// is only shipped with MSVC and the Intel compilers. Unless
+	// VECTRA_USE_SVML is defined, we rely on in-house kernels.
+	#ifdef VECTRA_USE_SVML
+	FORCE_INLINE static type sin (type x)		  noexcept { return _mm256_sin_pd(x); }
+	FORCE_INLINE static type cos (type x)		  noexcept { return _mm256_cos_pd(x); }
+	// Since our approximation of arccos is not defined only over
+	// [-1 ; 1], we can then avoid the cost of clamping argument.
+	#ifndef HAS_MM_ACOS_PD
+	FORCE_INLINE static type acos(type x)		  noexcept { return _mm256_acos_pd(x); }
+	#else
+	FORCE_INLINE static type acos(type x)		  noexcept { return _mm256_acos_pd(_mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(-1.0)), _mm256_set1_pd(1.0))); }
+	#endif
+	FORCE_INLINE static type asin(type x)		  noexcept { return _mm256_asin_pd(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return _mm256_atan_pd(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return _mm256_atan2_pd(y, x); }
+	FORCE_INLINE static type cbrt(type x)		  noexcept { return _mm256_cbrt_pd(x); }
+	FORCE_INLINE static type exp (type x)		  noexcept { return _mm256_exp_pd(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return _mm256_exp2_pd(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return _mm256_expm1_pd(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return _mm256_log_pd(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return _mm256_log2_pd(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return _mm256_log1p_pd(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return _mm256_pow_pd(a, b); }
+	#else
+	FORCE_INLINE static type sin (type x)		  noexcept { return math::sin<double, ComputeBackend>(x); }
+	FORCE_INLINE static type cos (type x)		  noexcept { return math::cos<double, ComputeBackend>(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return math::asin <double, ComputeBackend>(x); }
+	FORCE_INLINE static type acos(type x)		  noexcept { return math::acos <double, ComputeBackend>(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return math::atan <double, ComputeBackend>(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return math::atan2<double, ComputeBackend>(y, x); }
+	FORCE_INLINE static type cbrt(type x)		  noexcept { return math::cbrt <double, ComputeBackend>(x); }
+	FORCE_INLINE static type exp (type x)		  noexcept { return math::exp  <double, ComputeBackend>(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return math::exp2 <double, ComputeBackend>(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return math::expm1<double, ComputeBackend>(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return math::log  <double, ComputeBackend>(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return math::log2 <double, ComputeBackend>(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return math::log1p<double, ComputeBackend>(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return math::pow  <double, ComputeBackend>(a, b); }
+	#endif
+	FORCE_INLINE static type sqrt(type x)		  noexcept { return _mm256_sqrt_pd(x); }
+
+	// Estimates seeded in float on the significand (see math/reciprocal.hpp),
+	// refined by three Newton steps (12, 24 then 48 bits and beyond)
+	FORCE_INLINE static type rcp  (type x) noexcept { return math::rcp_estimate  <double, ComputeBackend>(x, [](type m) { return _mm256_cvtps_pd(_mm_rcp_ps(_mm256_cvtpd_ps(m))); }); }
+	FORCE_INLINE static type rsqrt(type x) noexcept { return math::rsqrt_estimate<double, ComputeBackend>(x, [](type m) { return _mm256_cvtps_pd(_mm_rsqrt_ps(_mm256_cvtpd_ps(m))); }); }
+	FORCE_INLINE static type rcp_refined  (type x) noexcept { return math::rcp_newton  <double, ComputeBackend, 3>(x, rcp(x)); }
+	FORCE_INLINE static type rsqrt_refined(type x) noexcept { return math::rsqrt_newton<double, ComputeBackend, 3>(x, rsqrt(x)); }
+	FORCE_INLINE static type add (type a, type b) noexcept { return _mm256_add_pd(a, b); }
+	FORCE_INLINE static type sub (type a, type b) noexcept { return _mm256_sub_pd(a, b); }
+	FORCE_INLINE static type mul (type a, type b) noexcept { return _mm256_mul_pd(a, b); }
+	FORCE_INLINE static type div (type a, type b) noexcept { return _mm256_div_pd(a, b); }
+	FORCE_INLINE static type min (type a, type b) noexcept { return _mm256_min_pd(a, b); }
+	FORCE_INLINE static type max (type a, type b) noexcept { return _mm256_max_pd(a, b); }
+	FORCE_INLINE static type abs (type x)         noexcept { return _mm256_and_pd(x, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF))); }
+	FORCE_INLINE static type round(type x)        noexcept { return _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	FORCE_INLINE static type floor(type x)        noexcept { return _mm256_floor_pd(x); }
+
+	// Fused multiply-add primitives, rounded only once
+	FORCE_INLINE static constexpr bool has_fma() noexcept { return true; }
+	FORCE_INLINE static type fma (type a, type b, type c) noexcept { return _mm256_fmadd_pd (a, b, c); } //   a * b + c
+	FORCE_INLINE static type fms (type a, type b, type c) noexcept { return _mm256_fmsub_pd (a, b, c); } //   a * b - c
+	FORCE_INLINE static type fnma(type a, type b, type c) noexcept { return _mm256_fnmadd_pd(a, b, c); } // -(a * b) + c
+
+	// Bitwise operations on the IEEE-754 representation
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm256_and_pd   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm256_or_pd    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm256_xor_pd   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm256_andnot_pd(a, b); } // ~a & b
+
+	// Exponent manipulation, for positive normal values x and for
+	// integral values n in the normal exponent range [-1022 ; 1023]
+	// NB: there is no 64-bit integer to double conversion before
+	//     AVX-512, so integers are placed in the significand of 2^52
+	//     and 2^52 is subtracted, as in the SSE4.1 backend.
+	FORCE_INLINE static type getexp (type x) noexcept {
+		__m256i e = _mm256_and_si256(_mm256_srli_epi64(_mm256_castpd_si256(x), 52), _mm256_set1_epi64x(0x7FF));
+		return _mm256_sub_pd(_mm256_or_pd(_mm256_castsi256_pd(e), _mm256_set1_pd(4503599627370496.0)), _mm256_set1_pd(4503599627370496.0 + 1023.0)); // floor(log2(x))
+	}
+	FORCE_INLINE static type getmant(type x) noexcept { return _mm256_or_pd(_mm256_and_pd(x, _mm256_castsi256_pd(_mm256_set1_epi64x(0x000FFFFFFFFFFFFF))), _mm256_set1_pd(1.0)); } // In [1 ; 2[
+	FORCE_INLINE static type exp2i  (type n) noexcept { return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(_mm256_add_pd(n, _mm256_set1_pd(4503599627370496.0 + 1023.0))), 52)); } // 2^n
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm256_blendv_pd(b, a, m); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return _mm256_and_pd(a, b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return _mm256_or_pd(a, b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return _mm256_xor_pd(m, _mm256_castsi256_pd(_mm256_set1_epi32(-1))); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return static_cast<unsigned>(_mm256_movemask_pd(m)); }
+	FORCE_INLINE static bool any(mask m)              noexcept { return movemask(m) != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return movemask(m) == 0xFu; }
+
+	FORCE_INLINE static type one()				  noexcept { return _mm256_set1_pd(1.0); }
+	FORCE_INLINE static type zero()				  noexcept { return _mm256_setzero_pd(); }
+	FORCE_INLINE static type half_pi()			  noexcept { return _mm256_set1_pd(HALF_PI_D); }
+	FORCE_INLINE static type pi()			      noexcept { return _mm256_set1_pd(PI_D); }
+	FORCE_INLINE static type two_pi()			  noexcept { return _mm256_set1_pd(TWO_PI_D); }
+
+	// Conversion function from scalar value to SIMD
+	FORCE_INLINE static type set(double x) noexcept { return _mm256_set1_pd(x); }
+
+	// Returns the SIMD register width, in terms of
+	// the number of elements processed in parallel
+	// NB: this implementation is faster than using
+	//     the _mm_hadd_pd
+	// Source: stackoverflow.com/a/35270026/8885740
+	//         Peter Cordes - 2016
+	FORCE_INLINE static double hsum(type x) {
+		__m128d vlow = _mm256_castpd256_pd128(x);
+		__m128d vhigh = _mm256_extractf128_pd(x, 1);
+		vlow = _mm_add_pd(vlow, vhigh);
+
+		return ComputeBackend<double, SIMDLevel::SSE41>::hsum(vlow);
+	}
+
+	// Returns the SIMD register width, in terms of
+	// the number of elements processed in parallel
+	FORCE_INLINE static constexpr size_t width() noexcept { return 4; }
+
+	// Returns the memory alignment for the register 
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Loads value from pointer to associated data type
+	FORCE_INLINE static type loadu(const double* FORCE_RESTRICT ptr) noexcept { return _mm256_loadu_pd(ptr); } // Unaligned
+	FORCE_INLINE static type loada(const double* FORCE_RESTRICT ptr) noexcept { return _mm256_load_pd (ptr); } // Aligned
+
+	// Unloads SIMD value to scalar buffers
+	FORCE_INLINE static void unloadu(double* FORCE_RESTRICT ptr, type x) { _mm256_storeu_pd(ptr, x); } // Unaligned
+	FORCE_INLINE static void unloada(double* FORCE_RESTRICT ptr, type x) { _mm256_store_pd (ptr, x); } // Aligned
+
+	// Non-temporal store to aligned memory, bypassing the caches, for
+	// write-once outputs larger than the last level cache. Streamed
+	// stores are only ordered with the other ones after sfence().
+	FORCE_INLINE static void stream(double* FORCE_RESTRICT ptr, type x) noexcept { _mm256_stream_pd(ptr, x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+
+	// Fetches the cache line of ptr into every cache level
+	FORCE_INLINE static void prefetch(const double* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+
+	// Partial loads and stores of the first n < width() lanes, for
+	// array tails. Masked lanes are never accessed, so reading past
+	// the end of the array cannot fault; they are loaded as zeros.
+	FORCE_INLINE static __m256i tail_mask(size_t n) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(detail::tail_mask_epi64 + 4 - n)); }
+	FORCE_INLINE static type loadu_partial(const double* FORCE_RESTRICT ptr, size_t n) noexcept { return _mm256_maskload_pd(ptr, tail_mask(n)); }
+	FORCE_INLINE static void unloadu_partial(double* FORCE_RESTRICT ptr, type x, size_t n) noexcept { _mm256_maskstore_pd(ptr, tail_mask(n), x); }
+
+	// Interleaved records, same shuffles as the AVX backend
+	FORCE_INLINE static void deinterleave2(const double* ptr, type& a, type& b)                  noexcept { ComputeBackend<double, SIMDLevel::AVX>::deinterleave2(ptr, a, b); }
+	FORCE_INLINE static void deinterleave3(const double* ptr, type& a, type& b, type& c)         noexcept { ComputeBackend<double, SIMDLevel::AVX>::deinterleave3(ptr, a, b, c); }
+	FORCE_INLINE static void deinterleave4(const double* ptr, type& a, type& b, type& c, type& d) noexcept { ComputeBackend<double, SIMDLevel::AVX>::deinterleave4(ptr, a, b, c, d); }
+	FORCE_INLINE static void interleave2(double* ptr, type a, type b)                 noexcept { ComputeBackend<double, SIMDLevel::AVX>::interleave2(ptr, a, b); }
+	FORCE_INLINE static void interleave3(double* ptr, type a, type b, type c)         noexcept { ComputeBackend<double, SIMDLevel::AVX>::interleave3(ptr, a, b, c); }
+	FORCE_INLINE static void interleave4(double* ptr, type a, type b, type c, type d) noexcept { ComputeBackend<double, SIMDLevel::AVX>::interleave4(ptr, a, b, c, d); }
+
+	// Indexed accesses, lane i being base[idx[i]]. Masked-off lanes of
+	// mask_gather() are not read. AVX2 has no scatter instruction:
+	// lanes are stored one by one.
+	FORCE_INLINE static type gather(const double* base, index idx) noexcept { return _mm256_i64gather_pd(base, idx, 8); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const double* base, index idx) noexcept { return _mm256_mask_i64gather_pd(src, base, idx, m, 8); }
+	FORCE_INLINE static void scatter(double* base, index idx, type x) noexcept { detail::scatterLanes<ComputeBackend>(base, idx, x); }
+	FORCE_INLINE static void mask_scatter(double* base, mask m, index idx, type x) noexcept { detail::maskScatterLanes<ComputeBackend>(base, m, idx, x); }
+};
+
+// Integer lanes, see the scalar backend for their semantics
+template <>
+struct ComputeBackend<std::int32_t, SIMDLevel::AVX2> {
+	using type     = __m256i;
+	using mask     = __m256i; // All bits set in the lanes where true
+	using index    = __m256i; // Indices of gather() and scatter(), int32_t lanes
+	using floating = __m256;
+
+	FORCE_INLINE static type add(type a, type b) noexcept { return _mm256_add_epi32  (a, b); }
+	FORCE_INLINE static type sub(type a, type b) noexcept { return _mm256_sub_epi32  (a, b); }
+	FORCE_INLINE static type mul(type a, type b) noexcept { return _mm256_mullo_epi32(a, b); }
+	FORCE_INLINE static type min(type a, type b) noexcept { return _mm256_min_epi32  (a, b); }
+	FORCE_INLINE static type max(type a, type b) noexcept { return _mm256_max_epi32  (a, b); }
+	FORCE_INLINE static type abs(type x)         noexcept { return _mm256_abs_epi32  (x); }
+
+	// Shifts by n in [0 ; 32[, shr() being arithmetic
+	FORCE_INLINE static type shl        (type x, int n) noexcept { return _mm256_sll_epi32(x, _mm_cvtsi32_si128(n)); }
+	FORCE_INLINE static type shr        (type x, int n) noexcept { return _mm256_sra_epi32(x, _mm_cvtsi32_si128(n)); }
+	FORCE_INLINE static type shr_logical(type x, int n) noexcept { return _mm256_srl_epi32(x, _mm_cvtsi32_si128(n)); }
+
+	// Bitwise operations
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm256_and_si256   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm256_or_si256    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm256_xor_si256   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm256_andnot_si256(a, b); } // ~a & b
+	FORCE_INLINE static type bit_not   (type x)         noexcept { return _mm256_xor_si256   (x, _mm256_set1_epi32(-1)); }
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm256_cmpeq_epi32(a, b); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm256_cmpgt_epi32(a, b); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return cmpgt(b, a); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return mask_not(cmpgt(a, b)); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return mask_not(cmpeq(a, b)); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return mask_not(cmpgt(b, a)); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm256_blendv_epi8(b, a, m); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return _mm256_and_si256(a, b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return _mm256_or_si256(a, b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return _mm256_xor_si256(m, _mm256_set1_epi32(-1)); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(m))); }
+	FORCE_INLINE static bool any(mask m)              noexcept { return movemask(m) != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return movemask(m) == 0xFFu; }
+
+	FORCE_INLINE static type one()  noexcept { return _mm256_set1_epi32(1); }
+	FORCE_INLINE static type zero() noexcept { return _mm256_setzero_si256(); }
+	FORCE_INLINE static type set(std::int32_t x) noexcept { return _mm256_set1_epi32(x); }
+
+	// Wrapping sum of the lanes
+	FORCE_INLINE static std::int32_t hsum(type x) noexcept {
+		return ComputeBackend<std::int32_t, SIMDLevel::SSE41>::hsum(_mm_add_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+	}
+
+	FORCE_INLINE static constexpr size_t width() noexcept { return 8; }
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Memory operations, see the float backend
+	FORCE_INLINE static type loadu(const std::int32_t* FORCE_RESTRICT ptr) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); }
+	FORCE_INLINE static type loada(const std::int32_t* FORCE_RESTRICT ptr) noexcept { return _mm256_load_si256 (reinterpret_cast<const __m256i*>(ptr)); }
+	FORCE_INLINE static void unloadu(std::int32_t* FORCE_RESTRICT ptr, type x) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), x); }
+	FORCE_INLINE static void unloada(std::int32_t* FORCE_RESTRICT ptr, type x) noexcept { _mm256_store_si256 (reinterpret_cast<__m256i*>(ptr), x); }
+	FORCE_INLINE static void stream (std::int32_t* FORCE_RESTRICT ptr, type x) noexcept { _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+	FORCE_INLINE static void prefetch(const std::int32_t* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+	FORCE_INLINE static type loadu_partial(const std::int32_t* FORCE_RESTRICT ptr, size_t n) noexcept {
+		return _mm256_maskload_epi32(reinterpret_cast<const int*>(ptr), ComputeBackend<float, SIMDLevel::AVX2>::tail_mask(n));
+	}
+	FORCE_INLINE static void unloadu_partial(std::int32_t* FORCE_RESTRICT ptr, type x, size_t n) noexcept {
+		_mm256_maskstore_epi32(reinterpret_cast<int*>(ptr), ComputeBackend<float, SIMDLevel::AVX2>::tail_mask(n), x);
+	}
+
+	// Conversions with float lanes
+	FORCE_INLINE static type from_float      (floating x) noexcept { return _mm256_cvtps_epi32 (x); }
+	FORCE_INLINE static type from_float_trunc(floating x) noexcept { return _mm256_cvttps_epi32(x); }
+	FORCE_INLINE static floating to_float(type x) noexcept { return _mm256_cvtepi32_ps(x); }
+
+	// Indexed accesses, lane i being base[idx[i]]. Masked-off lanes of
+	// mask_gather() are not read. AVX2 has no scatter instruction:
+	// lanes are stored one by one.
+	FORCE_INLINE static type gather(const std::int32_t* base, index idx) noexcept { return _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), idx, 4); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const std::int32_t* base, index idx) noexcept { return _mm256_mask_i32gather_epi32(src, reinterpret_cast<const int*>(base), idx, m, 4); }
+	FORCE_INLINE static void scatter(std::int32_t* base, index idx, type x) noexcept { detail::scatterLanes<ComputeBackend>(base, idx, x); }
+	FORCE_INLINE static void mask_scatter(std::int32_t* base, mask m, index idx, type x) noexcept { detail::maskScatterLanes<ComputeBackend>(base, m, idx, x); }
+};
+
+// Multiplications and arithmetic shifts of 64-bit lanes are emulated
+// with 32-bit operations before AVX-512, and so are the conversions
+// with double (see the SSE4.1 backend).
+template <>
+struct ComputeBackend<std::int64_t, SIMDLevel::AVX2> {
+	using type     = __m256i;
+	using mask     = __m256i; // All bits set in the lanes where true
+	using index    = __m256i; // Indices of gather() and scatter(), int64_t lanes
+	using floating = __m256d;
+
+	FORCE_INLINE static type add(type a, type b) noexcept { return _mm256_add_epi64(a, b); }
+	FORCE_INLINE static type sub(type a, type b) noexcept { return _mm256_sub_epi64(a, b); }
+	FORCE_INLINE static type min(type a, type b) noexcept { return select(cmpgt(a, b), b, a); }
+	FORCE_INLINE static type max(type a, type b) noexcept { return select(cmpgt(a, b), a, b); }
+	FORCE_INLINE static type abs(type x)         noexcept { const __m256i s = sign(x); return _mm256_sub_epi64(_mm256_xor_si256(x, s), s); }
+
+	// Low 64 bits of the product: lo(a) lo(b) + (lo(a) hi(b) + hi(a) lo(b)) << 32
+	FORCE_INLINE static type mul(type a, type b) noexcept {
+		const __m256i cross = _mm256_mullo_epi32(a, _mm256_shuffle_epi32(b, _MM_SHUFFLE(2, 3, 0, 1)));
+		const __m256i high  = _mm256_shuffle_epi32(_mm256_hadd_epi32(cross, _mm256_setzero_si256()), _MM_SHUFFLE(1, 3, 0, 3));
+		return _mm256_add_epi64(_mm256_mul_epu32(a, b), high);
+	}
+
+	// All bits set in the negative lanes
+	FORCE_INLINE static type sign(type x) noexcept { return _mm256_cmpgt_epi64(_mm256_setzero_si256(), x); }
+
+	// Shifts by n in [0 ; 64[, shr() being arithmetic: the logical
+	// shift, with the sign shifted into the high bits
+	FORCE_INLINE static type shl        (type x, int n) noexcept { return _mm256_sll_epi64(x, _mm_cvtsi32_si128(n)); }
+	FORCE_INLINE static type shr        (type x, int n) noexcept { return _mm256_or_si256(shr_logical(x, n), _mm256_sll_epi64(sign(x), _mm_cvtsi32_si128(64 - n))); }
+	FORCE_INLINE static type shr_logical(type x, int n) noexcept { return _mm256_srl_epi64(x, _mm_cvtsi32_si128(n)); }
+
+	// Bitwise operations
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm256_and_si256   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm256_or_si256    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm256_xor_si256   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm256_andnot_si256(a, b); } // ~a & b
+	FORCE_INLINE static type bit_not   (type x)         noexcept { return _mm256_xor_si256   (x, _mm256_set1_epi32(-1)); }
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm256_cmpeq_epi64(a, b); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm256_cmpgt_epi64(a, b); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return cmpgt(b, a); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return mask_not(cmpgt(a, b)); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return mask_not(cmpeq(a, b)); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return mask_not(cmpgt(b, a)); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm256_blendv_epi8(b, a, m); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return _mm256_and_si256(a, b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return _mm256_or_si256(a, b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return _mm256_xor_si256(m, _mm256_set1_epi32(-1)); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(m))); }
+	FORCE_INLINE static bool any(mask m)              noexcept { return movemask(m) != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return movemask(m) == 0xFu; }
+
+	FORCE_INLINE static type one()  noexcept { return _mm256_set1_epi64x(1); }
+	FORCE_INLINE static type zero() noexcept { return _mm256_setzero_si256(); }
+	FORCE_INLINE static type set(std::int64_t x) noexcept { return _mm256_set1_epi64x(x); }
+
+	// Wrapping sum of the lanes
+	FORCE_INLINE static std::int64_t hsum(type x) noexcept {
+		return ComputeBackend<std::int64_t, SIMDLevel::SSE41>::hsum(_mm_add_epi64(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+	}
+
+	FORCE_INLINE static constexpr size_t width() noexcept { return 4; }
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Memory operations, see the float backend
+	FORCE_INLINE static type loadu(const std::int64_t* FORCE_RESTRICT ptr) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); }
+	FORCE_INLINE static type loada(const std::int64_t* FORCE_RESTRICT ptr) noexcept { return _mm256_load_si256 (reinterpret_cast<const __m256i*>(ptr)); }
+	FORCE_INLINE static void unloadu(std::int64_t* FORCE_RESTRICT ptr, type x) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), x); }
+	FORCE_INLINE static void unloada(std::int64_t* FORCE_RESTRICT ptr, type x) noexcept { _mm256_store_si256 (reinterpret_cast<__m256i*>(ptr), x); }
+	FORCE_INLINE static void stream (std::int64_t* FORCE_RESTRICT ptr, type x) noexcept { _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+	FORCE_INLINE static void prefetch(const std::int64_t* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+	FORCE_INLINE static type loadu_partial(const std::int64_t* FORCE_RESTRICT ptr, size_t n) noexcept {
+		return _mm256_maskload_epi64(reinterpret_cast<const long long*>(ptr), ComputeBackend<double, SIMDLevel::AVX2>::tail_mask(n));
+	}
+	FORCE_INLINE static void unloadu_partial(std::int64_t* FORCE_RESTRICT ptr, type x, size_t n) noexcept {
+		_mm256_maskstore_epi64(reinterpret_cast<long long*>(ptr), ComputeBackend<double, SIMDLevel::AVX2>::tail_mask(n), x);
+	}
+
+	// Conversions with double lanes, for |x| < 2^51 from double
+	FORCE_INLINE static type from_float(floating x) noexcept {
+		const __m256d magic = _mm256_set1_pd(0x1.8p52);
+		return _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(x, magic)), _mm256_castpd_si256(magic));
+	}
+	FORCE_INLINE static type from_float_trunc(floating x) noexcept { return from_float(_mm256_round_pd(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)); }
+	FORCE_INLINE static floating to_float(type x) noexcept {
+		const __m256i high = _mm256_add_epi64(_mm256_blend_epi16(_mm256_srai_epi32(x, 16), _mm256_setzero_si256(), 0x33), _mm256_castpd_si256(_mm256_set1_pd(0x3p67)));
+		const __m256i low  = _mm256_blend_epi16(x, _mm256_castpd_si256(_mm256_set1_pd(0x1p52)), 0x88);
+		return _mm256_add_pd(_mm256_sub_pd(_mm256_castsi256_pd(high), _mm256_set1_pd(0x3p67 + 0x1p52)), _mm256_castsi256_pd(low));
+	}
+
+	// Indexed accesses, lane i being base[idx[i]]. Masked-off lanes of
+	// mask_gather() are not read. AVX2 has no scatter instruction:
+	// lanes are stored one by one.
+	FORCE_INLINE static type gather(const std::int64_t* base, index idx) noexcept { return _mm256_i64gather_epi64(reinterpret_cast<const long long*>(base), idx, 8); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const std::int64_t* base, index idx) noexcept { return _mm256_mask_i64gather_epi64(src, reinterpret_cast<const long long*>(base), idx, m, 8); }
+	FORCE_INLINE static void scatter(std::int64_t* base, index idx, type x) noexcept { detail::scatterLanes<ComputeBackend>(base, idx, x); }
+	FORCE_INLINE static void mask_scatter(std::int64_t* base, mask m, index idx, type x) noexcept { detail::maskScatterLanes<ComputeBackend>(base, m, idx, x); }
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,630 @@
+#pragma once
+
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include <vectra/core/simd_level.hpp>
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/constants.hpp>
+#include <vectra/core/half.hpp>
+#include <vectra/math/exponential.hpp>
+#include <vectra/math/inverse_trigonometric.hpp>
+#include <vectra/math/logarithmic.hpp>
+#include <vectra/math/power.hpp>
+#include <vectra/math/reciprocal.hpp>
+#include <vectra/math/trigonometric.hpp>
+
+
+namespace vectra
+{
+
+template <>
+struct ComputeBackend<float, SIMDLevel::AVX512> {
+	using type = __m512;
+	using mask = __mmask16; // One bit per lane, set where true
+	using index = __m512i; // Indices of gather() and scatter(), int32_t lanes
+	// SVML provides vectorized transcendental functions, but it
+	// is only shipped with MSVC and the Intel compilers. Unless
+	// VECTRA_USE_SVML is defined, we rely on in-house kernels.
+	#ifdef VECTRA_USE_SVML
+	FORCE_INLINE static type sin (type x)		  noexcept { return _mm512_sin_ps(x); }
+	FORCE_INLINE static type cos (type x)		  noexcept { return _mm512_cos_ps(x); }
+	// Since our approximation of arccos is not defined only over
+	// [-1 ; 1], we can then avoid the cost of clamping argument.
+	#ifndef HAS_MM_ACOS_PS
+	FORCE_INLINE static type acos(type x)		  noexcept { return _mm512_acos_ps(x); }
+	#else
+	FORCE_INLINE static type acos(type x)		  noexcept { return _mm512_acos_ps(_mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(-1.f)), _mm512_set1_ps(1.f))); }
+	#endif
+	FORCE_INLINE static type asin(type x)		  noexcept { return _mm512_asin_ps(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return _mm512_atan_ps(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return _mm512_atan2_ps(y, x); }
+	FORCE_INLINE static type cbrt(type x)		  noexcept { return _mm512_cbrt_ps(x); }
+	FORCE_INLINE static type exp (type x)		  noexcept { return _mm512_exp_ps(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return _mm512_exp2_ps(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return _mm512_expm1_ps(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return _mm512_log_ps(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return _mm512_log2_ps(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return _mm512_log1p_ps(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return _mm512_pow_ps(a, b); }
+	#else
+	FORCE_INLINE static type sin (type x)		  noexcept { return math::sin<float, ComputeBackend>(x); }
+	FORCE_INLINE static type cos (type x)		  noexcept { return math::cos<float, ComputeBackend>(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return math::asin <float, ComputeBackend>(x); }
+	FORCE_INLINE static type acos(type x)		  noexcept { return math::acos <float, ComputeBackend>(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return math::atan <float, ComputeBackend>(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return math::atan2<float, ComputeBackend>(y, x); }
+	FORCE_INLINE static type cbrt(type x)		  noexcept { return math::cbrt <float, ComputeBackend>(x); }
+	FORCE_INLINE static type exp (type x)		  noexcept { return math::exp  <float, ComputeBackend>(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return math::exp2 <float, ComputeBackend>(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return math::expm1<float, ComputeBackend>(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return math::log  <float, ComputeBackend>(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return math::log2 <float, ComputeBackend>(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return math::log1p<float, ComputeBackend>(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return math::pow  <float, ComputeBackend>(a, b); }
+	#endif
+	FORCE_INLINE static type sqrt(type x)		  noexcept { return _mm512_sqrt_ps(x); }
+
+	// Estimates of 1/x and 1/sqrt(x), relative error below 2^-14,
+	// refined by one Newton step to a few ULP (see math/reciprocal.hpp)
+	FORCE_INLINE static type rcp  (type x) noexcept { return _mm512_rcp14_ps(x); }
+	FORCE_INLINE static type rsqrt(type x) noexcept { return _mm512_rsqrt14_ps(x); }
+	FORCE_INLINE static type rcp_refined  (type x) noexcept { return math::rcp_newton  <float, ComputeBackend, 1>(x, rcp(x)); }
+	FORCE_INLINE static type rsqrt_refined(type x) noexcept { return math::rsqrt_newton<float, ComputeBackend, 1>(x, rsqrt(x)); }
+	FORCE_INLINE static type add (type a, type b) noexcept { return _mm512_add_ps(a, b); }
+	FORCE_INLINE static type sub (type a, type b) noexcept { return _mm512_sub_ps(a, b); }
+	FORCE_INLINE static type mul (type a, type b) noexcept { return _mm512_mul_ps(a, b); }
+	FORCE_INLINE static type div (type a, type b) noexcept { return _mm512_div_ps(a, b); }
+	FORCE_INLINE static type min (type a, type b) noexcept { return _mm512_min_ps(a, b); }
+	FORCE_INLINE static type max (type a, type b) noexcept { return _mm512_max_ps(a, b); }
+	FORCE_INLINE static type abs (type x)         noexcept { return _mm512_abs_ps(x); }
+	FORCE_INLINE static type round(type x)        noexcept { return _mm512_roundscale_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	FORCE_INLINE static type floor(type x)        noexcept { return _mm512_roundscale_ps(x, _MM_FROUND_TO_NEG_INF    | _MM_FROUND_NO_EXC); }
+
+	// Fused multiply-add primitives, rounded only once
+	FORCE_INLINE static constexpr bool has_fma() noexcept { return true; }
+	FORCE_INLINE static type fma (type a, type b, type c) noexcept { return _mm512_fmadd_ps (a, b, c); } //   a * b + c
+	FORCE_INLINE static type fms (type a, type b, type c) noexcept { return _mm512_fmsub_ps (a, b, c); } //   a * b - c
+	FORCE_INLINE static type fnma(type a, type b, type c) noexcept { return _mm512_fnmadd_ps(a, b, c); } // -(a * b) + c
+
+	// Bitwise operations on the IEEE-754 representation
+	// NB: the floating point forms require AVX512DQ
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm512_and_ps   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm512_or_ps    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm512_xor_ps   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm512_andnot_ps(a, b); } // ~a & b
+
+	// Exponent manipulation, with the dedicated AVX-512 instructions
+	// NB: unlike the other backends, subnormal values are supported
+	FORCE_INLINE static type getexp (type x) noexcept { return _mm512_getexp_ps(x); } // floor(log2(x))
+	FORCE_INLINE static type getmant(type x) noexcept { return _mm512_getmant_ps(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); } // In [1 ; 2[
+	FORCE_INLINE static type exp2i  (type n) noexcept { return _mm512_scalef_ps(_mm512_set1_ps(1.f), n); } // 2^n
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm512_mask_blend_ps(m, b, a); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return static_cast<mask>(a & b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return static_cast<mask>(a | b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return static_cast<mask>(~m); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return m; }
+	FORCE_INLINE static bool any(mask m)              noexcept { return m != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return m == 0xFFFFu; }
+
+	FORCE_INLINE static type one()				  noexcept { return _mm512_set1_ps(1.f); }
+	FORCE_INLINE static type zero()				  noexcept { return _mm512_setzero_ps(); }
+	FORCE_INLINE static type half_pi()			  noexcept { return _mm512_set1_ps(HALF_PI_F); }
+	FORCE_INLINE static type pi()			      noexcept { return _mm512_set1_ps(PI_F); }
+	FORCE_INLINE static type two_pi()			  noexcept { return _mm512_set1_ps(TWO_PI_F); }
+
+	// Conversion function from scalar value to SIMD
+	FORCE_INLINE static type set(float x) noexcept { return _mm512_set1_ps(x); }
+
+	// Horizontal sum function. The two halves are added, and
+	// the AVX backend finishes the reduction.
+	FORCE_INLINE static float hsum(type x) noexcept {
+		__m256 vlow  = _mm512_castps512_ps256(x);
+		__m256 vhigh = _mm512_extractf32x8_ps(x, 1);
+		vlow = _mm256_add_ps(vlow, vhigh);
+
+		return ComputeBackend<float, SIMDLevel::AVX>::hsum(vlow);
+	}
+
+	// Returns the SIMD register width, in terms of
+	// the number of elements processed in parallel
+	FORCE_INLINE static constexpr size_t width() noexcept { return 16; }
+
+	// Returns the memory alignment for the register 
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Loads value from pointer to associated data type
+	FORCE_INLINE static type loadu(const float* FORCE_RESTRICT ptr) noexcept { return _mm512_loadu_ps(ptr); } // Unaligned
+	FORCE_INLINE static type loada(const float* FORCE_RESTRICT ptr) noexcept { return _mm512_load_ps (ptr); } // Aligned
+
+	// Unloads SIMD value to scalar buffers
+	FORCE_INLINE static void unloadu(float* FORCE_RESTRICT ptr, type x) { _mm512_storeu_ps(ptr, x); } // Unaligned
+	FORCE_INLINE static void unloada(float* FORCE_RESTRICT ptr, type x) { _mm512_store_ps (ptr, x); } // Aligned
+
+	// Non-temporal store to aligned memory, bypassing the caches, for
+	// write-once outputs larger than the last level cache. Streamed
+	// stores are only ordered with the other ones after sfence().
+	FORCE_INLINE static void stream(float* FORCE_RESTRICT ptr, type x) noexcept { _mm512_stream_ps(ptr, x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+
+	// Fetches the cache line of ptr into every cache level
+	FORCE_INLINE static void prefetch(const float* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+
+	// Partial loads and stores of the first n < width() lanes, for
+	// array tails. Masked lanes are never accessed, so reading past
+	// the end of the array cannot fault; they are loaded as zeros.
+	FORCE_INLINE static mask tail_mask(size_t n) noexcept { return static_cast<mask>((1u << n) - 1u); }
+	FORCE_INLINE static type loadu_partial(const float* FORCE_RESTRICT ptr, size_t n) noexcept { return _mm512_maskz_loadu_ps(tail_mask(n), ptr); }
+	FORCE_INLINE static void unloadu_partial(float* FORCE_RESTRICT ptr, type x, size_t n) noexcept { _mm512_mask_storeu_ps(ptr, tail_mask(n), x); }
+
+	// 16-bit storage (see half.hpp), widened to float and narrowed back
+	// rounding to nearest even. AVX-512F converts halves itself, and
+	// narrows 32-bit lanes to 16 bits (vpmovdw). The AVX512_BF16
+	// conversion is not used, since it flushes denormals to zero.
+	FORCE_INLINE static type loadu(const half* ptr) noexcept {
+		return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));
+	}
+	FORCE_INLINE static void unloadu(half* ptr, type x) noexcept {
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), _mm512_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT));
+	}
+	FORCE_INLINE static type loadu(const bfloat16* ptr) noexcept {
+		return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))), 16));
+	}
+	FORCE_INLINE static void unloadu(bfloat16* ptr, type x) noexcept {
+		const __m512i bits = _mm512_castps_si512(x);
+		const __m512i odd  = _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+		const __m512i nan  = _mm512_or_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(0x40));
+		__m512i b = _mm512_srli_epi32(_mm512_add_epi32(_mm512_add_epi32(bits, _mm512_set1_epi32(0x7FFF)), odd), 16);
+		b = _mm512_mask_mov_epi32(b, _mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q), nan);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), _mm512_cvtepi32_epi16(b));
+	}
+	FORCE_INLINE static type loadu_partial(const half*     ptr, size_t n) noexcept { return detail::loadPartial16<ComputeBackend>(ptr, n); }
+	FORCE_INLINE static type loadu_partial(const bfloat16* ptr, size_t n) noexcept { return detail::loadPartial16<ComputeBackend>(ptr, n); }
+	FORCE_INLINE static void unloadu_partial(half*     ptr, type x, size_t n) noexcept { detail::storePartial16<ComputeBackend>(ptr, x, n); }
+	FORCE_INLINE static void unloadu_partial(bfloat16* ptr, type x, size_t n) noexcept { detail::storePartial16<ComputeBackend>(ptr, x, n); }
+
+	// Interleaved records (a0 b0 a1 b1 ... for two components), one
+	// register of records per call, loaded as one register per
+	// component by deinterleaveN and stored back by interleaveN.
+	// Like AVX, each 128-bit lane holds 4 records and follows the
+	// SSE4.1 algorithm, lane j being loaded from ptr + j * step.
+	FORCE_INLINE static type load_lanes(const float* ptr, size_t step) noexcept {
+		__m512 x = _mm512_castps128_ps512(_mm_loadu_ps(ptr));
+		x = _mm512_insertf32x4(x, _mm_loadu_ps(ptr +     step), 1);
+		x = _mm512_insertf32x4(x, _mm_loadu_ps(ptr + 2 * step), 2);
+		return _mm512_insertf32x4(x, _mm_loadu_ps(ptr + 3 * step), 3);
+	}
+	FORCE_INLINE static void store_lanes(float* ptr, size_t step, type x) noexcept {
+		_mm_storeu_ps(ptr,            _mm512_castps512_ps128(x));
+		_mm_storeu_ps(ptr +     step, _mm512_extractf32x4_ps(x, 1));
+		_mm_storeu_ps(ptr + 2 * step, _mm512_extractf32x4_ps(x, 2));
+		_mm_storeu_ps(ptr + 3 * step, _mm512_extractf32x4_ps(x, 3));
+	}
+	FORCE_INLINE static void transpose4(type& a, type& b, type& c, type& d) noexcept {
+		__m512 t0 = _mm512_unpacklo_ps(a, b), t1 = _mm512_unpacklo_ps(c, d);
+		__m512 t2 = _mm512_unpackhi_ps(a, b), t3 = _mm512_unpackhi_ps(c, d);
+		a = _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(t0), _mm512_castps_pd(t1)));
+		b = _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(t0), _mm512_castps_pd(t1)));
+		c = _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(t2), _mm512_castps_pd(t3)));
+		d = _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(t2), _mm512_castps_pd(t3)));
+	}
+	FORCE_INLINE static void deinterleave2(const float* ptr, type& a, type& b) noexcept {
+		__m512 v0 = load_lanes(ptr, 8), v1 = load_lanes(ptr + 4, 8);
+		a = _mm512_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+		b = _mm512_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+	}
+	FORCE_INLINE static void deinterleave3(const float* ptr, type& a, type& b, type& c) noexcept {
+		__m512 v0 = load_lanes(ptr, 12), v1 = load_lanes(ptr + 4, 12), v2 = load_lanes(ptr + 8, 12);
+		__m512 ta = _mm512_mask_blend_ps(0x2222, _mm512_mask_blend_ps(0x4444, v0, v1), v2);
+		__m512 tb = _mm512_mask_blend_ps(0x4444, _mm512_mask_blend_ps(0x9999, v0, v1), v2);
+		__m512 tc = _mm512_mask_blend_ps(0x9999, _mm512_mask_blend_ps(0x2222, v0, v1), v2);
+		a = _mm512_shuffle_ps(ta, ta, _MM_SHUFFLE(1, 2, 3, 0));
+		b = _mm512_shuffle_ps(tb, tb, _MM_SHUFFLE(2, 3, 0, 1));
+		c = _mm512_shuffle_ps(tc, tc, _MM_SHUFFLE(3, 0, 1, 2));
+	}
+	FORCE_INLINE static void deinterleave4(const float* ptr, type& a, type& b, type& c, type& d) noexcept {
+		a = load_lanes(ptr, 16); b = load_lanes(ptr + 4, 16); c = load_lanes(ptr + 8, 16); d = load_lanes(ptr + 12, 16);
+		transpose4(a, b, c, d);
+	}
+	FORCE_INLINE static void interleave2(float* ptr, type a, type b) noexcept {
+		store_lanes(ptr,     8, _mm512_unpacklo_ps(a, b));
+		store_lanes(ptr + 4, 8, _mm512_unpackhi_ps(a, b));
+	}
+	FORCE_INLINE static void interleave3(float* ptr, type a, type b, type c) noexcept {
+		__m512 ta = _mm512_shuffle_ps(a, a, _MM_SHUFFLE(1, 2, 3, 0));
+		__m512 tb = _mm512_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1));
+		__m512 tc = _mm512_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 1, 2));
+		store_lanes(ptr,     12, _mm512_mask_blend_ps(0x4444, _mm512_mask_blend_ps(0x2222, ta, tb), tc));
+		store_lanes(ptr + 4, 12, _mm512_mask_blend_ps(0x4444, _mm512_mask_blend_ps(0x2222, tb, tc), ta));
+		store_lanes(ptr + 8, 12, _mm512_mask_blend_ps(0x4444, _mm512_mask_blend_ps(0x2222, tc, ta), tb));
+	}
+	FORCE_INLINE static void interleave4(float* ptr, type a, type b, type c, type d) noexcept {
+		transpose4(a, b, c, d);
+		store_lanes(ptr, 16, a); store_lanes(ptr + 4, 16, b); store_lanes(ptr + 8, 16, c); store_lanes(ptr + 12, 16, d);
+	}
+
+	// Indexed accesses, lane i being base[idx[i]]. Masked-off lanes are
+	// neither read nor written, and the highest lane is stored last
+	// when indices repeat.
+	FORCE_INLINE static type gather(const float* base, index idx) noexcept { return _mm512_i32gather_ps(idx, base, 4); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const float* base, index idx) noexcept { return _mm512_mask_i32gather_ps(src, m, idx, base, 4); }
+	FORCE_INLINE static void scatter(float* base, index idx, type x) noexcept { _mm512_i32scatter_ps(base, idx, x, 4); }
+	FORCE_INLINE static void mask_scatter(float* base, mask m, index idx, type x) noexcept { _mm512_mask_i32scatter_ps(base, m, idx, x, 4); }
+};
+
+template <>
+struct ComputeBackend<double, SIMDLevel::AVX512> {
+	using type = __m512d;
+	using mask = __mmask8; // One bit per lane, set where true
+	using index = __m512i; // Indices of gather() and scatter(), int64_t lanes
+	// SVML provides vectorized transcendental functions, but it
+	// is only shipped with MSVC and the Intel compilers. Unless
+	// VECTRA_USE_SVML is defined, we rely on in-house kernels.
+	#ifdef VECTRA_USE_SVML
+	FORCE_INLINE static type sin (type x)		  noexcept { return _mm512_sin_pd(x); }
+	FORCE_INLINE static type cos (type x)		  noexcept { return _mm512_cos_pd(x); }
+	// Since our approximation of arccos is not defined only over
+	// [-1 ; 1], we can then avoid the cost of clamping argument.
+	#ifndef HAS_MM_ACOS_PD
+	FORCE_INLINE static type acos(type x)		  noexcept { return _mm512_acos_pd(x); }
+	#else
+	FORCE_INLINE static type acos(type x)		  noexcept { return _mm512_acos_pd(_mm512_min_pd(_mm512_max_pd(x, _mm512_set1_pd(-1.0)), _mm512_set1_pd(1.0))); }
+	#endif
+	FORCE_INLINE static type asin(type x)		  noexcept { return _mm512_asin_pd(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return _mm512_atan_pd(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return _mm512_atan2_pd(y, x); }
+	FORCE_INLINE static type cbrt(type x)		  noexcept { return _mm512_cbrt_pd(x); }
+	FORCE_INLINE static type exp (type x)		  noexcept { return _mm512_exp_pd(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return _mm512_exp2_pd(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return _mm512_expm1_pd(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return _mm512_log_pd(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return _mm512_log2_pd(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return _mm512_log1p_pd(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return _mm512_pow_pd(a, b); }
+	#else
+	FORCE_INLINE static type sin (type x)		  noexcept { return math::sin<double, ComputeBackend>(x); }
+	FORCE_INLINE static type cos (type x)		  noexcept { return math::cos<double, ComputeBackend>(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return math::asin <double, ComputeBackend>(x); }
+	FORCE_INLINE static type acos(type x)		  noexcept { return math::acos <double, ComputeBackend>(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return math::atan <double, ComputeBackend>(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return math::atan2<double, ComputeBackend>(y, x); }
+	FORCE_INLINE static type cbrt(type x)		  noexcept { return math::cbrt <double, ComputeBackend>(x); }
+	FORCE_INLINE static type exp (type x)		  noexcept { return math::exp  <double, ComputeBackend>(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return math::exp2 <double, ComputeBackend>(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return math::expm1<double, ComputeBackend>(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return math::log  <double, ComputeBackend>(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return math::log2 <double, ComputeBackend>(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return math::log1p<double, ComputeBackend>(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return math::pow  <double, ComputeBackend>(a, b); }
+	#endif
+	FORCE_INLINE static type sqrt(type x)		  noexcept { return _mm512_sqrt_pd(x); }
+
+	// Estimates of 1/x and 1/sqrt(x), relative error below 2^-14,
+	// refined by two Newton steps (28 then 56 bits)
+	FORCE_INLINE static type rcp  (type x) noexcept { return _mm512_rcp14_pd(x); }
+	FORCE_INLINE static type rsqrt(type x) noexcept { return _mm512_rsqrt14_pd(x); }
+	FORCE_INLINE static type rcp_refined  (type x) noexcept { return math::rcp_newton  <double, ComputeBackend, 2>(x, rcp(x)); }
+	FORCE_INLINE static type rsqrt_refined(type x) noexcept { return math::rsqrt_newton<double, ComputeBackend, 2>(x, rsqrt(x)); }
+	FORCE_INLINE static type add (type a, type b) noexcept { return _mm512_add_pd(a, b); }
+	FORCE_INLINE static type sub (type a, type b) noexcept { return _mm512_sub_pd(a, b); }
+	FORCE_INLINE static type mul (type a, type b) noexcept { return _mm512_mul_pd(a, b); }
+	FORCE_INLINE static type div (type a, type b) noexcept { return _mm512_div_pd(a, b); }
+	FORCE_INLINE static type min (type a, type b) noexcept { return _mm512_min_pd(a, b); }
+	FORCE_INLINE static type max (type a, type b) noexcept { return _mm512_max_pd(a, b); }
+	FORCE_INLINE static type abs (type x)         noexcept { return _mm512_abs_pd(x); }
+	FORCE_INLINE static type round(type x)        noexcept { return _mm512_roundscale_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	FORCE_INLINE static type floor(type x)        noexcept { return _mm512_roundscale_pd(x, _MM_FROUND_TO_NEG_INF    | _MM_FROUND_NO_EXC); }
+
+	// Fused multiply-add primitives, rounded only once
+	FORCE_INLINE static constexpr bool has_fma() noexcept { return true; }
+	FORCE_INLINE static type fma (type a, type b, type c) noexcept { return _mm512_fmadd_pd (a, b, c); } //   a * b + c
+	FORCE_INLINE static type fms (type a, type b, type c) noexcept { return _mm512_fmsub_pd (a, b, c); } //   a * b - c
+	FORCE_INLINE static type fnma(type a, type b, type c) noexcept { return _mm512_fnmadd_pd(a, b, c); } // -(a * b) + c
+
+	// Bitwise operations on the IEEE-754 representation
+	// NB: the floating point forms require AVX512DQ
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm512_and_pd   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm512_or_pd    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm512_xor_pd   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm512_andnot_pd(a, b); } // ~a & b
+
+	// Exponent manipulation, with the dedicated AVX-512 instructions
+	// NB: unlike the other backends, subnormal values are supported
+	FORCE_INLINE static type getexp (type x) noexcept { return _mm512_getexp_pd(x); } // floor(log2(x))
+	FORCE_INLINE static type getmant(type x) noexcept { return _mm512_getmant_pd(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); } // In [1 ; 2[
+	FORCE_INLINE static type exp2i  (type n) noexcept { return _mm512_scalef_pd(_mm512_set1_pd(1.0), n); } // 2^n
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_NEQ_UQ); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm512_mask_blend_pd(m, b, a); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return static_cast<mask>(a & b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return static_cast<mask>(a | b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return static_cast<mask>(~m); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return m; }
+	FORCE_INLINE static bool any(mask m)              noexcept { return m != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return m == 0xFFu; }
+
+	FORCE_INLINE static type one()				  noexcept { return _mm512_set1_pd(1.0); }
+	FORCE_INLINE static type zero()				  noexcept { return _mm512_setzero_pd(); }
+	FORCE_INLINE static type half_pi()			  noexcept { return _mm512_set1_pd(HALF_PI_D); }
+	FORCE_INLINE static type pi()			      noexcept { return _mm512_set1_pd(PI_D); }
+	FORCE_INLINE static type two_pi()			  noexcept { return _mm512_set1_pd(TWO_PI_D); }
+
+	// Conversion function from scalar value to SIMD
+	FORCE_INLINE static type set(double x) noexcept { return _mm512_set1_pd(x); }
+
+	// Horizontal sum function. The two halves are added, and
+	// the AVX backend finishes the reduction.
+	FORCE_INLINE static double hsum(type x) {
+		__m256d vlow  = _mm512_castpd512_pd256(x);
+		__m256d vhigh = _mm512_extractf64x4_pd(x, 1);
+		vlow = _mm256_add_pd(vlow, vhigh);
+
+		return ComputeBackend<double, SIMDLevel::AVX>::hsum(vlow);
+	}
+
+	// Returns the SIMD register width, in terms of
+	// the number of elements processed in parallel
+	FORCE_INLINE static constexpr size_t width() noexcept { return 8; }
+
+	// Returns the memory alignment for the register 
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Loads value from pointer to associated data type
+	FORCE_INLINE static type loadu(const double* FORCE_RESTRICT ptr) noexcept { return _mm512_loadu_pd(ptr); } // Unaligned
+	FORCE_INLINE static type loada(const double* FORCE_RESTRICT ptr) noexcept { return _mm512_load_pd (ptr); } // Aligned
+
+	// Unloads SIMD value to scalar buffers
+	FORCE_INLINE static void unloadu(double* FORCE_RESTRICT ptr, type x) { _mm512_storeu_pd(ptr, x); } // Unaligned
+	FORCE_INLINE static void unloada(double* FORCE_RESTRICT ptr, type x) { _mm512_store_pd (ptr, x); } // Aligned
+
+	// Non-temporal store to aligned memory, bypassing the caches, for
+	// write-once outputs larger than the last level cache. Streamed
+	// stores are only ordered with the other ones after sfence().
+	FORCE_INLINE static void stream(double* FORCE_RESTRICT ptr, type x) noexcept { _mm512_stream_pd(ptr, x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+
+	// Fetches the cache line of ptr into every cache level
+	FORCE_INLINE static void prefetch(const double* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+
+	// Partial loads and stores of the first n < width() lanes, for
+	// array tails. Masked lanes are never accessed, so reading past
+	// the end of the array cannot fault; they are loaded as zeros.
+	FORCE_INLINE static mask tail_mask(size_t n) noexcept { return static_cast<mask>((1u << n) - 1u); }
+	FORCE_INLINE static type loadu_partial(const double* FORCE_RESTRICT ptr, size_t n) noexcept { return _mm512_maskz_loadu_pd(tail_mask(n), ptr); }
+	FORCE_INLINE static void unloadu_partial(double* FORCE_RESTRICT ptr, type x, size_t n) noexcept { _mm512_mask_storeu_pd(ptr, tail_mask(n), x); }
+
+	// Interleaved records (a0 b0 a1 b1 ... for two components), one
+	// register of records per call, loaded as one register per
+	// component by deinterleaveN and stored back by interleaveN.
+	// Each 128-bit lane holds 2 records and follows the SSE4.1
+	// algorithm, lane j being loaded from ptr + j * step.
+	FORCE_INLINE static type load_lanes(const double* ptr, size_t step) noexcept {
+		__m512d x = _mm512_castpd128_pd512(_mm_loadu_pd(ptr));
+		x = _mm512_insertf64x2(x, _mm_loadu_pd(ptr +     step), 1);
+		x = _mm512_insertf64x2(x, _mm_loadu_pd(ptr + 2 * step), 2);
+		return _mm512_insertf64x2(x, _mm_loadu_pd(ptr + 3 * step), 3);
+	}
+	FORCE_INLINE static void store_lanes(double* ptr, size_t step, type x) noexcept {
+		_mm_storeu_pd(ptr,            _mm512_castpd512_pd128(x));
+		_mm_storeu_pd(ptr +     step, _mm512_extractf64x2_pd(x, 1));
+		_mm_storeu_pd(ptr + 2 * step, _mm512_extractf64x2_pd(x, 2));
+		_mm_storeu_pd(ptr + 3 * step, _mm512_extractf64x2_pd(x, 3));
+	}
+	FORCE_INLINE static void deinterleave2(const double* ptr, type& a, type& b) noexcept {
+		__m512d v0 = load_lanes(ptr, 4), v1 = load_lanes(ptr + 2, 4);
+		a = _mm512_unpacklo_pd(v0, v1);
+		b = _mm512_unpackhi_pd(v0, v1);
+	}
+	FORCE_INLINE static void deinterleave3(const double* ptr, type& a, type& b, type& c) noexcept {
+		__m512d v0 = load_lanes(ptr, 6), v1 = load_lanes(ptr + 2, 6), v2 = load_lanes(ptr + 4, 6);
+		a = _mm512_mask_blend_pd(0xAA, v0, v1);
+		b = _mm512_shuffle_pd(v0, v2, 0x55);
+		c = _mm512_mask_blend_pd(0xAA, v1, v2);
+	}
+	FORCE_INLINE static void deinterleave4(const double* ptr, type& a, type& b, type& c, type& d) noexcept {
+		__m512d v0 = load_lanes(ptr, 8), v1 = load_lanes(ptr + 2, 8), v2 = load_lanes(ptr + 4, 8), v3 = load_lanes(ptr + 6, 8);
+		a = _mm512_unpacklo_pd(v0, v2); b = _mm512_unpackhi_pd(v0, v2);
+		c = _mm512_unpacklo_pd(v1, v3); d = _mm512_unpackhi_pd(v1, v3);
+	}
+	FORCE_INLINE static void interleave2(double* ptr, type a, type b) noexcept {
+		store_lanes(ptr,     4, _mm512_unpacklo_pd(a, b));
+		store_lanes(ptr + 2, 4, _mm512_unpackhi_pd(a, b));
+	}
+	FORCE_INLINE static void interleave3(double* ptr, type a, type b, type c) noexcept {
+		store_lanes(ptr,     6, _mm512_unpacklo_pd(a, b));
+		store_lanes(ptr + 2, 6, _mm512_mask_blend_pd(0xAA, c, a));
+		store_lanes(ptr + 4, 6, _mm512_unpackhi_pd(b, c));
+	}
+	FORCE_INLINE static void interleave4(double* ptr, type a, type b, type c, type d) noexcept {
+		store_lanes(ptr,     8, _mm512_unpacklo_pd(a, b)); store_lanes(ptr + 2, 8, _mm512_unpacklo_pd(c, d));
+		store_lanes(ptr + 4, 8, _mm512_unpackhi_pd(a, b)); store_lanes(ptr + 6, 8, _mm512_unpackhi_pd(c, d));
+	}
+
+	// Indexed accesses, lane i being base[idx[i]]. Masked-off lanes are
+	// neither read nor written, and the highest lane is stored last
+	// when indices repeat.
+	FORCE_INLINE static type gather(const double* base, index idx) noexcept { return _mm512_i64gather_pd(idx, base, 8); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const double* base, index idx) noexcept { return _mm512_mask_i64gather_pd(src, m, idx, base, 8); }
+	FORCE_INLINE static void scatter(double* base, index idx, type x) noexcept { _mm512_i64scatter_pd(base, idx, x, 8); }
+	FORCE_INLINE static void mask_scatter(double* base, mask m, index idx, type x) noexcept { _mm512_mask_i64scatter_pd(base, m, idx, x, 8); }
+};
+
+// Integer lanes, see the scalar backend for their semantics
+template <>
+struct ComputeBackend<std::int32_t, SIMDLevel::AVX512> {
+	using type     = __m512i;
+	using mask     = __mmask16; // One bit per lane, set where true
+	using index    = __m512i; // Indices of gather() and scatter(), int32_t lanes
+	using floating = __m512;
+
+	FORCE_INLINE static type add(type a, type b) noexcept { return _mm512_add_epi32  (a, b); }
+	FORCE_INLINE static type sub(type a, type b) noexcept { return _mm512_sub_epi32  (a, b); }
+	FORCE_INLINE static type mul(type a, type b) noexcept { return _mm512_mullo_epi32(a, b); }
+	FORCE_INLINE static type min(type a, type b) noexcept { return _mm512_min_epi32  (a, b); }
+	FORCE_INLINE static type max(type a, type b) noexcept { return _mm512_max_epi32  (a, b); }
+	FORCE_INLINE static type abs(type x)         noexcept { return _mm512_abs_epi32  (x); }
+
+	// Shifts by n in [0 ; 32[, shr() being arithmetic
+	FORCE_INLINE static type shl        (type x, int n) noexcept { return _mm512_sll_epi32(x, _mm_cvtsi32_si128(n)); }
+	FORCE_INLINE static type shr        (type x, int n) noexcept { return _mm512_sra_epi32(x, _mm_cvtsi32_si128(n)); }
+	FORCE_INLINE static type shr_logical(type x, int n) noexcept { return _mm512_srl_epi32(x, _mm_cvtsi32_si128(n)); }
+
+	// Bitwise operations
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm512_and_si512   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm512_or_si512    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm512_xor_si512   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm512_andnot_si512(a, b); } // ~a & b
+	FORCE_INLINE static type bit_not   (type x)         noexcept { return _mm512_ternarylogic_epi32(x, x, x, 0x55); }
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm512_cmp_epi32_mask(a, b, _MM_CMPINT_EQ); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return _mm512_cmp_epi32_mask(a, b, _MM_CMPINT_LT); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return _mm512_cmp_epi32_mask(a, b, _MM_CMPINT_LE); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return _mm512_cmp_epi32_mask(a, b, _MM_CMPINT_NE); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm512_cmp_epi32_mask(a, b, _MM_CMPINT_NLE); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return _mm512_cmp_epi32_mask(a, b, _MM_CMPINT_NLT); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm512_mask_blend_epi32(m, b, a); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return static_cast<mask>(a & b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return static_cast<mask>(a | b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return static_cast<mask>(~m); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return m; }
+	FORCE_INLINE static bool any(mask m)              noexcept { return m != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return m == 0xFFFFu; }
+
+	FORCE_INLINE static type one()  noexcept { return _mm512_set1_epi32(1); }
+	FORCE_INLINE static type zero() noexcept { return _mm512_setzero_si512(); }
+	FORCE_INLINE static type set(std::int32_t x) noexcept { return _mm512_set1_epi32(x); }
+
+	// Wrapping sum of the lanes
+	FORCE_INLINE static std::int32_t hsum(type x) noexcept { return _mm512_reduce_add_epi32(x); }
+
+	FORCE_INLINE static constexpr size_t width() noexcept { return 16; }
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Memory operations, see the float backend
+	FORCE_INLINE static type loadu(const std::int32_t* FORCE_RESTRICT ptr) noexcept { return _mm512_loadu_si512(ptr); }
+	FORCE_INLINE static type loada(const std::int32_t* FORCE_RESTRICT ptr) noexcept { return _mm512_load_si512 (ptr); }
+	FORCE_INLINE static void unloadu(std::int32_t* FORCE_RESTRICT ptr, type x) noexcept { _mm512_storeu_si512(ptr, x); }
+	FORCE_INLINE static void unloada(std::int32_t* FORCE_RESTRICT ptr, type x) noexcept { _mm512_store_si512 (ptr, x); }
+	FORCE_INLINE static void stream (std::int32_t* FORCE_RESTRICT ptr, type x) noexcept { _mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+	FORCE_INLINE static void prefetch(const std::int32_t* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+	FORCE_INLINE static mask tail_mask(size_t n) noexcept { return static_cast<mask>((1u << n) - 1u); }
+	FORCE_INLINE static type loadu_partial(const std::int32_t* FORCE_RESTRICT ptr, size_t n) noexcept { return _mm512_maskz_loadu_epi32(tail_mask(n), ptr); }
+	FORCE_INLINE static void unloadu_partial(std::int32_t* FORCE_RESTRICT ptr, type x, size_t n) noexcept { _mm512_mask_storeu_epi32(ptr, tail_mask(n), x); }
+
+	// Conversions with float lanes
+	FORCE_INLINE static type from_float      (floating x) noexcept { return _mm512_cvtps_epi32 (x); }
+	FORCE_INLINE static type from_float_trunc(floating x) noexcept { return _mm512_cvttps_epi32(x); }
+	FORCE_INLINE static floating to_float(type x) noexcept { return _mm512_cvtepi32_ps(x); }
+
+	// Indexed accesses, lane i being base[idx[i]]. Masked-off lanes are
+	// neither read nor written, and the highest lane is stored last
+	// when indices repeat.
+	FORCE_INLINE static type gather(const std::int32_t* base, index idx) noexcept { return _mm512_i32gather_epi32(idx, base, 4); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const std::int32_t* base, index idx) noexcept { return _mm512_mask_i32gather_epi32(src, m, idx, base, 4); }
+	FORCE_INLINE static void scatter(std::int32_t* base, index idx, type x) noexcept { _mm512_i32scatter_epi32(base, idx, x, 4); }
+	FORCE_INLINE static void mask_scatter(std::int32_t* base, mask m, index idx, type x) noexcept { _mm512_mask_i32scatter_epi32(base, m, idx, x, 4); }
+};
+
+template <>
+struct ComputeBackend<std::int64_t, SIMDLevel::AVX512> {
+	using type     = __m512i;
+	using mask     = __mmask8; // One bit per lane, set where true
+	using index    = __m512i; // Indices of gather() and scatter(), int64_t lanes
+	using floating = __m512d;
+
+	FORCE_INLINE static type add(type a, type b) noexcept { return _mm512_add_epi64  (a, b); }
+	FORCE_INLINE static type sub(type a, type b) noexcept { return _mm512_sub_epi64  (a, b); }
+	FORCE_INLINE static type mul(type a, type b) noexcept { return _mm512_mullo_epi64(a, b); }
+	FORCE_INLINE static type min(type a, type b) noexcept { return _mm512_min_epi64  (a, b); }
+	FORCE_INLINE static type max(type a, type b) noexcept { return _mm512_max_epi64  (a, b); }
+	FORCE_INLINE static type abs(type x)         noexcept { return _mm512_abs_epi64  (x); }
+
+	// Shifts by n in [0 ; 64[, shr() being arithmetic
+	FORCE_INLINE static type shl        (type x, int n) noexcept { return _mm512_sll_epi64(x, _mm_cvtsi32_si128(n)); }
+	FORCE_INLINE static type shr        (type x, int n) noexcept { return _mm512_sra_epi64(x, _mm_cvtsi32_si128(n)); }
+	FORCE_INLINE static type shr_logical(type x, int n) noexcept { return _mm512_srl_epi64(x, _mm_cvtsi32_si128(n)); }
+
+	// Bitwise operations
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm512_and_si512   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm512_or_si512    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm512_xor_si512   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm512_andnot_si512(a, b); } // ~a & b
+	FORCE_INLINE static type bit_not   (type x)         noexcept { return _mm512_ternarylogic_epi64(x, x, x, 0x55); }
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm512_cmp_epi64_mask(a, b, _MM_CMPINT_EQ); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return _mm512_cmp_epi64_mask(a, b, _MM_CMPINT_LT); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return _mm512_cmp_epi64_mask(a, b, _MM_CMPINT_LE); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return _mm512_cmp_epi64_mask(a, b, _MM_CMPINT_NE); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm512_cmp_epi64_mask(a, b, _MM_CMPINT_NLE); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return _mm512_cmp_epi64_mask(a, b, _MM_CMPINT_NLT); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm512_mask_blend_epi64(m, b, a); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return static_cast<mask>(a & b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return static_cast<mask>(a | b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return static_cast<mask>(~m); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return m; }
+	FORCE_INLINE static bool any(mask m)              noexcept { return m != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return m == 0xFFu; }
+
+	FORCE_INLINE static type one()  noexcept { return _mm512_set1_epi64(1); }
+	FORCE_INLINE static type zero() noexcept { return _mm512_setzero_si512(); }
+	FORCE_INLINE static type set(std::int64_t x) noexcept { return _mm512_set1_epi64(x); }
+
+	// Wrapping sum of the lanes
+	FORCE_INLINE static std::int64_t hsum(type x) noexcept { return _mm512_reduce_add_epi64(x); }
+
+	FORCE_INLINE static constexpr size_t width() noexcept { return 8; }
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Memory operations, see the float backend
+	FORCE_INLINE static type loadu(const std::int64_t* FORCE_RESTRICT ptr) noexcept { return _mm512_loadu_si512(ptr); }
+	FORCE_INLINE static type loada(const std::int64_t* FORCE_RESTRICT ptr) noexcept { return _mm512_load_si512 (ptr); }
+	FORCE_INLINE static void unloadu(std::int64_t* FORCE_RESTRICT ptr, type x) noexcept { _mm512_storeu_si512(ptr, x); }
+	FORCE_INLINE static void unloada(std::int64_t* FORCE_RESTRICT ptr, type x) noexcept { _mm512_store_si512 (ptr, x); }
+	FORCE_INLINE static void stream (std::int64_t* FORCE_RESTRICT ptr, type x) noexcept { _mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+	FORCE_INLINE static void prefetch(const std::int64_t* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+	FORCE_INLINE static mask tail_mask(size_t n) noexcept { return static_cast<mask>((1u << n) - 1u); }
+	FORCE_INLINE static type loadu_partial(const std::int64_t* FORCE_RESTRICT ptr, size_t n) noexcept { return _mm512_maskz_loadu_epi64(tail_mask(n), ptr); }
+	FORCE_INLINE static void unloadu_partial(std::int64_t* FORCE_RESTRICT ptr, type x, size_t n) noexcept { _mm512_mask_storeu_epi64(ptr, tail_mask(n), x); }
+
+	// Conversions with double lanes, over the whole range with AVX512DQ
+	FORCE_INLINE static type from_float      (floating x) noexcept { return _mm512_cvtpd_epi64 (x); }
+	FORCE_INLINE static type from_float_trunc(floating x) noexcept { return _mm512_cvttpd_epi64(x); }
+	FORCE_INLINE static floating to_float(type x) noexcept { return _mm512_cvtepi64_pd(x); }
+
+	// Indexed accesses, lane i being base[idx[i]]. Masked-off lanes are
+	// neither read nor written, and the highest lane is stored last
+	// when indices repeat.
+	FORCE_INLINE static type gather(const std::int64_t* base, index idx) noexcept { return _mm512_i64gather_epi64(idx, base, 8); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const std::int64_t* base, index idx) noexcept { return _mm512_mask_i64gather_epi64(src, m, idx, base, 8); }
+	FORCE_INLINE static void scatter(std::int64_t* base, index idx, type x) noexcept { _mm512_i64scatter_epi64(base, idx, x, 8); }
+	FORCE_INLINE static void mask_scatter(std::int64_t* base, mask m, index idx, type x) noexcept { _mm512_mask_i64scatter_epi64(base, m, idx, x, 8); }
+};
+
+}
\ No newline at end of file
@@ -12,4 +12,6 @@ struct ComputeBackend;
 
 #include <vectra/backend/none.hpp>
 #include <vectra/backend/sse41.hpp>
-#include <vectra/backend/avx.hpp>
\ No newline at end of file
+#include <vectra/backend/avx.hpp>
+#include <vectra/backend/avx2.hpp>
+#include <vectra/backend/avx512.hpp>
\ No newline at end of file
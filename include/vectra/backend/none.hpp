@@ -2,11 +2,14 @@
 
 
 #include <cmath>
+#include <cstdint>
 
 
 #include <vectra/core/simd_level.hpp>
 #include <vectra/core/attributes.hpp>
 #include <vectra/core/constants.hpp>
+#include <vectra/core/half.hpp>
+#include <vectra/detail/bit_cast.hpp>
 
 
 namespace vectra {
@@ -14,12 +17,30 @@ namespace vectra {
 template <>
 struct ComputeBackend<float, SIMDLevel::None> {
 	using type = float;
+	using mask = bool;
+	using index = std::int32_t; // Indices of gather() and scatter()
 	FORCE_INLINE static type sin (type x)		  noexcept { return std::sin(x); }
 	FORCE_INLINE static type cos (type x)		  noexcept { return std::cos(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return std::asin(x); }
 	FORCE_INLINE static type acos(type x)		  noexcept { return std::acos(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return std::atan(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return std::atan2(y, x); }
 	FORCE_INLINE static type sqrt(type x)		  noexcept { return std::sqrt(x); }
+
+	// Scalar reciprocals are computed exactly, estimates and refined
+	// variants being the correctly rounded 1/x and 1/sqrt(x)
+	FORCE_INLINE static type rcp  (type x) noexcept { return float(1) / x; }
+	FORCE_INLINE static type rsqrt(type x) noexcept { return float(1) / std::sqrt(x); }
+	FORCE_INLINE static type rcp_refined  (type x) noexcept { return rcp(x); }
+	FORCE_INLINE static type rsqrt_refined(type x) noexcept { return rsqrt(x); }
 	FORCE_INLINE static type cbrt(type x)		  noexcept { return std::cbrt(x); }
 	FORCE_INLINE static type exp (type x)		  noexcept { return std::exp(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return std::exp2(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return std::expm1(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return std::log(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return std::log2(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return std::log1p(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return std::pow(a, b); }
 	FORCE_INLINE static type add (type a, type b) noexcept { return a + b; }
 	FORCE_INLINE static type sub (type a, type b) noexcept { return a - b; }
 	FORCE_INLINE static type mul (type a, type b) noexcept { return a * b; }
@@ -27,6 +48,44 @@ struct ComputeBackend<float, SIMDLevel::None> {
 	FORCE_INLINE static type min (type a, type b) noexcept { return a < b ? a : b; }
 	FORCE_INLINE static type max (type a, type b) noexcept { return a > b ? a : b; }
 	FORCE_INLINE static type abs (type x)         noexcept { return std::fabs(x); }
+	FORCE_INLINE static type round(type x)        noexcept { return std::nearbyint(x); }
+	FORCE_INLINE static type floor(type x)        noexcept { return std::floor(x); }
+
+	// Multiply-add primitives, rounded twice. std::fma would be
+	// exact, but is a slow library call on targets without FMA.
+	FORCE_INLINE static constexpr bool has_fma() noexcept { return false; }
+	FORCE_INLINE static type fma (type a, type b, type c) noexcept { return a * b + c; }    //   a * b + c
+	FORCE_INLINE static type fms (type a, type b, type c) noexcept { return a * b - c; }    //   a * b - c
+	FORCE_INLINE static type fnma(type a, type b, type c) noexcept { return c - a * b; }    // -(a * b) + c
+
+	// Bitwise operations on the IEEE-754 representation
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return detail::bit_cast<type>( detail::bit_cast<std::uint32_t>(a) & detail::bit_cast<std::uint32_t>(b)); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return detail::bit_cast<type>( detail::bit_cast<std::uint32_t>(a) | detail::bit_cast<std::uint32_t>(b)); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return detail::bit_cast<type>( detail::bit_cast<std::uint32_t>(a) ^ detail::bit_cast<std::uint32_t>(b)); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return detail::bit_cast<type>(~detail::bit_cast<std::uint32_t>(a) & detail::bit_cast<std::uint32_t>(b)); } // ~a & b
+
+	// Exponent manipulation, for positive normal values x and for
+	// integral values n in the normal exponent range
+	FORCE_INLINE static type getexp (type x) noexcept { return static_cast<type>(std::ilogb(x)); } // floor(log2(x))
+	FORCE_INLINE static type getmant(type x) noexcept { return std::scalbn(std::fabs(x), -std::ilogb(x)); } // In [1 ; 2[
+	FORCE_INLINE static type exp2i  (type n) noexcept { return std::ldexp(type(1), static_cast<int>(n)); } // 2^n
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return a == b; }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return a <  b; }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return a <= b; }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return a != b; }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return a >  b; }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return a >= b; }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return m ? a : b; }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return a && b; }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return a || b; }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return !m; }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return m ? 1u : 0u; }
+	FORCE_INLINE static bool any(mask m)              noexcept { return m; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return m; }
 
 	FORCE_INLINE static constexpr type one()	  noexcept { return 1.f; }
 	FORCE_INLINE static constexpr type zero()	  noexcept { return 0.f; }
@@ -59,17 +118,77 @@ struct ComputeBackend<float, SIMDLevel::None> {
 	FORCE_INLINE static void unloadu(float* ptr, type x) noexcept { *ptr = x; }
 	FORCE_INLINE static void unloada(float* ptr, type x) noexcept { *ptr = x; }
 
+	// Streaming stores are regular ones, and need no fence. Prefetch
+	// is a compiler hint where available.
+	FORCE_INLINE static void stream(float* ptr, type x) noexcept { *ptr = x; }
+	FORCE_INLINE static void sfence() noexcept {}
+	FORCE_INLINE static void prefetch(const float* ptr) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(ptr);
+#else
+		(void)ptr;
+#endif
+	}
+
+	// Partial loads and stores of the first n < width() lanes. With
+	// a single lane, n is always 0 and memory is never accessed.
+	FORCE_INLINE static type loadu_partial(const float* ptr, size_t n) noexcept { return n ? *ptr : type(0); }
+	FORCE_INLINE static void unloadu_partial(float* ptr, type x, size_t n) noexcept { if (n) *ptr = x; }
+
+	// 16-bit storage (see half.hpp), widened to float and narrowed back
+	FORCE_INLINE static type loadu(const half*     ptr) noexcept { return detail::halfToFloat    (ptr->bits); }
+	FORCE_INLINE static type loadu(const bfloat16* ptr) noexcept { return detail::bfloat16ToFloat(ptr->bits); }
+	FORCE_INLINE static void unloadu(half*     ptr, type x) noexcept { ptr->bits = detail::floatToHalf    (x); }
+	FORCE_INLINE static void unloadu(bfloat16* ptr, type x) noexcept { ptr->bits = detail::floatToBfloat16(x); }
+	FORCE_INLINE static type loadu_partial(const half*     ptr, size_t n) noexcept { return n ? loadu(ptr) : type(0); }
+	FORCE_INLINE static type loadu_partial(const bfloat16* ptr, size_t n) noexcept { return n ? loadu(ptr) : type(0); }
+	FORCE_INLINE static void unloadu_partial(half*     ptr, type x, size_t n) noexcept { if (n) unloadu(ptr, x); }
+	FORCE_INLINE static void unloadu_partial(bfloat16* ptr, type x, size_t n) noexcept { if (n) unloadu(ptr, x); }
+
+	// Interleaved records (a0 b0 a1 b1 ... for two components), one
+	// register of records per call, loaded as one register per
+	// component by deinterleaveN and stored back by interleaveN.
+	FORCE_INLINE static void deinterleave2(const float* ptr, type& a, type& b)                  noexcept { a = ptr[0]; b = ptr[1]; }
+	FORCE_INLINE static void deinterleave3(const float* ptr, type& a, type& b, type& c)         noexcept { a = ptr[0]; b = ptr[1]; c = ptr[2]; }
+	FORCE_INLINE static void deinterleave4(const float* ptr, type& a, type& b, type& c, type& d) noexcept { a = ptr[0]; b = ptr[1]; c = ptr[2]; d = ptr[3]; }
+	FORCE_INLINE static void interleave2(float* ptr, type a, type b)                 noexcept { ptr[0] = a; ptr[1] = b; }
+	FORCE_INLINE static void interleave3(float* ptr, type a, type b, type c)         noexcept { ptr[0] = a; ptr[1] = b; ptr[2] = c; }
+	FORCE_INLINE static void interleave4(float* ptr, type a, type b, type c, type d) noexcept { ptr[0] = a; ptr[1] = b; ptr[2] = c; ptr[3] = d; }
+
+	// Indexed accesses, lane i being base[idx[i]]
+	FORCE_INLINE static type gather(const float* base, index idx) noexcept { return base[idx]; }
+	FORCE_INLINE static type mask_gather(type src, mask m, const float* base, index idx) noexcept { return m ? base[idx] : src; }
+	FORCE_INLINE static void scatter(float* base, index idx, type x) noexcept { base[idx] = x; }
+	FORCE_INLINE static void mask_scatter(float* base, mask m, index idx, type x) noexcept { if (m) base[idx] = x; }
 };
 
 template <>
 struct ComputeBackend<double, SIMDLevel::None> {
 	using type = double;
+	using mask = bool;
+	using index = std::int64_t; // Indices of gather() and scatter()
 	FORCE_INLINE static type sin (type x)		  noexcept { return std::sin (x); }
 	FORCE_INLINE static type cos (type x)		  noexcept { return std::cos (x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return std::asin(x); }
 	FORCE_INLINE static type acos(type x)		  noexcept { return std::acos(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return std::atan(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return std::atan2(y, x); }
 	FORCE_INLINE static type sqrt(type x)		  noexcept { return std::sqrt(x); }
+
+	// Scalar reciprocals are computed exactly, estimates and refined
+	// variants being the correctly rounded 1/x and 1/sqrt(x)
+	FORCE_INLINE static type rcp  (type x) noexcept { return double(1) / x; }
+	FORCE_INLINE static type rsqrt(type x) noexcept { return double(1) / std::sqrt(x); }
+	FORCE_INLINE static type rcp_refined  (type x) noexcept { return rcp(x); }
+	FORCE_INLINE static type rsqrt_refined(type x) noexcept { return rsqrt(x); }
 	FORCE_INLINE static type cbrt(type x)		  noexcept { return std::cbrt(x); }
 	FORCE_INLINE static type exp (type x)		  noexcept { return std::exp (x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return std::exp2(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return std::expm1(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return std::log (x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return std::log2(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return std::log1p(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return std::pow(a, b); }
 	FORCE_INLINE static type add (type a, type b) noexcept { return a + b; }
 	FORCE_INLINE static type sub (type a, type b) noexcept { return a - b; }
 	FORCE_INLINE static type mul (type a, type b) noexcept { return a * b; }
@@ -77,6 +196,44 @@ struct ComputeBackend<double, SIMDLevel::None> {
 	FORCE_INLINE static type min (type a, type b) noexcept { return a < b ? a : b; }
 	FORCE_INLINE static type max (type a, type b) noexcept { return a > b ? a : b; }
 	FORCE_INLINE static type abs (type x)         noexcept { return std::fabs(x); }
+	FORCE_INLINE static type round(type x)        noexcept { return std::nearbyint(x); }
+	FORCE_INLINE static type floor(type x)        noexcept { return std::floor(x); }
+
+	// Multiply-add primitives, rounded twice. std::fma would be
+	// exact, but is a slow library call on targets without FMA.
+	FORCE_INLINE static constexpr bool has_fma() noexcept { return false; }
+	FORCE_INLINE static type fma (type a, type b, type c) noexcept { return a * b + c; }    //   a * b + c
+	FORCE_INLINE static type fms (type a, type b, type c) noexcept { return a * b - c; }    //   a * b - c
+	FORCE_INLINE static type fnma(type a, type b, type c) noexcept { return c - a * b; }    // -(a * b) + c
+
+	// Bitwise operations on the IEEE-754 representation
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return detail::bit_cast<type>( detail::bit_cast<std::uint64_t>(a) & detail::bit_cast<std::uint64_t>(b)); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return detail::bit_cast<type>( detail::bit_cast<std::uint64_t>(a) | detail::bit_cast<std::uint64_t>(b)); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return detail::bit_cast<type>( detail::bit_cast<std::uint64_t>(a) ^ detail::bit_cast<std::uint64_t>(b)); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return detail::bit_cast<type>(~detail::bit_cast<std::uint64_t>(a) & detail::bit_cast<std::uint64_t>(b)); } // ~a & b
+
+	// Exponent manipulation, for positive normal values x and for
+	// integral values n in the normal exponent range
+	FORCE_INLINE static type getexp (type x) noexcept { return static_cast<type>(std::ilogb(x)); } // floor(log2(x))
+	FORCE_INLINE static type getmant(type x) noexcept { return std::scalbn(std::fabs(x), -std::ilogb(x)); } // In [1 ; 2[
+	FORCE_INLINE static type exp2i  (type n) noexcept { return std::ldexp(type(1), static_cast<int>(n)); } // 2^n
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return a == b; }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return a <  b; }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return a <= b; }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return a != b; }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return a >  b; }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return a >= b; }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return m ? a : b; }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return a && b; }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return a || b; }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return !m; }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return m ? 1u : 0u; }
+	FORCE_INLINE static bool any(mask m)              noexcept { return m; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return m; }
 
 	FORCE_INLINE static constexpr type one()	  noexcept { return 1.; }
 	FORCE_INLINE static constexpr type zero()	  noexcept { return 0.; }
@@ -108,6 +265,200 @@ struct ComputeBackend<double, SIMDLevel::None> {
 	// for scalar data, added here for compatibility
 	FORCE_INLINE static void unloadu(double* ptr, type x) noexcept { *ptr = x; }
 	FORCE_INLINE static void unloada(double* ptr, type x) noexcept { *ptr = x; }
+
+	// Streaming stores are regular ones, and need no fence. Prefetch
+	// is a compiler hint where available.
+	FORCE_INLINE static void stream(double* ptr, type x) noexcept { *ptr = x; }
+	FORCE_INLINE static void sfence() noexcept {}
+	FORCE_INLINE static void prefetch(const double* ptr) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(ptr);
+#else
+		(void)ptr;
+#endif
+	}
+
+	// Partial loads and stores of the first n < width() lanes. With
+	// a single lane, n is always 0 and memory is never accessed.
+	FORCE_INLINE static type loadu_partial(const double* ptr, size_t n) noexcept { return n ? *ptr : type(0); }
+	FORCE_INLINE static void unloadu_partial(double* ptr, type x, size_t n) noexcept { if (n) *ptr = x; }
+
+	// Interleaved records (a0 b0 a1 b1 ... for two components), one
+	// register of records per call, loaded as one register per
+	// component by deinterleaveN and stored back by interleaveN.
+	FORCE_INLINE static void deinterleave2(const double* ptr, type& a, type& b)                  noexcept { a = ptr[0]; b = ptr[1]; }
+	FORCE_INLINE static void deinterleave3(const double* ptr, type& a, type& b, type& c)         noexcept { a = ptr[0]; b = ptr[1]; c = ptr[2]; }
+	FORCE_INLINE static void deinterleave4(const double* ptr, type& a, type& b, type& c, type& d) noexcept { a = ptr[0]; b = ptr[1]; c = ptr[2]; d = ptr[3]; }
+	FORCE_INLINE static void interleave2(double* ptr, type a, type b)                 noexcept { ptr[0] = a; ptr[1] = b; }
+	FORCE_INLINE static void interleave3(double* ptr, type a, type b, type c)         noexcept { ptr[0] = a; ptr[1] = b; ptr[2] = c; }
+	FORCE_INLINE static void interleave4(double* ptr, type a, type b, type c, type d) noexcept { ptr[0] = a; ptr[1] = b; ptr[2] = c; ptr[3] = d; }
+
+	// Indexed accesses, lane i being base[idx[i]]
+	FORCE_INLINE static type gather(const double* base, index idx) noexcept { return base[idx]; }
+	FORCE_INLINE static type mask_gather(type src, mask m, const double* base, index idx) noexcept { return m ? base[idx] : src; }
+	FORCE_INLINE static void scatter(double* base, index idx, type x) noexcept { base[idx] = x; }
+	FORCE_INLINE static void mask_scatter(double* base, mask m, index idx, type x) noexcept { if (m) base[idx] = x; }
+};
+
+/*
+ * Integer lanes, for index arithmetic, bucketing, hashing and
+ * quantization next to the floating-point kernels. Arithmetic wraps
+ * around in two's complement, shift counts are in [0 ; bits[ and >>
+ * is arithmetic. Each integer type converts with the floating-point
+ * type of the same width, float for int32_t and double for int64_t:
+ * from_float() rounds to nearest even and from_float_trunc() toward
+ * zero, for arguments in the range of the integer type.
+ */
+template <>
+struct ComputeBackend<std::int32_t, SIMDLevel::None> {
+	using type          = std::int32_t;
+	using mask          = bool;
+	using index         = std::int32_t; // Indices of gather() and scatter()
+	using unsigned_type = std::uint32_t;
+	using floating      = float;
+
+	// Wrapping arithmetic, computed on unsigned values
+	FORCE_INLINE static type add(type a, type b) noexcept { return static_cast<type>(static_cast<unsigned_type>(a) + static_cast<unsigned_type>(b)); }
+	FORCE_INLINE static type sub(type a, type b) noexcept { return static_cast<type>(static_cast<unsigned_type>(a) - static_cast<unsigned_type>(b)); }
+	FORCE_INLINE static type mul(type a, type b) noexcept { return static_cast<type>(static_cast<unsigned_type>(a) * static_cast<unsigned_type>(b)); }
+	FORCE_INLINE static type min(type a, type b) noexcept { return a < b ? a : b; }
+	FORCE_INLINE static type max(type a, type b) noexcept { return a < b ? b : a; }
+	FORCE_INLINE static type abs(type x)         noexcept { return x < 0 ? sub(0, x) : x; }
+
+	// Shifts by n in [0 ; 32[, shr() being arithmetic
+	FORCE_INLINE static type shl        (type x, int n) noexcept { return static_cast<type>(static_cast<unsigned_type>(x) << n); }
+	FORCE_INLINE static type shr        (type x, int n) noexcept { return x >> n; }
+	FORCE_INLINE static type shr_logical(type x, int n) noexcept { return static_cast<type>(static_cast<unsigned_type>(x) >> n); }
+
+	// Bitwise operations
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return a & b; }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return a | b; }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return a ^ b; }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return ~a & b; } // ~a & b
+	FORCE_INLINE static type bit_not   (type x)         noexcept { return ~x; }
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return a == b; }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return a <  b; }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return a <= b; }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return a != b; }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return a >  b; }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return a >= b; }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return m ? a : b; }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return a && b; }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return a || b; }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return !m; }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return m ? 1u : 0u; }
+	FORCE_INLINE static bool any(mask m)              noexcept { return m; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return m; }
+
+	FORCE_INLINE static constexpr type one()  noexcept { return 1; }
+	FORCE_INLINE static constexpr type zero() noexcept { return 0; }
+	FORCE_INLINE static type set(type x) noexcept { return x; }
+	FORCE_INLINE static type hsum(type x) noexcept { return x; }
+
+	FORCE_INLINE static constexpr size_t width() noexcept { return 1; }
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Memory operations, see the float backend
+	FORCE_INLINE static type loadu(const type* ptr) noexcept { return *ptr; }
+	FORCE_INLINE static type loada(const type* ptr) noexcept { return *ptr; }
+	FORCE_INLINE static void unloadu(type* ptr, type x) noexcept { *ptr = x; }
+	FORCE_INLINE static void unloada(type* ptr, type x) noexcept { *ptr = x; }
+	FORCE_INLINE static void stream(type* ptr, type x) noexcept { *ptr = x; }
+	FORCE_INLINE static void sfence() noexcept {}
+	FORCE_INLINE static void prefetch(const type* ptr) noexcept { ComputeBackend<floating, SIMDLevel::None>::prefetch(reinterpret_cast<const floating*>(ptr)); }
+	FORCE_INLINE static type loadu_partial(const type* ptr, size_t n) noexcept { return n ? *ptr : type(0); }
+	FORCE_INLINE static void unloadu_partial(type* ptr, type x, size_t n) noexcept { if (n) *ptr = x; }
+
+	// Conversions with float lanes
+	FORCE_INLINE static type from_float      (floating x) noexcept { return static_cast<type>(std::nearbyint(x)); }
+	FORCE_INLINE static type from_float_trunc(floating x) noexcept { return static_cast<type>(x); }
+	FORCE_INLINE static floating to_float(type x) noexcept { return static_cast<floating>(x); }
+
+	// Indexed accesses, lane i being base[idx[i]]
+	FORCE_INLINE static type gather(const std::int32_t* base, index idx) noexcept { return base[idx]; }
+	FORCE_INLINE static type mask_gather(type src, mask m, const std::int32_t* base, index idx) noexcept { return m ? base[idx] : src; }
+	FORCE_INLINE static void scatter(std::int32_t* base, index idx, type x) noexcept { base[idx] = x; }
+	FORCE_INLINE static void mask_scatter(std::int32_t* base, mask m, index idx, type x) noexcept { if (m) base[idx] = x; }
+};
+
+template <>
+struct ComputeBackend<std::int64_t, SIMDLevel::None> {
+	using type          = std::int64_t;
+	using mask          = bool;
+	using index         = std::int64_t; // Indices of gather() and scatter()
+	using unsigned_type = std::uint64_t;
+	using floating      = double;
+
+	// Wrapping arithmetic, computed on unsigned values
+	FORCE_INLINE static type add(type a, type b) noexcept { return static_cast<type>(static_cast<unsigned_type>(a) + static_cast<unsigned_type>(b)); }
+	FORCE_INLINE static type sub(type a, type b) noexcept { return static_cast<type>(static_cast<unsigned_type>(a) - static_cast<unsigned_type>(b)); }
+	FORCE_INLINE static type mul(type a, type b) noexcept { return static_cast<type>(static_cast<unsigned_type>(a) * static_cast<unsigned_type>(b)); }
+	FORCE_INLINE static type min(type a, type b) noexcept { return a < b ? a : b; }
+	FORCE_INLINE static type max(type a, type b) noexcept { return a < b ? b : a; }
+	FORCE_INLINE static type abs(type x)         noexcept { return x < 0 ? sub(0, x) : x; }
+
+	// Shifts by n in [0 ; 64[, shr() being arithmetic
+	FORCE_INLINE static type shl        (type x, int n) noexcept { return static_cast<type>(static_cast<unsigned_type>(x) << n); }
+	FORCE_INLINE static type shr        (type x, int n) noexcept { return x >> n; }
+	FORCE_INLINE static type shr_logical(type x, int n) noexcept { return static_cast<type>(static_cast<unsigned_type>(x) >> n); }
+
+	// Bitwise operations
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return a & b; }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return a | b; }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return a ^ b; }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return ~a & b; } // ~a & b
+	FORCE_INLINE static type bit_not   (type x)         noexcept { return ~x; }
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return a == b; }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return a <  b; }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return a <= b; }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return a != b; }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return a >  b; }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return a >= b; }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return m ? a : b; }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return a && b; }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return a || b; }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return !m; }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return m ? 1u : 0u; }
+	FORCE_INLINE static bool any(mask m)              noexcept { return m; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return m; }
+
+	FORCE_INLINE static constexpr type one()  noexcept { return 1; }
+	FORCE_INLINE static constexpr type zero() noexcept { return 0; }
+	FORCE_INLINE static type set(type x) noexcept { return x; }
+	FORCE_INLINE static type hsum(type x) noexcept { return x; }
+
+	FORCE_INLINE static constexpr size_t width() noexcept { return 1; }
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Memory operations, see the float backend
+	FORCE_INLINE static type loadu(const type* ptr) noexcept { return *ptr; }
+	FORCE_INLINE static type loada(const type* ptr) noexcept { return *ptr; }
+	FORCE_INLINE static void unloadu(type* ptr, type x) noexcept { *ptr = x; }
+	FORCE_INLINE static void unloada(type* ptr, type x) noexcept { *ptr = x; }
+	FORCE_INLINE static void stream(type* ptr, type x) noexcept { *ptr = x; }
+	FORCE_INLINE static void sfence() noexcept {}
+	FORCE_INLINE static void prefetch(const type* ptr) noexcept { ComputeBackend<floating, SIMDLevel::None>::prefetch(reinterpret_cast<const floating*>(ptr)); }
+	FORCE_INLINE static type loadu_partial(const type* ptr, size_t n) noexcept { return n ? *ptr : type(0); }
+	FORCE_INLINE static void unloadu_partial(type* ptr, type x, size_t n) noexcept { if (n) *ptr = x; }
+
+	// Conversions with double lanes
+	FORCE_INLINE static type from_float      (floating x) noexcept { return static_cast<type>(std::nearbyint(x)); }
+	FORCE_INLINE static type from_float_trunc(floating x) noexcept { return static_cast<type>(x); }
+	FORCE_INLINE static floating to_float(type x) noexcept { return static_cast<floating>(x); }
+
+	// Indexed accesses, lane i being base[idx[i]]
+	FORCE_INLINE static type gather(const std::int64_t* base, index idx) noexcept { return base[idx]; }
+	FORCE_INLINE static type mask_gather(type src, mask m, const std::int64_t* base, index idx) noexcept { return m ? base[idx] : src; }
+	FORCE_INLINE static void scatter(std::int64_t* base, index idx, type x) noexcept { base[idx] = x; }
+	FORCE_INLINE static void mask_scatter(std::int64_t* base, mask m, index idx, type x) noexcept { if (m) base[idx] = x; }
 };
 
 }
\ No newline at end of file
@@ -1,10 +1,20 @@
 #pragma once
 
+#include <cstdint>
+
 #include <immintrin.h>
 
 #include <vectra/core/simd_level.hpp>
 #include <vectra/core/attributes.hpp>
 #include <vectra/core/constants.hpp>
+#include <vectra/core/half.hpp>
+#include <vectra/detail/gather.hpp>
+#include <vectra/math/exponential.hpp>
+#include <vectra/math/inverse_trigonometric.hpp>
+#include <vectra/math/logarithmic.hpp>
+#include <vectra/math/power.hpp>
+#include <vectra/math/reciprocal.hpp>
+#include <vectra/math/trigonometric.hpp>
 
 
 namespace vectra
@@ -13,6 +23,12 @@ namespace vectra
 template <>
 struct ComputeBackend<float, SIMDLevel::SSE41> {
 	using type = __m128;
+	using mask = __m128; // All bits set in the lanes where true
+	using index = __m128i; // Indices of gather() and scatter(), int32_t lanes
+	// SVML provides vectorized transcendental functions, but it
+	// is only shipped with MSVC and the Intel compilers. Unless
+	// VECTRA_USE_SVML is defined, we rely on in-house kernels.
+	#ifdef VECTRA_USE_SVML
 	FORCE_INLINE static type sin (type x)		  noexcept { return _mm_sin_ps(x); }
 	FORCE_INLINE static type cos (type x)		  noexcept { return _mm_cos_ps(x); }
 	// Since our approximation of arccos is not defined only over
@@ -22,9 +38,41 @@ struct ComputeBackend<float, SIMDLevel::SSE41> {
 	#else
 	FORCE_INLINE static type acos(type x)		  noexcept { return _mm_acos_ps(_mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-1.f)), _mm_set1_ps(1.f))); }
 	#endif
-	FORCE_INLINE static type sqrt(type x)		  noexcept { return _mm_sqrt_ps(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return _mm_asin_ps(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return _mm_atan_ps(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return _mm_atan2_ps(y, x); }
 	FORCE_INLINE static type cbrt(type x)		  noexcept { return _mm_cbrt_ps(x); }
 	FORCE_INLINE static type exp (type x)		  noexcept { return _mm_exp_ps(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return _mm_exp2_ps(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return _mm_expm1_ps(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return _mm_log_ps(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return _mm_log2_ps(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return _mm_log1p_ps(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return _mm_pow_ps(a, b); }
+	#else
+	FORCE_INLINE static type sin (type x)		  noexcept { return math::sin<float, ComputeBackend>(x); }
+	FORCE_INLINE static type cos (type x)		  noexcept { return math::cos<float, ComputeBackend>(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return math::asin <float, ComputeBackend>(x); }
+	FORCE_INLINE static type acos(type x)		  noexcept { return math::acos <float, ComputeBackend>(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return math::atan <float, ComputeBackend>(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return math::atan2<float, ComputeBackend>(y, x); }
+	FORCE_INLINE static type cbrt(type x)		  noexcept { return math::cbrt <float, ComputeBackend>(x); }
+	FORCE_INLINE static type exp (type x)		  noexcept { return math::exp  <float, ComputeBackend>(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return math::exp2 <float, ComputeBackend>(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return math::expm1<float, ComputeBackend>(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return math::log  <float, ComputeBackend>(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return math::log2 <float, ComputeBackend>(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return math::log1p<float, ComputeBackend>(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return math::pow  <float, ComputeBackend>(a, b); }
+	#endif
+	FORCE_INLINE static type sqrt(type x)		  noexcept { return _mm_sqrt_ps(x); }
+
+	// Estimates of 1/x and 1/sqrt(x), relative error below 1.5 * 2^-12,
+	// refined by one Newton step to a few ULP (see math/reciprocal.hpp)
+	FORCE_INLINE static type rcp  (type x) noexcept { return math::rcp_estimate  <float, ComputeBackend>(x, [](type v) { return _mm_rcp_ps(v); }); }
+	FORCE_INLINE static type rsqrt(type x) noexcept { return math::rsqrt_estimate<float, ComputeBackend>(x, [](type v) { return _mm_rsqrt_ps(v); }); }
+	FORCE_INLINE static type rcp_refined  (type x) noexcept { return math::rcp_newton  <float, ComputeBackend, 1>(x, rcp(x)); }
+	FORCE_INLINE static type rsqrt_refined(type x) noexcept { return math::rsqrt_newton<float, ComputeBackend, 1>(x, rsqrt(x)); }
 	FORCE_INLINE static type add (type a, type b) noexcept { return _mm_add_ps(a, b); }
 	FORCE_INLINE static type sub (type a, type b) noexcept { return _mm_sub_ps(a, b); }
 	FORCE_INLINE static type mul (type a, type b) noexcept { return _mm_mul_ps(a, b); }
@@ -32,6 +80,44 @@ struct ComputeBackend<float, SIMDLevel::SSE41> {
 	FORCE_INLINE static type min (type a, type b) noexcept { return _mm_min_ps(a, b); }
 	FORCE_INLINE static type max (type a, type b) noexcept { return _mm_max_ps(a, b); }
 	FORCE_INLINE static type abs (type x)         noexcept { return _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF))); }
+	FORCE_INLINE static type round(type x)        noexcept { return _mm_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	FORCE_INLINE static type floor(type x)        noexcept { return _mm_floor_ps(x); }
+
+	// Multiply-add primitives. There is no FMA at this level, so
+	// they are emulated and rounded twice: a * b, then the sum.
+	FORCE_INLINE static constexpr bool has_fma() noexcept { return false; }
+	FORCE_INLINE static type fma (type a, type b, type c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); } //   a * b + c
+	FORCE_INLINE static type fms (type a, type b, type c) noexcept { return _mm_sub_ps(_mm_mul_ps(a, b), c); } //   a * b - c
+	FORCE_INLINE static type fnma(type a, type b, type c) noexcept { return _mm_sub_ps(c, _mm_mul_ps(a, b)); } // -(a * b) + c
+
+	// Bitwise operations on the IEEE-754 representation
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm_and_ps   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm_or_ps    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm_xor_ps   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm_andnot_ps(a, b); } // ~a & b
+
+	// Exponent manipulation, for positive normal values x and for
+	// integral values n in the normal exponent range [-126 ; 127]
+	FORCE_INLINE static type getexp (type x) noexcept { return _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(_mm_and_si128(_mm_castps_si128(x), _mm_set1_epi32(0x7F800000)), 23), _mm_set1_epi32(127))); } // floor(log2(x))
+	FORCE_INLINE static type getmant(type x) noexcept { return _mm_or_ps(_mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x007FFFFF))), _mm_set1_ps(1.f)); } // In [1 ; 2[
+	FORCE_INLINE static type exp2i  (type n) noexcept { return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23)); } // 2^n
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm_cmpeq_ps(a, b); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return _mm_cmplt_ps(a, b); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return _mm_cmple_ps(a, b); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return _mm_cmpneq_ps(a, b); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm_cmpgt_ps(a, b); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return _mm_cmpge_ps(a, b); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm_blendv_ps(b, a, m); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return _mm_and_ps(a, b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return _mm_or_ps(a, b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return _mm_xor_ps(m, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return static_cast<unsigned>(_mm_movemask_ps(m)); }
+	FORCE_INLINE static bool any(mask m)              noexcept { return movemask(m) != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return movemask(m) == 0xFu; }
 
 	FORCE_INLINE static type one()				  noexcept { return _mm_set1_ps(1.f); }
 	FORCE_INLINE static type zero()				  noexcept { return _mm_setzero_ps(); }
@@ -71,11 +157,152 @@ struct ComputeBackend<float, SIMDLevel::SSE41> {
 	FORCE_INLINE static void unloadu(float* FORCE_RESTRICT ptr, type x) { _mm_storeu_ps(ptr, x); } // Unaligned
 	FORCE_INLINE static void unloada(float* FORCE_RESTRICT ptr, type x) { _mm_store_ps (ptr, x); } // Aligned
 
+	// Non-temporal store to aligned memory, bypassing the caches, for
+	// write-once outputs larger than the last level cache. Streamed
+	// stores are only ordered with the other ones after sfence().
+	FORCE_INLINE static void stream(float* FORCE_RESTRICT ptr, type x) noexcept { _mm_stream_ps(ptr, x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+
+	// Fetches the cache line of ptr into every cache level
+	FORCE_INLINE static void prefetch(const float* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+
+	// Partial loads and stores of the first n < width() lanes, for
+	// array tails. SSE4.1 has no masked memory operations, so lanes
+	// go through a stack buffer; the others are loaded as zeros.
+	FORCE_INLINE static type loadu_partial(const float* FORCE_RESTRICT ptr, size_t n) noexcept {
+		alignas(16) float tmp[width()] = {};
+		for (size_t i = 0; i < n; ++i) tmp[i] = ptr[i];
+		return _mm_load_ps(tmp);
+	}
+	FORCE_INLINE static void unloadu_partial(float* FORCE_RESTRICT ptr, type x, size_t n) noexcept {
+		alignas(16) float tmp[width()];
+		_mm_store_ps(tmp, x);
+		for (size_t i = 0; i < n; ++i) ptr[i] = tmp[i];
+	}
+
+	// 16-bit storage (see half.hpp), widened to float and narrowed back
+	// rounding to nearest even. Halves are converted by F16C when it is
+	// enabled, by integer operations otherwise; bfloat16 is the high
+	// half of a float. Tails go through a stack buffer.
+	FORCE_INLINE static type loadu(const half* ptr) noexcept {
+	#if defined(VECTRA_HAS_F16C)
+		return _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr)));
+	#else
+		return widen_half(_mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr))));
+	#endif
+	}
+	FORCE_INLINE static void unloadu(half* ptr, type x) noexcept {
+	#if defined(VECTRA_HAS_F16C)
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(ptr), _mm_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT));
+	#else
+		const __m128i h = narrow_half(x);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(ptr), _mm_packus_epi32(h, h));
+	#endif
+	}
+	FORCE_INLINE static type loadu(const bfloat16* ptr) noexcept {
+		return _mm_castsi128_ps(_mm_slli_epi32(_mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr))), 16));
+	}
+	FORCE_INLINE static void unloadu(bfloat16* ptr, type x) noexcept {
+		const __m128i b = narrow_bf16(x);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(ptr), _mm_packus_epi32(b, b));
+	}
+	FORCE_INLINE static type loadu_partial(const half*     ptr, size_t n) noexcept { return detail::loadPartial16<ComputeBackend>(ptr, n); }
+	FORCE_INLINE static type loadu_partial(const bfloat16* ptr, size_t n) noexcept { return detail::loadPartial16<ComputeBackend>(ptr, n); }
+	FORCE_INLINE static void unloadu_partial(half*     ptr, type x, size_t n) noexcept { detail::storePartial16<ComputeBackend>(ptr, x, n); }
+	FORCE_INLINE static void unloadu_partial(bfloat16* ptr, type x, size_t n) noexcept { detail::storePartial16<ComputeBackend>(ptr, x, n); }
+
+	// Conversions of 16-bit values held in 32-bit lanes, without F16C.
+	// Finite halves are their bits shifted into a float, times 2^112:
+	// exact, subnormals included unless denormals are flushed (DAZ).
+	FORCE_INLINE static type widen_half(__m128i h) noexcept {
+		const __m128i sign    = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+		const __m128i abs     = _mm_and_si128(h, _mm_set1_epi32(0x7FFF));
+		const __m128  finite  = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(abs, 13)), _mm_castsi128_ps(_mm_set1_epi32(0x77800000)));
+		const __m128i quiet   = _mm_and_si128(_mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7C00)), _mm_set1_epi32(0x400000));
+		const __m128i special = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(0x7F800000), _mm_slli_epi32(_mm_and_si128(abs, _mm_set1_epi32(0x3FF)), 13)), quiet);
+		const __m128  r       = _mm_blendv_ps(finite, _mm_castsi128_ps(special), _mm_castsi128_ps(_mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7BFF))));
+		return _mm_or_ps(r, _mm_castsi128_ps(sign));
+	}
+	// Same steps as detail::floatToHalf(), computed for every lane then selected
+	FORCE_INLINE static __m128i narrow_half(type x) noexcept {
+		const __m128i bits   = _mm_castps_si128(x);
+		const __m128i sign   = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+		const __m128i abs    = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+		const __m128i odd    = _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(1));
+		const __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(abs, _mm_set1_epi32(static_cast<int>(0xC8000FFFu))), odd), 13);
+		const __m128i sub    = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(abs), _mm_set1_ps(0.5f))), _mm_set1_epi32(0x3F000000));
+		const __m128i nan    = _mm_or_si128(_mm_set1_epi32(0x7E00), _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(0x3FF)));
+		__m128i h = _mm_blendv_epi8(normal, sub, _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000)));
+		h = _mm_blendv_epi8(h, _mm_set1_epi32(0x7C00), _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x477FEFFF)));
+		h = _mm_blendv_epi8(h, nan, _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F800000)));
+		return _mm_or_si128(h, sign);
+	}
+	FORCE_INLINE static __m128i narrow_bf16(type x) noexcept {
+		const __m128i bits = _mm_castps_si128(x);
+		const __m128i odd  = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(1));
+		const __m128i b    = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32(0x7FFF)), odd), 16);
+		const __m128i nan  = _mm_or_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x40));
+		return _mm_blendv_epi8(b, nan, _mm_castps_si128(_mm_cmpunord_ps(x, x)));
+	}
+
+	// Interleaved records (a0 b0 a1 b1 ... for two components), one
+	// register of records per call, loaded as one register per
+	// component by deinterleaveN and stored back by interleaveN.
+	// Stride 3 gathers each component with two blends, leaving its
+	// lanes in an order undone by a single shuffle (an involution,
+	// so that the same shuffles are used to interleave).
+	FORCE_INLINE static void deinterleave2(const float* ptr, type& a, type& b) noexcept {
+		__m128 v0 = _mm_loadu_ps(ptr), v1 = _mm_loadu_ps(ptr + 4);
+		a = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+		b = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+	}
+	FORCE_INLINE static void deinterleave3(const float* ptr, type& a, type& b, type& c) noexcept {
+		__m128 v0 = _mm_loadu_ps(ptr), v1 = _mm_loadu_ps(ptr + 4), v2 = _mm_loadu_ps(ptr + 8);
+		__m128 ta = _mm_blend_ps(_mm_blend_ps(v0, v1, 0x4), v2, 0x2); // a0 a3 a2 a1
+		__m128 tb = _mm_blend_ps(_mm_blend_ps(v0, v1, 0x9), v2, 0x4); // b1 b0 b3 b2
+		__m128 tc = _mm_blend_ps(_mm_blend_ps(v0, v1, 0x2), v2, 0x9); // c2 c1 c0 c3
+		a = _mm_shuffle_ps(ta, ta, _MM_SHUFFLE(1, 2, 3, 0));
+		b = _mm_shuffle_ps(tb, tb, _MM_SHUFFLE(2, 3, 0, 1));
+		c = _mm_shuffle_ps(tc, tc, _MM_SHUFFLE(3, 0, 1, 2));
+	}
+	FORCE_INLINE static void deinterleave4(const float* ptr, type& a, type& b, type& c, type& d) noexcept {
+		a = _mm_loadu_ps(ptr); b = _mm_loadu_ps(ptr + 4); c = _mm_loadu_ps(ptr + 8); d = _mm_loadu_ps(ptr + 12);
+		_MM_TRANSPOSE4_PS(a, b, c, d);
+	}
+	FORCE_INLINE static void interleave2(float* ptr, type a, type b) noexcept {
+		_mm_storeu_ps(ptr,     _mm_unpacklo_ps(a, b));
+		_mm_storeu_ps(ptr + 4, _mm_unpackhi_ps(a, b));
+	}
+	FORCE_INLINE static void interleave3(float* ptr, type a, type b, type c) noexcept {
+		__m128 ta = _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 2, 3, 0));
+		__m128 tb = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1));
+		__m128 tc = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 1, 2));
+		_mm_storeu_ps(ptr,     _mm_blend_ps(_mm_blend_ps(ta, tb, 0x2), tc, 0x4));
+		_mm_storeu_ps(ptr + 4, _mm_blend_ps(_mm_blend_ps(tb, tc, 0x2), ta, 0x4));
+		_mm_storeu_ps(ptr + 8, _mm_blend_ps(_mm_blend_ps(tc, ta, 0x2), tb, 0x4));
+	}
+	FORCE_INLINE static void interleave4(float* ptr, type a, type b, type c, type d) noexcept {
+		_MM_TRANSPOSE4_PS(a, b, c, d);
+		_mm_storeu_ps(ptr, a); _mm_storeu_ps(ptr + 4, b); _mm_storeu_ps(ptr + 8, c); _mm_storeu_ps(ptr + 12, d);
+	}
+
+	// Indexed accesses, lane i being base[idx[i]]. There are no gather
+	// nor scatter instructions: lanes are moved one by one.
+	FORCE_INLINE static type gather(const float* base, index idx) noexcept { return detail::gatherLanes<ComputeBackend>(base, idx); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const float* base, index idx) noexcept { return detail::maskGatherLanes<ComputeBackend>(src, m, base, idx); }
+	FORCE_INLINE static void scatter(float* base, index idx, type x) noexcept { detail::scatterLanes<ComputeBackend>(base, idx, x); }
+	FORCE_INLINE static void mask_scatter(float* base, mask m, index idx, type x) noexcept { detail::maskScatterLanes<ComputeBackend>(base, m, idx, x); }
 };
 
 template <>
 struct ComputeBackend<double, SIMDLevel::SSE41> {
 	using type = __m128d;
+	using mask = __m128d; // All bits set in the lanes where true
+	using index = __m128i; // Indices of gather() and scatter(), int64_t lanes
+	// SVML provides vectorized transcendental functions, but it
+	// is only shipped with MSVC and the Intel compilers. Unless
+	// VECTRA_USE_SVML is defined, we rely on in-house kernels.
+	#ifdef VECTRA_USE_SVML
 	FORCE_INLINE static type sin (type x)		  noexcept { return _mm_sin_pd(x); }
 	FORCE_INLINE static type cos (type x)		  noexcept { return _mm_cos_pd(x); }
 	// Since our approximation of arccos is not defined only over
@@ -85,16 +312,91 @@ struct ComputeBackend<double, SIMDLevel::SSE41> {
 	#else
 	FORCE_INLINE static type acos(type x)		  noexcept { return _mm_acos_pd(_mm_min_pd(_mm_max_pd(x, _mm_set1_pd(-1.0)), _mm_set1_pd(1.0))); }
 	#endif
-	FORCE_INLINE static type sqrt(type x)		  noexcept { return _mm_sqrt_pd(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return _mm_asin_pd(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return _mm_atan_pd(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return _mm_atan2_pd(y, x); }
 	FORCE_INLINE static type cbrt(type x)		  noexcept { return _mm_cbrt_pd(x); }
 	FORCE_INLINE static type exp (type x)		  noexcept { return _mm_exp_pd(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return _mm_exp2_pd(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return _mm_expm1_pd(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return _mm_log_pd(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return _mm_log2_pd(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return _mm_log1p_pd(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return _mm_pow_pd(a, b); }
+	#else
+	FORCE_INLINE static type sin (type x)		  noexcept { return math::sin<double, ComputeBackend>(x); }
+	FORCE_INLINE static type cos (type x)		  noexcept { return math::cos<double, ComputeBackend>(x); }
+	FORCE_INLINE static type asin(type x)		  noexcept { return math::asin <double, ComputeBackend>(x); }
+	FORCE_INLINE static type acos(type x)		  noexcept { return math::acos <double, ComputeBackend>(x); }
+	FORCE_INLINE static type atan(type x)		  noexcept { return math::atan <double, ComputeBackend>(x); }
+	FORCE_INLINE static type atan2(type y, type x) noexcept { return math::atan2<double, ComputeBackend>(y, x); }
+	FORCE_INLINE static type cbrt(type x)		  noexcept { return math::cbrt <double, ComputeBackend>(x); }
+	FORCE_INLINE static type exp (type x)		  noexcept { return math::exp  <double, ComputeBackend>(x); }
+	FORCE_INLINE static type exp2(type x)		  noexcept { return math::exp2 <double, ComputeBackend>(x); }
+	FORCE_INLINE static type expm1(type x)		  noexcept { return math::expm1<double, ComputeBackend>(x); }
+	FORCE_INLINE static type log (type x)		  noexcept { return math::log  <double, ComputeBackend>(x); }
+	FORCE_INLINE static type log2(type x)		  noexcept { return math::log2 <double, ComputeBackend>(x); }
+	FORCE_INLINE static type log1p(type x)		  noexcept { return math::log1p<double, ComputeBackend>(x); }
+	FORCE_INLINE static type pow (type a, type b) noexcept { return math::pow  <double, ComputeBackend>(a, b); }
+	#endif
+	FORCE_INLINE static type sqrt(type x)		  noexcept { return _mm_sqrt_pd(x); }
+
+	// Estimates seeded in float on the significand (see math/reciprocal.hpp),
+	// refined by three Newton steps (12, 24 then 48 bits and beyond)
+	FORCE_INLINE static type rcp  (type x) noexcept { return math::rcp_estimate  <double, ComputeBackend>(x, [](type m) { return _mm_cvtps_pd(_mm_rcp_ps(_mm_cvtpd_ps(m))); }); }
+	FORCE_INLINE static type rsqrt(type x) noexcept { return math::rsqrt_estimate<double, ComputeBackend>(x, [](type m) { return _mm_cvtps_pd(_mm_rsqrt_ps(_mm_cvtpd_ps(m))); }); }
+	FORCE_INLINE static type rcp_refined  (type x) noexcept { return math::rcp_newton  <double, ComputeBackend, 3>(x, rcp(x)); }
+	FORCE_INLINE static type rsqrt_refined(type x) noexcept { return math::rsqrt_newton<double, ComputeBackend, 3>(x, rsqrt(x)); }
 	FORCE_INLINE static type add (type a, type b) noexcept { return _mm_add_pd(a, b); }
 	FORCE_INLINE static type sub (type a, type b) noexcept { return _mm_sub_pd(a, b); }
 	FORCE_INLINE static type mul (type a, type b) noexcept { return _mm_mul_pd(a, b); }
 	FORCE_INLINE static type div (type a, type b) noexcept { return _mm_div_pd(a, b); }
 	FORCE_INLINE static type min (type a, type b) noexcept { return _mm_min_pd(a, b); }
 	FORCE_INLINE static type max (type a, type b) noexcept { return _mm_max_pd(a, b); }
-	FORCE_INLINE static type abs (type x)         noexcept { return _mm_and_pd(x, _mm_castsi128_pd(_mm_set1_epi32(0x7FFFFFFF))); }
+	FORCE_INLINE static type abs (type x)         noexcept { return _mm_and_pd(x, _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFF))); }
+	FORCE_INLINE static type round(type x)        noexcept { return _mm_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	FORCE_INLINE static type floor(type x)        noexcept { return _mm_floor_pd(x); }
+
+	// Multiply-add primitives. There is no FMA at this level, so
+	// they are emulated and rounded twice: a * b, then the sum.
+	FORCE_INLINE static constexpr bool has_fma() noexcept { return false; }
+	FORCE_INLINE static type fma (type a, type b, type c) noexcept { return _mm_add_pd(_mm_mul_pd(a, b), c); } //   a * b + c
+	FORCE_INLINE static type fms (type a, type b, type c) noexcept { return _mm_sub_pd(_mm_mul_pd(a, b), c); } //   a * b - c
+	FORCE_INLINE static type fnma(type a, type b, type c) noexcept { return _mm_sub_pd(c, _mm_mul_pd(a, b)); } // -(a * b) + c
+
+	// Bitwise operations on the IEEE-754 representation
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm_and_pd   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm_or_pd    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm_xor_pd   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm_andnot_pd(a, b); } // ~a & b
+
+	// Exponent manipulation, for positive normal values x and for
+	// integral values n in the normal exponent range [-1022 ; 1023]
+	// NB: 64-bit integers are converted to double by placing them
+	//     in the significand of 2^52, then subtracting 2^52.
+	FORCE_INLINE static type getexp (type x) noexcept {
+		__m128i e = _mm_and_si128(_mm_srli_epi64(_mm_castpd_si128(x), 52), _mm_set1_epi64x(0x7FF));
+		return _mm_sub_pd(_mm_or_pd(_mm_castsi128_pd(e), _mm_set1_pd(4503599627370496.0)), _mm_set1_pd(4503599627370496.0 + 1023.0)); // floor(log2(x))
+	}
+	FORCE_INLINE static type getmant(type x) noexcept { return _mm_or_pd(_mm_and_pd(x, _mm_castsi128_pd(_mm_set1_epi64x(0x000FFFFFFFFFFFFF))), _mm_set1_pd(1.0)); } // In [1 ; 2[
+	FORCE_INLINE static type exp2i  (type n) noexcept { return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(_mm_add_pd(n, _mm_set1_pd(4503599627370496.0 + 1023.0))), 52)); } // 2^n
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm_cmpeq_pd(a, b); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return _mm_cmplt_pd(a, b); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return _mm_cmple_pd(a, b); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return _mm_cmpneq_pd(a, b); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm_cmpgt_pd(a, b); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return _mm_cmpge_pd(a, b); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm_blendv_pd(b, a, m); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return _mm_and_pd(a, b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return _mm_or_pd(a, b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return _mm_xor_pd(m, _mm_castsi128_pd(_mm_set1_epi32(-1))); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return static_cast<unsigned>(_mm_movemask_pd(m)); }
+	FORCE_INLINE static bool any(mask m)              noexcept { return movemask(m) != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return movemask(m) == 0x3u; }
 
 	FORCE_INLINE static type one()				  noexcept { return _mm_set1_pd(1.0); }
 	FORCE_INLINE static type zero()				  noexcept { return _mm_setzero_pd(); }
@@ -133,6 +435,271 @@ struct ComputeBackend<double, SIMDLevel::SSE41> {
 	FORCE_INLINE static void unloadu(double* FORCE_RESTRICT ptr, type x) { _mm_storeu_pd(ptr, x); } // Unaligned
 	FORCE_INLINE static void unloada(double* FORCE_RESTRICT ptr, type x) { _mm_store_pd (ptr, x); } // Aligned
 
+	// Non-temporal store to aligned memory, bypassing the caches, for
+	// write-once outputs larger than the last level cache. Streamed
+	// stores are only ordered with the other ones after sfence().
+	FORCE_INLINE static void stream(double* FORCE_RESTRICT ptr, type x) noexcept { _mm_stream_pd(ptr, x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+
+	// Fetches the cache line of ptr into every cache level
+	FORCE_INLINE static void prefetch(const double* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+
+	// Partial loads and stores of the first n < width() lanes, for
+	// array tails. SSE4.1 has no masked memory operations, so lanes
+	// go through a stack buffer; the others are loaded as zeros.
+	FORCE_INLINE static type loadu_partial(const double* FORCE_RESTRICT ptr, size_t n) noexcept {
+		alignas(16) double tmp[width()] = {};
+		for (size_t i = 0; i < n; ++i) tmp[i] = ptr[i];
+		return _mm_load_pd(tmp);
+	}
+	FORCE_INLINE static void unloadu_partial(double* FORCE_RESTRICT ptr, type x, size_t n) noexcept {
+		alignas(16) double tmp[width()];
+		_mm_store_pd(tmp, x);
+		for (size_t i = 0; i < n; ++i) ptr[i] = tmp[i];
+	}
+
+	// Interleaved records (a0 b0 a1 b1 ... for two components), one
+	// register of records per call, loaded as one register per
+	// component by deinterleaveN and stored back by interleaveN.
+	FORCE_INLINE static void deinterleave2(const double* ptr, type& a, type& b) noexcept {
+		__m128d v0 = _mm_loadu_pd(ptr), v1 = _mm_loadu_pd(ptr + 2);
+		a = _mm_unpacklo_pd(v0, v1);
+		b = _mm_unpackhi_pd(v0, v1);
+	}
+	FORCE_INLINE static void deinterleave3(const double* ptr, type& a, type& b, type& c) noexcept {
+		__m128d v0 = _mm_loadu_pd(ptr), v1 = _mm_loadu_pd(ptr + 2), v2 = _mm_loadu_pd(ptr + 4);
+		a = _mm_blend_pd(v0, v1, 0x2);
+		b = _mm_shuffle_pd(v0, v2, 0x1);
+		c = _mm_blend_pd(v1, v2, 0x2);
+	}
+	FORCE_INLINE static void deinterleave4(const double* ptr, type& a, type& b, type& c, type& d) noexcept {
+		__m128d v0 = _mm_loadu_pd(ptr), v1 = _mm_loadu_pd(ptr + 2), v2 = _mm_loadu_pd(ptr + 4), v3 = _mm_loadu_pd(ptr + 6);
+		a = _mm_unpacklo_pd(v0, v2); b = _mm_unpackhi_pd(v0, v2);
+		c = _mm_unpacklo_pd(v1, v3); d = _mm_unpackhi_pd(v1, v3);
+	}
+	FORCE_INLINE static void interleave2(double* ptr, type a, type b) noexcept {
+		_mm_storeu_pd(ptr,     _mm_unpacklo_pd(a, b));
+		_mm_storeu_pd(ptr + 2, _mm_unpackhi_pd(a, b));
+	}
+	FORCE_INLINE static void interleave3(double* ptr, type a, type b, type c) noexcept {
+		_mm_storeu_pd(ptr,     _mm_unpacklo_pd(a, b));
+		_mm_storeu_pd(ptr + 2, _mm_blend_pd(c, a, 0x2));
+		_mm_storeu_pd(ptr + 4, _mm_unpackhi_pd(b, c));
+	}
+	FORCE_INLINE static void interleave4(double* ptr, type a, type b, type c, type d) noexcept {
+		_mm_storeu_pd(ptr,     _mm_unpacklo_pd(a, b)); _mm_storeu_pd(ptr + 2, _mm_unpacklo_pd(c, d));
+		_mm_storeu_pd(ptr + 4, _mm_unpackhi_pd(a, b)); _mm_storeu_pd(ptr + 6, _mm_unpackhi_pd(c, d));
+	}
+
+	// Indexed accesses, lane i being base[idx[i]]. There are no gather
+	// nor scatter instructions: lanes are moved one by one.
+	FORCE_INLINE static type gather(const double* base, index idx) noexcept { return detail::gatherLanes<ComputeBackend>(base, idx); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const double* base, index idx) noexcept { return detail::maskGatherLanes<ComputeBackend>(src, m, base, idx); }
+	FORCE_INLINE static void scatter(double* base, index idx, type x) noexcept { detail::scatterLanes<ComputeBackend>(base, idx, x); }
+	FORCE_INLINE static void mask_scatter(double* base, mask m, index idx, type x) noexcept { detail::maskScatterLanes<ComputeBackend>(base, m, idx, x); }
+};
+
+// Integer lanes, see the scalar backend for their semantics
+template <>
+struct ComputeBackend<std::int32_t, SIMDLevel::SSE41> {
+	using type     = __m128i;
+	using mask     = __m128i; // All bits set in the lanes where true
+	using index    = __m128i; // Indices of gather() and scatter(), int32_t lanes
+	using floating = __m128;
+
+	FORCE_INLINE static type add(type a, type b) noexcept { return _mm_add_epi32  (a, b); }
+	FORCE_INLINE static type sub(type a, type b) noexcept { return _mm_sub_epi32  (a, b); }
+	FORCE_INLINE static type mul(type a, type b) noexcept { return _mm_mullo_epi32(a, b); }
+	FORCE_INLINE static type min(type a, type b) noexcept { return _mm_min_epi32  (a, b); }
+	FORCE_INLINE static type max(type a, type b) noexcept { return _mm_max_epi32  (a, b); }
+	FORCE_INLINE static type abs(type x)         noexcept { return _mm_abs_epi32  (x); }
+
+	// Shifts by n in [0 ; 32[, shr() being arithmetic
+	FORCE_INLINE static type shl        (type x, int n) noexcept { return _mm_sll_epi32(x, _mm_cvtsi32_si128(n)); }
+	FORCE_INLINE static type shr        (type x, int n) noexcept { return _mm_sra_epi32(x, _mm_cvtsi32_si128(n)); }
+	FORCE_INLINE static type shr_logical(type x, int n) noexcept { return _mm_srl_epi32(x, _mm_cvtsi32_si128(n)); }
+
+	// Bitwise operations
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm_and_si128   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm_or_si128    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm_xor_si128   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm_andnot_si128(a, b); } // ~a & b
+	FORCE_INLINE static type bit_not   (type x)         noexcept { return _mm_xor_si128   (x, _mm_set1_epi32(-1)); }
+
+	// Lane-wise comparison and selection, mask ? a : b
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm_cmpeq_epi32(a, b); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return _mm_cmplt_epi32(a, b); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return mask_not(cmpgt(a, b)); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return mask_not(cmpeq(a, b)); }
+	FORCE_INLINE static mask cmpgt (type a, type b)         noexcept { return _mm_cmpgt_epi32(a, b); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return mask_not(cmplt(a, b)); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm_blendv_epi8(b, a, m); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return _mm_and_si128(a, b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return _mm_or_si128(a, b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return _mm_xor_si128(m, _mm_set1_epi32(-1)); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(m))); }
+	FORCE_INLINE static bool any(mask m)              noexcept { return movemask(m) != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return movemask(m) == 0xFu; }
+
+	FORCE_INLINE static type one()  noexcept { return _mm_set1_epi32(1); }
+	FORCE_INLINE static type zero() noexcept { return _mm_setzero_si128(); }
+	FORCE_INLINE static type set(std::int32_t x) noexcept { return _mm_set1_epi32(x); }
+
+	// Wrapping sum of the lanes
+	FORCE_INLINE static std::int32_t hsum(type x) noexcept {
+		const __m128i sums = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)));
+		return _mm_cvtsi128_si32(_mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(2, 3, 0, 1))));
+	}
+
+	FORCE_INLINE static constexpr size_t width() noexcept { return 4; }
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Memory operations, see the float backend
+	FORCE_INLINE static type loadu(const std::int32_t* FORCE_RESTRICT ptr) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)); }
+	FORCE_INLINE static type loada(const std::int32_t* FORCE_RESTRICT ptr) noexcept { return _mm_load_si128 (reinterpret_cast<const __m128i*>(ptr)); }
+	FORCE_INLINE static void unloadu(std::int32_t* FORCE_RESTRICT ptr, type x) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), x); }
+	FORCE_INLINE static void unloada(std::int32_t* FORCE_RESTRICT ptr, type x) noexcept { _mm_store_si128 (reinterpret_cast<__m128i*>(ptr), x); }
+	FORCE_INLINE static void stream (std::int32_t* FORCE_RESTRICT ptr, type x) noexcept { _mm_stream_si128(reinterpret_cast<__m128i*>(ptr), x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+	FORCE_INLINE static void prefetch(const std::int32_t* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+	FORCE_INLINE static type loadu_partial(const std::int32_t* FORCE_RESTRICT ptr, size_t n) noexcept {
+		alignas(16) std::int32_t tmp[width()] = {};
+		for (size_t i = 0; i < n; ++i) tmp[i] = ptr[i];
+		return loada(tmp);
+	}
+	FORCE_INLINE static void unloadu_partial(std::int32_t* FORCE_RESTRICT ptr, type x, size_t n) noexcept {
+		alignas(16) std::int32_t tmp[width()];
+		unloada(tmp, x);
+		for (size_t i = 0; i < n; ++i) ptr[i] = tmp[i];
+	}
+
+	// Conversions with float lanes
+	FORCE_INLINE static type from_float      (floating x) noexcept { return _mm_cvtps_epi32 (x); }
+	FORCE_INLINE static type from_float_trunc(floating x) noexcept { return _mm_cvttps_epi32(x); }
+	FORCE_INLINE static floating to_float(type x) noexcept { return _mm_cvtepi32_ps(x); }
+
+	// Indexed accesses, lane i being base[idx[i]]. There are no gather
+	// nor scatter instructions: lanes are moved one by one.
+	FORCE_INLINE static type gather(const std::int32_t* base, index idx) noexcept { return detail::gatherLanes<ComputeBackend>(base, idx); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const std::int32_t* base, index idx) noexcept { return detail::maskGatherLanes<ComputeBackend>(src, m, base, idx); }
+	FORCE_INLINE static void scatter(std::int32_t* base, index idx, type x) noexcept { detail::scatterLanes<ComputeBackend>(base, idx, x); }
+	FORCE_INLINE static void mask_scatter(std::int32_t* base, mask m, index idx, type x) noexcept { detail::maskScatterLanes<ComputeBackend>(base, m, idx, x); }
+};
+
+// SSE4.1 has few 64-bit integer instructions: multiplications,
+// arithmetic shifts and signed comparisons are emulated with 32-bit
+// ones, and so are the conversions with double.
+template <>
+struct ComputeBackend<std::int64_t, SIMDLevel::SSE41> {
+	using type     = __m128i;
+	using mask     = __m128i; // All bits set in the lanes where true
+	using index    = __m128i; // Indices of gather() and scatter(), int64_t lanes
+	using floating = __m128d;
+
+	FORCE_INLINE static type add(type a, type b) noexcept { return _mm_add_epi64(a, b); }
+	FORCE_INLINE static type sub(type a, type b) noexcept { return _mm_sub_epi64(a, b); }
+	FORCE_INLINE static type min(type a, type b) noexcept { return select(cmpgt(a, b), b, a); }
+	FORCE_INLINE static type max(type a, type b) noexcept { return select(cmpgt(a, b), a, b); }
+	FORCE_INLINE static type abs(type x)         noexcept { const __m128i s = sign(x); return _mm_sub_epi64(_mm_xor_si128(x, s), s); }
+
+	// Low 64 bits of the product: lo(a) lo(b) + (lo(a) hi(b) + hi(a) lo(b)) << 32
+	FORCE_INLINE static type mul(type a, type b) noexcept {
+		const __m128i cross = _mm_mullo_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(2, 3, 0, 1)));
+		const __m128i high  = _mm_shuffle_epi32(_mm_hadd_epi32(cross, _mm_setzero_si128()), _MM_SHUFFLE(1, 3, 0, 3));
+		return _mm_add_epi64(_mm_mul_epu32(a, b), high);
+	}
+
+	// All bits set in the negative lanes
+	FORCE_INLINE static type sign(type x) noexcept { return _mm_srai_epi32(_mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 1, 1)), 31); }
+
+	// Shifts by n in [0 ; 64[, shr() being arithmetic: the logical
+	// shift, with the sign shifted into the high bits
+	FORCE_INLINE static type shl        (type x, int n) noexcept { return _mm_sll_epi64(x, _mm_cvtsi32_si128(n)); }
+	FORCE_INLINE static type shr        (type x, int n) noexcept { return _mm_or_si128(shr_logical(x, n), _mm_sll_epi64(sign(x), _mm_cvtsi32_si128(64 - n))); }
+	FORCE_INLINE static type shr_logical(type x, int n) noexcept { return _mm_srl_epi64(x, _mm_cvtsi32_si128(n)); }
+
+	// Bitwise operations
+	FORCE_INLINE static type bit_and   (type a, type b) noexcept { return _mm_and_si128   (a, b); }
+	FORCE_INLINE static type bit_or    (type a, type b) noexcept { return _mm_or_si128    (a, b); }
+	FORCE_INLINE static type bit_xor   (type a, type b) noexcept { return _mm_xor_si128   (a, b); }
+	FORCE_INLINE static type bit_andnot(type a, type b) noexcept { return _mm_andnot_si128(a, b); } // ~a & b
+	FORCE_INLINE static type bit_not   (type x)         noexcept { return _mm_xor_si128   (x, _mm_set1_epi32(-1)); }
+
+	// Lane-wise comparison and selection, mask ? a : b. Without
+	// SSE4.2, a > b is the sign of b - a, unless the signs differ.
+	FORCE_INLINE static mask cmpgt(type a, type b) noexcept {
+		const __m128i diff = _mm_or_si128(_mm_andnot_si128(_mm_xor_si128(a, b), _mm_sub_epi64(b, a)), _mm_andnot_si128(a, b));
+		return sign(diff);
+	}
+	FORCE_INLINE static mask cmpeq (type a, type b)         noexcept { return _mm_cmpeq_epi64(a, b); }
+	FORCE_INLINE static mask cmplt (type a, type b)         noexcept { return cmpgt(b, a); }
+	FORCE_INLINE static mask cmple (type a, type b)         noexcept { return mask_not(cmpgt(a, b)); }
+	FORCE_INLINE static mask cmpneq(type a, type b)         noexcept { return mask_not(cmpeq(a, b)); }
+	FORCE_INLINE static mask cmpge (type a, type b)         noexcept { return mask_not(cmpgt(b, a)); }
+	FORCE_INLINE static type select(mask m, type a, type b) noexcept { return _mm_blendv_epi8(b, a, m); }
+
+	// Mask logic and reductions. movemask() sets bit i for lane i
+	FORCE_INLINE static mask mask_and(mask a, mask b) noexcept { return _mm_and_si128(a, b); }
+	FORCE_INLINE static mask mask_or (mask a, mask b) noexcept { return _mm_or_si128(a, b); }
+	FORCE_INLINE static mask mask_not(mask m)         noexcept { return _mm_xor_si128(m, _mm_set1_epi32(-1)); }
+	FORCE_INLINE static unsigned movemask(mask m)     noexcept { return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(m))); }
+	FORCE_INLINE static bool any(mask m)              noexcept { return movemask(m) != 0; }
+	FORCE_INLINE static bool all(mask m)              noexcept { return movemask(m) == 0x3u; }
+
+	FORCE_INLINE static type one()  noexcept { return _mm_set1_epi64x(1); }
+	FORCE_INLINE static type zero() noexcept { return _mm_setzero_si128(); }
+	FORCE_INLINE static type set(std::int64_t x) noexcept { return _mm_set1_epi64x(x); }
+
+	// Wrapping sum of the lanes
+	FORCE_INLINE static std::int64_t hsum(type x) noexcept { return _mm_cvtsi128_si64(_mm_add_epi64(x, _mm_unpackhi_epi64(x, x))); }
+
+	FORCE_INLINE static constexpr size_t width() noexcept { return 2; }
+	FORCE_INLINE static constexpr size_t alignment() noexcept { return alignof(type); }
+
+	// Memory operations, see the float backend
+	FORCE_INLINE static type loadu(const std::int64_t* FORCE_RESTRICT ptr) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)); }
+	FORCE_INLINE static type loada(const std::int64_t* FORCE_RESTRICT ptr) noexcept { return _mm_load_si128 (reinterpret_cast<const __m128i*>(ptr)); }
+	FORCE_INLINE static void unloadu(std::int64_t* FORCE_RESTRICT ptr, type x) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), x); }
+	FORCE_INLINE static void unloada(std::int64_t* FORCE_RESTRICT ptr, type x) noexcept { _mm_store_si128 (reinterpret_cast<__m128i*>(ptr), x); }
+	FORCE_INLINE static void stream (std::int64_t* FORCE_RESTRICT ptr, type x) noexcept { _mm_stream_si128(reinterpret_cast<__m128i*>(ptr), x); }
+	FORCE_INLINE static void sfence() noexcept { _mm_sfence(); }
+	FORCE_INLINE static void prefetch(const std::int64_t* ptr) noexcept { _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0); }
+	FORCE_INLINE static type loadu_partial(const std::int64_t* FORCE_RESTRICT ptr, size_t n) noexcept {
+		alignas(16) std::int64_t tmp[width()] = {};
+		for (size_t i = 0; i < n; ++i) tmp[i] = ptr[i];
+		return loada(tmp);
+	}
+	FORCE_INLINE static void unloadu_partial(std::int64_t* FORCE_RESTRICT ptr, type x, size_t n) noexcept {
+		alignas(16) std::int64_t tmp[width()];
+		unloada(tmp, x);
+		for (size_t i = 0; i < n; ++i) ptr[i] = tmp[i];
+	}
+
+	// Conversions with double lanes. Adding 2^52 + 2^51 rounds x to an
+	// integer held in the low mantissa bits, for |x| < 2^51. The other
+	// way is exact over the whole range: the high 48 bits, offset by
+	// 3 * 2^67, and the low 16 bits, offset by 2^52, are summed after
+	// removing both offsets.
+	// Source: stackoverflow.com/q/41144668, Mysticial - 2016
+	FORCE_INLINE static type from_float(floating x) noexcept {
+		const __m128d magic = _mm_set1_pd(0x1.8p52);
+		return _mm_sub_epi64(_mm_castpd_si128(_mm_add_pd(x, magic)), _mm_castpd_si128(magic));
+	}
+	FORCE_INLINE static type from_float_trunc(floating x) noexcept { return from_float(_mm_round_pd(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)); }
+	FORCE_INLINE static floating to_float(type x) noexcept {
+		const __m128i high = _mm_add_epi64(_mm_blend_epi16(_mm_srai_epi32(x, 16), _mm_setzero_si128(), 0x33), _mm_castpd_si128(_mm_set1_pd(0x3p67)));
+		const __m128i low  = _mm_blend_epi16(x, _mm_castpd_si128(_mm_set1_pd(0x1p52)), 0x88);
+		return _mm_add_pd(_mm_sub_pd(_mm_castsi128_pd(high), _mm_set1_pd(0x3p67 + 0x1p52)), _mm_castsi128_pd(low));
+	}
+
+	// Indexed accesses, lane i being base[idx[i]]. There are no gather
+	// nor scatter instructions: lanes are moved one by one.
+	FORCE_INLINE static type gather(const std::int64_t* base, index idx) noexcept { return detail::gatherLanes<ComputeBackend>(base, idx); }
+	FORCE_INLINE static type mask_gather(type src, mask m, const std::int64_t* base, index idx) noexcept { return detail::maskGatherLanes<ComputeBackend>(src, m, base, idx); }
+	FORCE_INLINE static void scatter(std::int64_t* base, index idx, type x) noexcept { detail::scatterLanes<ComputeBackend>(base, idx, x); }
+	FORCE_INLINE static void mask_scatter(std::int64_t* base, mask m, index idx, type x) noexcept { detail::maskScatterLanes<ComputeBackend>(base, m, idx, x); }
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,143 @@
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vectra/core/attributes.hpp>
+#include <vectra/detail/bit_cast.hpp>
+
+// F16C conversions between float and IEEE half precision. GCC and
+// clang define __F16C__ (e.g. -mf16c, -march=haswell), MSVC has no
+// macro for it and enables it with /arch:AVX2.
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+	#define VECTRA_HAS_F16C 1
+#endif
+
+
+namespace vectra
+{
+
+namespace detail
+{
+
+// Round to nearest even, like F16C. NaN are quieted and keep the high
+// bits of their payload, values beyond the half range become infinite.
+FORCE_INLINE std::uint16_t floatToHalf(float f) noexcept
+{
+	const std::uint32_t x    = bit_cast<std::uint32_t>(f);
+	const std::uint32_t sign = (x >> 16) & 0x8000u;
+	const std::uint32_t abs  = x & 0x7FFFFFFFu;
+
+	if (abs > 0x7F800000u) // NaN
+		return static_cast<std::uint16_t>(sign | 0x7E00u | ((abs >> 13) & 0x3FFu));
+	if (abs >= 0x477FF000u) // Rounds to 65536 or more, or infinite
+		return static_cast<std::uint16_t>(sign | 0x7C00u);
+	if (abs < 0x38800000u) // Below 2^-14: subnormal half, rounded by a float addition
+		return static_cast<std::uint16_t>(sign | (bit_cast<std::uint32_t>(bit_cast<float>(abs) + 0.5f) - 0x3F000000u));
+
+	// Normal half: exponent rebiased from 127 to 15, then rounded
+	return static_cast<std::uint16_t>(sign | ((abs - 0x38000000u + 0xFFFu + ((abs >> 13) & 1u)) >> 13));
+}
+
+// Exact. NaN are quieted, like F16C.
+FORCE_INLINE float halfToFloat(std::uint16_t h) noexcept
+{
+	const std::uint32_t sign = std::uint32_t(h & 0x8000u) << 16;
+	const std::uint32_t abs  = h & 0x7FFFu;
+
+	if (abs >= 0x7C00u) // Infinite or NaN
+		return bit_cast<float>(sign | 0x7F800000u | (abs > 0x7C00u ? 0x400000u : 0u) | ((abs & 0x3FFu) << 13));
+	if (abs < 0x0400u) // Zero or subnormal: abs * 2^-24
+	{
+		const float m = static_cast<float>(abs) * 5.9604644775390625e-8f;
+		return bit_cast<float>(sign | bit_cast<std::uint32_t>(m));
+	}
+
+	return bit_cast<float>(sign | ((abs << 13) + 0x38000000u));
+}
+
+// Round to nearest even. NaN are quieted.
+FORCE_INLINE std::uint16_t floatToBfloat16(float f) noexcept
+{
+	const std::uint32_t x = bit_cast<std::uint32_t>(f);
+
+	if ((x & 0x7FFFFFFFu) > 0x7F800000u)
+		return static_cast<std::uint16_t>((x >> 16) | 0x40u);
+
+	return static_cast<std::uint16_t>((x + 0x7FFFu + ((x >> 16) & 1u)) >> 16);
+}
+
+// Exact: bfloat16 is the high half of a float
+FORCE_INLINE float bfloat16ToFloat(std::uint16_t b) noexcept
+{
+	return bit_cast<float>(std::uint32_t(b) << 16);
+}
+
+}
+
+/*
+ * @brief 16-bit floating-point storage types.
+ *
+ *  - half    : IEEE 754 binary16, 5 exponent and 10 mantissa bits,
+ *              range +-65504, about 3 decimal digits.
+ *  - bfloat16: the high half of a float, 8 exponent and 7 mantissa
+ *              bits, the float range with about 2 decimal digits.
+ *
+ * Storage only: arithmetic is done in float, after widening them
+ * with the float backends (loadu overloads, Vectratype constructors)
+ * or convert(). Narrowing rounds to nearest even, and is exact the
+ * other way. Both are trivially copyable, zero when value-initialized.
+ */
+struct half
+{
+	std::uint16_t bits;
+
+	half() noexcept = default;
+	FORCE_INLINE explicit half(float f) noexcept : bits(detail::floatToHalf(f)) {}
+
+	FORCE_INLINE explicit operator float() const noexcept { return detail::halfToFloat(bits); }
+
+	FORCE_INLINE static half from_bits(std::uint16_t b) noexcept { half h; h.bits = b; return h; }
+};
+
+struct bfloat16
+{
+	std::uint16_t bits;
+
+	bfloat16() noexcept = default;
+	FORCE_INLINE explicit bfloat16(float f) noexcept : bits(detail::floatToBfloat16(f)) {}
+
+	FORCE_INLINE explicit operator float() const noexcept { return detail::bfloat16ToFloat(bits); }
+
+	FORCE_INLINE static bfloat16 from_bits(std::uint16_t b) noexcept { bfloat16 h; h.bits = b; return h; }
+};
+
+static_assert(sizeof(half) == 2 && sizeof(bfloat16) == 2, "16-bit storage types must not be padded.");
+
+namespace detail
+{
+
+// Partial loads and stores of 16-bit storage, for array tails: the
+// first n lanes go through a stack buffer, the others are zeros
+template <typename Backend, typename H>
+FORCE_INLINE typename Backend::type loadPartial16(const H* ptr, std::size_t n) noexcept
+{
+	H tmp[Backend::width()] = {};
+	for (std::size_t i = 0; i < n; ++i)
+		tmp[i] = ptr[i];
+	return Backend::loadu(tmp);
+}
+
+template <typename Backend, typename H>
+FORCE_INLINE void storePartial16(H* ptr, typename Backend::type x, std::size_t n) noexcept
+{
+	H tmp[Backend::width()];
+	Backend::unloadu(tmp, x);
+	for (std::size_t i = 0; i < n; ++i)
+		ptr[i] = tmp[i];
+}
+
+}
+
+}
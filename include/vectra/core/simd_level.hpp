@@ -39,6 +39,56 @@ constexpr const char* toString(SIMDLevel level)
     return "Unknown";
 }
 
+/*
+ * @brief Parses a SIMD level from its name, as given by toString().
+ *
+ * The comparison is case-insensitive. Returns fallback when name is
+ * null or does not match any level.
+ */
+constexpr SIMDLevel fromString(const char* name, SIMDLevel fallback)
+{
+    if (name == nullptr)
+        return fallback;
+
+    for (std::uint8_t i = 0; i <= static_cast<std::uint8_t>(SIMDLevel::AVX512); ++i)
+    {
+        const SIMDLevel level = static_cast<SIMDLevel>(i);
+        const char* a = toString(level);
+        const char* b = name;
+
+        // ASCII only, without <cctype> which is not constexpr
+        auto lower = [](char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; };
+        while (*a != '\0' && lower(*a) == lower(*b)) { ++a; ++b; }
+
+        if (*a == '\0' && *b == '\0')
+            return level;
+    }
+    return fallback;
+}
+
+/*
+ * @brief Highest level with a backend enabled by the compiler flags.
+ *
+ * Only levels having a ComputeBackend are returned, e.g. SSE42 maps
+ * to SSE41. MSVC implies FMA with /arch:AVX2, and does not define
+ * a macro for it. It is the default level of the array algorithms, which
+ * are compiled for a single instruction set.
+ */
+constexpr SIMDLevel compiletimeSIMDLevel()
+{
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+    return SIMDLevel::AVX512;
+#elif defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+    return SIMDLevel::AVX2;
+#elif defined(__AVX__)
+    return SIMDLevel::AVX;
+#elif defined(__SSE4_1__)
+    return SIMDLevel::SSE41;
+#else
+    return SIMDLevel::None;
+#endif
+}
+
 inline std::ostream& operator<<(std::ostream& os, SIMDLevel level)
 {
     return os << toString(level);
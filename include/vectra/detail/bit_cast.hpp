@@ -0,0 +1,32 @@
+#pragma once
+
+
+#include <cstring>
+#include <type_traits>
+
+#include <vectra/core/attributes.hpp>
+
+
+namespace vectra::detail
+{
+
+/*
+ * @brief Reinterprets the bits of a value as another type.
+ *
+ * Equivalent to C++20 std::bit_cast, written with std::memcpy so
+ * that it stays well-defined in C++17. Compilers optimize it away
+ */
+template <typename To, typename From>
+FORCE_INLINE To bit_cast(const From& from) noexcept
+{
+	static_assert(sizeof(To) == sizeof(From),
+		"bit_cast requires types of the same size.");
+	static_assert(std::is_trivially_copyable_v<To> && std::is_trivially_copyable_v<From>,
+		"bit_cast requires trivially copyable types.");
+
+	To to;
+	std::memcpy(&to, &from, sizeof(To));
+	return to;
+}
+
+}
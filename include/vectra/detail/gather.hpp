@@ -0,0 +1,87 @@
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <vectra/core/attributes.hpp>
+
+
+namespace vectra::detail
+{
+
+// Signed indices of gathers and scatters, of the width of the values
+// (int32_t for float and int32_t, int64_t for double and int64_t), so
+// that the index register has as many lanes as the value register
+template <typename T>
+using index_t = std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>;
+
+/*
+ * @brief Gathers and scatters lane by lane, for the backends without
+ * the instructions: SSE4.1 and AVX, and scatters before AVX-512.
+ *
+ * Indices and values go through the stack. Masked-off lanes keep src
+ * and their indices are never dereferenced; scatters write the lanes
+ * in order, so the highest one wins when indices repeat, as with the
+ * AVX-512 instructions.
+ */
+template <typename Backend, typename T>
+FORCE_INLINE typename Backend::type gatherLanes(const T* base, typename Backend::index idx) noexcept
+{
+	index_t<T> i[Backend::width()];
+	T lanes[Backend::width()];
+	static_assert(sizeof(i) == sizeof(idx), "One index per lane.");
+
+	std::memcpy(i, &idx, sizeof(i));
+	for (std::size_t k = 0; k < Backend::width(); ++k)
+		lanes[k] = base[i[k]];
+	return Backend::loadu(lanes);
+}
+
+template <typename Backend, typename T>
+FORCE_INLINE typename Backend::type maskGatherLanes(typename Backend::type src, typename Backend::mask m, const T* base, typename Backend::index idx) noexcept
+{
+	index_t<T> i[Backend::width()];
+	T lanes[Backend::width()];
+	static_assert(sizeof(i) == sizeof(idx), "One index per lane.");
+
+	std::memcpy(i, &idx, sizeof(i));
+	Backend::unloadu(lanes, src);
+	const unsigned bits = Backend::movemask(m);
+	for (std::size_t k = 0; k < Backend::width(); ++k)
+		if ((bits >> k) & 1u)
+			lanes[k] = base[i[k]];
+	return Backend::loadu(lanes);
+}
+
+template <typename Backend, typename T>
+FORCE_INLINE void scatterLanes(T* base, typename Backend::index idx, typename Backend::type x) noexcept
+{
+	index_t<T> i[Backend::width()];
+	T lanes[Backend::width()];
+	static_assert(sizeof(i) == sizeof(idx), "One index per lane.");
+
+	std::memcpy(i, &idx, sizeof(i));
+	Backend::unloadu(lanes, x);
+	for (std::size_t k = 0; k < Backend::width(); ++k)
+		base[i[k]] = lanes[k];
+}
+
+template <typename Backend, typename T>
+FORCE_INLINE void maskScatterLanes(T* base, typename Backend::mask m, typename Backend::index idx, typename Backend::type x) noexcept
+{
+	index_t<T> i[Backend::width()];
+	T lanes[Backend::width()];
+	static_assert(sizeof(i) == sizeof(idx), "One index per lane.");
+
+	std::memcpy(i, &idx, sizeof(i));
+	Backend::unloadu(lanes, x);
+	const unsigned bits = Backend::movemask(m);
+	for (std::size_t k = 0; k < Backend::width(); ++k)
+		if ((bits >> k) & 1u)
+			base[i[k]] = lanes[k];
+}
+
+}
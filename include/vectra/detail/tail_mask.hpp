@@ -0,0 +1,21 @@
+#pragma once
+
+
+#include <cstdint>
+
+
+namespace vectra::detail
+{
+
+/*
+ * @brief Sliding windows of lane masks, for partial loads and stores.
+ *
+ * Reading width() lanes from &table[width() - n] gives a mask whose
+ * n leading lanes are set, and the remaining ones cleared. It is the
+ * way to build tail masks on AVX and AVX2, which have masked memory
+ * operations but no mask registers.
+ */
+alignas(64) inline constexpr std::int32_t tail_mask_epi32[16] = { -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0 };
+alignas(64) inline constexpr std::int64_t tail_mask_epi64[8]  = { -1, -1, -1, -1, 0, 0, 0, 0 };
+
+}
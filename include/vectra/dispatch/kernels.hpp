@@ -0,0 +1,88 @@
+#pragma once
+
+
+#include <cstddef>
+
+#include <vectra/core/simd_level.hpp>
+
+
+// Runtime-dispatched kernels. Unlike the rest of the library, they
+// are not header-only: link against the vectra_kernels target, that
+// compiles every kernel once per instruction set.
+namespace vectra::kernels
+{
+
+// Kernels process n contiguous elements. out may alias the inputs,
+// but must not partially overlap them.
+template <typename T> using unary_kernel  = void (*)(const T* in, T* out, std::size_t n);
+template <typename T> using binary_kernel = void (*)(const T* a, const T* b, T* out, std::size_t n);
+
+/*
+ * @brief Function-pointer table holding the kernels of one backend.
+ */
+template <typename T>
+struct kernel_table
+{
+	SIMDLevel level;
+
+	unary_kernel<T> sin;
+	unary_kernel<T> cos;
+	unary_kernel<T> asin;
+	unary_kernel<T> acos;
+	unary_kernel<T> atan;
+	unary_kernel<T> sqrt;
+	unary_kernel<T> cbrt;
+	unary_kernel<T> exp;
+	unary_kernel<T> exp2;
+	unary_kernel<T> expm1;
+	unary_kernel<T> log;
+	unary_kernel<T> log2;
+	unary_kernel<T> log1p;
+
+	binary_kernel<T> atan2;
+	binary_kernel<T> pow;
+};
+
+/*
+ * @brief SIMD level of the kernels used by this process.
+ *
+ * It is the highest level supported at runtime, unless lowered by
+ * the VECTRA_SIMD_LEVEL environment variable (e.g. "AVX2", "SSE41",
+ * "None"). Levels above the processor capabilities are ignored. It
+ * is resolved once, on first use, and then cached.
+ */
+SIMDLevel activeLevel() noexcept;
+
+/*
+ * @brief Kernel table of the given level.
+ *
+ * Levels without a dedicated backend fall back to the closest one
+ * below (e.g. SSE42 uses the SSE41 kernels). Callers are responsible
+ * for only running tables supported by the processor.
+ */
+template <typename T>
+const kernel_table<T>& table(SIMDLevel level) noexcept;
+
+// Kernel table of activeLevel(), resolved once and then cached
+template <typename T>
+const kernel_table<T>& table() noexcept;
+
+// Dispatched entry points, using the cached table
+template <typename T> void sin  (const T* in, T* out, std::size_t n) { table<T>().sin  (in, out, n); }
+template <typename T> void cos  (const T* in, T* out, std::size_t n) { table<T>().cos  (in, out, n); }
+template <typename T> void asin (const T* in, T* out, std::size_t n) { table<T>().asin (in, out, n); }
+template <typename T> void acos (const T* in, T* out, std::size_t n) { table<T>().acos (in, out, n); }
+template <typename T> void atan (const T* in, T* out, std::size_t n) { table<T>().atan (in, out, n); }
+template <typename T> void sqrt (const T* in, T* out, std::size_t n) { table<T>().sqrt (in, out, n); }
+template <typename T> void cbrt (const T* in, T* out, std::size_t n) { table<T>().cbrt (in, out, n); }
+template <typename T> void exp  (const T* in, T* out, std::size_t n) { table<T>().exp  (in, out, n); }
+template <typename T> void exp2 (const T* in, T* out, std::size_t n) { table<T>().exp2 (in, out, n); }
+template <typename T> void expm1(const T* in, T* out, std::size_t n) { table<T>().expm1(in, out, n); }
+template <typename T> void log  (const T* in, T* out, std::size_t n) { table<T>().log  (in, out, n); }
+template <typename T> void log2 (const T* in, T* out, std::size_t n) { table<T>().log2 (in, out, n); }
+template <typename T> void log1p(const T* in, T* out, std::size_t n) { table<T>().log1p(in, out, n); }
+
+template <typename T> void atan2(const T* y, const T* x, T* out, std::size_t n) { table<T>().atan2(y, x, out, n); }
+template <typename T> void pow  (const T* a, const T* b, T* out, std::size_t n) { table<T>().pow  (a, b, out, n); }
+
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 
+#include <cstdint>
+
 #include "vectra/core/simd_level.hpp"
 #include "vectra/detail/cpuid.hpp"
 
@@ -8,7 +10,62 @@
 namespace vectra
 {
 
-inline SIMDLevel highestRuntimeSIMDLevel() {
+namespace detail
+{
+
+// What the processor and the operating system report, as read by
+// detectRuntimeSIMDLevel() from CPUID and XCR0
+struct cpu_features
+{
+	bool sse      = false;
+	bool sse2     = false;
+	bool sse3     = false;
+	bool ssse3    = false;
+	bool sse41    = false;
+	bool sse42    = false;
+	bool avx      = false;
+	bool fma      = false;
+	bool osxsave  = false;
+	bool avx2     = false;
+	bool avx512f  = false;
+	bool avx512dq = false;
+
+	// Extended Control Register 0, zero when OSXSAVE is not set
+	std::uint64_t xcr0 = 0;
+};
+
+/*
+ * @brief Highest level usable with the given features.
+ *
+ * In order to use AVX and later, the XCR0 register must show that the
+ * operating system saves the wider registers on context switches.
+ * AVX and AVX2 use the XMM and YMM registers, bits 1 and 2 of XCR0:
+ * mask 0000 0110 (0x6). AVX-512 also needs the ZMM state, bits 5, 6
+ * and 7: mask 1110 0110 (0xE6).
+ * Source can be found: en.wikipedia.org/wiki/Control_register
+ */
+constexpr SIMDLevel levelFromFeatures(const cpu_features& f) noexcept
+{
+	const bool ymm = f.osxsave && (f.xcr0 & 0x6)  == 0x6;
+	const bool zmm = f.osxsave && (f.xcr0 & 0xE6) == 0xE6;
+
+	if (f.avx512f && f.avx512dq && zmm) return SIMDLevel::AVX512;
+	// The AVX2 backend also relies on FMA3, which came with it on
+	// every Intel and AMD processor, but is a distinct CPUID bit.
+	if (f.avx2 && f.fma && ymm)         return SIMDLevel::AVX2;
+	if (f.avx && ymm)                   return SIMDLevel::AVX;
+	if (f.sse42)                        return SIMDLevel::SSE42;
+	if (f.sse41)                        return SIMDLevel::SSE41;
+	if (f.ssse3)                        return SIMDLevel::SSSE3;
+	if (f.sse3)                         return SIMDLevel::SSE3;
+	if (f.sse2)                         return SIMDLevel::SSE2;
+	if (f.sse)                          return SIMDLevel::SSE;
+	return SIMDLevel::None;
+}
+
+// Queries the processor and the operating system. Prefer the cached
+// highestRuntimeSIMDLevel(), the result cannot change during a run.
+inline SIMDLevel detectRuntimeSIMDLevel() {
 
 	// Vectra currently only supports x86-64 architecture 
 	// For other architectures, returns SIMDLevel::None.
@@ -20,39 +77,44 @@ inline SIMDLevel highestRuntimeSIMDLevel() {
 		detail::cpuid(info, 0);
 		std::uint32_t maxID = info[0];
 
-		if (maxID >= 1) {
-			// All the following bit instructions are manufacturer specific,
-			// but usually there are standardized for sake of compatibility.
-			// Source can be found on en.wikipedia.org/wiki/CPUID
-
-			// Runs the CPUID instruction, reads and stores the CPU registers
-			// in the info array. Each bit can be used to read compatibility.
-			// Until AVX, all features are stored in the EAX=1 register.
-			detail::cpuid(info, 1);
-
-			//   Feature |  Register |   Bit
-			//   SSE     |  EDX      |   Bit 25
-			bool sse     = (info[3]  & (1 << 25)) != 0;
-			//   SSE2    |  EDX      |   Bit 26
-			bool sse2    = (info[3]  & (1 << 26)) != 0;
-			//   SSE3    |  ECX      |   Bit 0
-			bool sse3    = (info[2]  & (1 << 0))  != 0;
-			//   SSSE3   |  ECX      |   Bit 9
-			bool ssse3   = (info[2]  & (1 << 9))  != 0;
-			//   SSE4.1  |  ECX      |   Bit 19
-			bool sse41   = (info[2]  & (1 << 19)) != 0;
-			//   SSE4.2  |  ECX      |   Bit 20
-			bool sse42   = (info[2]  & (1 << 20)) != 0;
-			//   AVX     |  ECX      |   Bit 28
-			bool avx     = (info[2]  & (1 << 28)) != 0;
-
-			// The OS must support XSAVE to use AVX and later instructions.
-			// This should also be checked before using AVX, AVX2 or AVX512
-
-			//   XSAVE   |  ECX     |   Bit 27
-			bool osxsave = (info[2] & (1 << 27)) != 0;
-
-			// AVX2 and AVX512 are stored in the EAX=7, ECX=0 register.
+		if (maxID < 1)
+			return SIMDLevel::None;
+
+		// All the following bit instructions are manufacturer specific,
+		// but usually there are standardized for sake of compatibility.
+		// Source can be found on en.wikipedia.org/wiki/CPUID
+		cpu_features f;
+
+		// Runs the CPUID instruction, reads and stores the CPU registers
+		// in the info array. Each bit can be used to read compatibility.
+		// Until AVX, all features are stored in the EAX=1 register.
+		detail::cpuid(info, 1);
+
+		//   Feature |  Register |   Bit
+		//   SSE     |  EDX      |   Bit 25
+		f.sse     = (info[3]  & (1 << 25)) != 0;
+		//   SSE2    |  EDX      |   Bit 26
+		f.sse2    = (info[3]  & (1 << 26)) != 0;
+		//   SSE3    |  ECX      |   Bit 0
+		f.sse3    = (info[2]  & (1 << 0))  != 0;
+		//   SSSE3   |  ECX      |   Bit 9
+		f.ssse3   = (info[2]  & (1 << 9))  != 0;
+		//   SSE4.1  |  ECX      |   Bit 19
+		f.sse41   = (info[2]  & (1 << 19)) != 0;
+		//   SSE4.2  |  ECX      |   Bit 20
+		f.sse42   = (info[2]  & (1 << 20)) != 0;
+		//   AVX     |  ECX      |   Bit 28
+		f.avx     = (info[2]  & (1 << 28)) != 0;
+		//   FMA     |  ECX      |   Bit 12
+		f.fma     = (info[2]  & (1 << 12)) != 0;
+
+		// The OS must support XSAVE to use AVX and later instructions.
+		//   XSAVE   |  ECX     |   Bit 27
+		f.osxsave = (info[2] & (1 << 27)) != 0;
+
+		// AVX2 and AVX512 are stored in the EAX=7, ECX=0 register.
+		if (maxID >= 7)
+		{
 			detail::cpuid(info, 7, 0);
 
 			// Most of the AVX-512 functions needed belong to the AVX512F
@@ -63,47 +125,38 @@ inline SIMDLevel highestRuntimeSIMDLevel() {
 
 			//   Feature  |  Register |   Bit
 			//   AVX2     |  EBX      |   Bit 5
-			bool avx2     = (info[1]  & (1 << 5))  != 0;
+			f.avx2     = (info[1]  & (1 << 5))  != 0;
 			//   AVX512F  |  EBX      |   Bit 16
-			bool avx512f  = (info[1]  & (1 << 16)) != 0;
+			f.avx512f  = (info[1]  & (1 << 16)) != 0;
 			//   AVX512DQ |  EBX      |   Bit 17
-			bool avx512dq = (info[1]  & (1 << 17)) != 0;
-
-			// In order to use AVX and later, one must check XCR0, i.e. the
-			// Extended Control Register 0 to ensure that the XMM, YMM, and
-			// ZMM registers are enabled.
-			// Source can be found: en.wikipedia.org/wiki/Control_register
-
-			// AVX2 and AVX512 use the XMM, YMM and ZMM registers. We could
-			// check their accessibility by reading the XCR0 register using
-			// the bits 1 (XMM), 2 (YMM) and 5, 6, 7 (ZMM). Let's apply the
-			// mask 1110 0110 (0xE6 in hexadecimal) and check its value.
-			bool avx2Registers = (detail::xgetbv(0) & 0xE6) == 0xE6;
-			// AVX, AVX2 and AVX512 all use the XMM and YMM registers. They
-			// have their accessibility encoded in the XCR0 register at the
-			// bits 1 for XMM and 2 for YMM. Let's apply the mask 0000 0110
-			// (0x6 in hexadecimal) to the XCR0 and check its value.
-			bool avxRegister = (detail::xgetbv(0) & 0x6) == 0x6;
-
-			if (avx512f && avx512dq && osxsave && avx2Registers) return SIMDLevel::AVX512;
-			if (avx2                && osxsave && avx2Registers) return SIMDLevel::AVX2;
-			if (avx                 && osxsave && avxRegister)   return SIMDLevel::AVX;
-			if (sse42)							 	             return SIMDLevel::SSE42;
-			if (sse41)						 					 return SIMDLevel::SSE41;
-			if (ssse3)											 return SIMDLevel::SSSE3;
-			if (sse3)											 return SIMDLevel::SSE3;
-			if (sse2)											 return SIMDLevel::SSE2;
-			if (sse)											 return SIMDLevel::SSE;
-			else												 return SIMDLevel::None;
-
+			f.avx512dq = (info[1]  & (1 << 17)) != 0;
 		}
-		else
-			return SIMDLevel::None;
-		
+
+		// XGETBV itself faults when OSXSAVE is not set, so it is only
+		// executed after that bit has been checked, and only once.
+		f.xcr0 = f.osxsave ? detail::xgetbv(0) : 0;
+
+		return levelFromFeatures(f);
+
 	// ARM and other architectures are not supported yet
 	#else
 		return SIMDLevel::None;
 	#endif
 }
 
-}
\ No newline at end of file
+}
+
+/*
+ * @brief Returns the highest SIMD level supported by the processor
+ * and enabled by the operating system.
+ *
+ * Detection runs CPUID and XGETBV, which are serializing and cost
+ * hundreds of cycles. It is done once, on first call, and the result
+ * is cached for the rest of the program (thread-safe since C++11).
+ */
+inline SIMDLevel highestRuntimeSIMDLevel() {
+	static const SIMDLevel level = detail::detectRuntimeSIMDLevel();
+	return level;
+}
+
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/simd_level.hpp>
+#include <vectra/types/vectratype.hpp>
+
+
+namespace vectra
+{
+
+/*
+ * @brief Base class of the lazily evaluated array expressions.
+ *
+ * Operators on arrays do not compute anything: they build a tree of
+ * expression nodes, whose type encodes the whole computation. It is
+ * only evaluated when assigned to an array, in a single loop where
+ * each register of the result is computed from the leaves, without
+ * any temporary array. Memory is thus traversed once, whatever the
+ * number of operations.
+ *
+ * Every node provides:
+ *  - value_type, level  : scalar type and SIMD level of the tree
+ *  - is_scalar          : true for broadcast scalars (no size)
+ *  - by_reference       : true for leaves owning memory (arrays),
+ *                         held by reference rather than copied
+ *  - size()             : number of elements
+ *  - evaluate(i)        : register of elements [i ; i + width[, i
+ *                         being a multiple of the register width
+ *  - evaluate_partial(i, n): same, for the n < width last elements
+ *  - reads(p)           : whether a leaf of the tree is the buffer p,
+ *                         e.g. the array assigned in a *= 2
+ */
+template <typename Derived>
+struct expression
+{
+	FORCE_INLINE const Derived& derived() const noexcept { return static_cast<const Derived&>(*this); }
+};
+
+namespace detail
+{
+
+template <typename E>
+using stored_t = std::conditional_t<E::by_reference, const E&, E>;
+
+template <typename E>
+inline constexpr bool is_expression_v = std::is_base_of_v<expression<E>, E>;
+
+}
+
+// Scalar broadcast to every lane, e.g. the 2 of 2 * a
+template <typename T, SIMDLevel simdLevel>
+class scalar_expression : public expression<scalar_expression<T, simdLevel>>
+{
+public:
+	using value_type = T;
+	using vct        = Vectratype<T, simdLevel>;
+
+	static constexpr SIMDLevel level        = simdLevel;
+	static constexpr bool      is_scalar    = true;
+	static constexpr bool      by_reference = false;
+
+	FORCE_INLINE explicit scalar_expression(T value) noexcept : value_(value) {}
+
+	FORCE_INLINE std::size_t size() const noexcept { return 0; }
+
+	FORCE_INLINE vct evaluate        (std::size_t)              const noexcept { return vct(value_); }
+	FORCE_INLINE vct evaluate_partial(std::size_t, std::size_t) const noexcept { return vct(value_); }
+
+	FORCE_INLINE bool reads(const void*) const noexcept { return false; }
+
+private:
+	T value_;
+};
+
+template <typename Op, typename E>
+class unary_expression : public expression<unary_expression<Op, E>>
+{
+public:
+	using value_type = typename E::value_type;
+	using vct        = Vectratype<value_type, E::level>;
+
+	static constexpr SIMDLevel level        = E::level;
+	static constexpr bool      is_scalar    = E::is_scalar;
+	static constexpr bool      by_reference = false;
+
+	FORCE_INLINE explicit unary_expression(const E& e) noexcept : e_(e) {}
+
+	FORCE_INLINE std::size_t size() const noexcept { return e_.size(); }
+
+	FORCE_INLINE vct evaluate        (std::size_t i)                const noexcept { return Op{}(e_.evaluate(i)); }
+	FORCE_INLINE vct evaluate_partial(std::size_t i, std::size_t n) const noexcept { return Op{}(e_.evaluate_partial(i, n)); }
+
+	FORCE_INLINE bool reads(const void* p) const noexcept { return e_.reads(p); }
+
+private:
+	detail::stored_t<E> e_;
+};
+
+template <typename Op, typename L, typename R>
+class binary_expression : public expression<binary_expression<Op, L, R>>
+{
+	static_assert(std::is_same_v<typename L::value_type, typename R::value_type>, "Operands must have the same scalar type.");
+	static_assert(L::level == R::level, "Operands must have the same SIMD level.");
+
+public:
+	using value_type = typename L::value_type;
+	using vct        = Vectratype<value_type, L::level>;
+
+	static constexpr SIMDLevel level        = L::level;
+	static constexpr bool      is_scalar    = L::is_scalar && R::is_scalar;
+	static constexpr bool      by_reference = false;
+
+	FORCE_INLINE binary_expression(const L& l, const R& r) noexcept : l_(l), r_(r)
+	{
+		assert(L::is_scalar || R::is_scalar || l.size() == r.size());
+	}
+
+	FORCE_INLINE std::size_t size() const noexcept { return L::is_scalar ? r_.size() : l_.size(); }
+
+	FORCE_INLINE vct evaluate        (std::size_t i)                const noexcept { return Op{}(l_.evaluate(i), r_.evaluate(i)); }
+	FORCE_INLINE vct evaluate_partial(std::size_t i, std::size_t n) const noexcept { return Op{}(l_.evaluate_partial(i, n), r_.evaluate_partial(i, n)); }
+
+	FORCE_INLINE bool reads(const void* p) const noexcept { return l_.reads(p) || r_.reads(p); }
+
+private:
+	detail::stored_t<L> l_;
+	detail::stored_t<R> r_;
+};
+
+namespace detail
+{
+
+// Operations of the expression nodes, applied to Vectratype registers
+struct op_add { template <typename V> FORCE_INLINE V operator()(V a, V b) const noexcept { return a + b; } };
+struct op_sub { template <typename V> FORCE_INLINE V operator()(V a, V b) const noexcept { return a - b; } };
+struct op_mul { template <typename V> FORCE_INLINE V operator()(V a, V b) const noexcept { return a * b; } };
+struct op_div { template <typename V> FORCE_INLINE V operator()(V a, V b) const noexcept { return a / b; } };
+struct op_min { template <typename V> FORCE_INLINE V operator()(V a, V b) const noexcept { return V::min(a, b); } };
+struct op_max { template <typename V> FORCE_INLINE V operator()(V a, V b) const noexcept { return V::max(a, b); } };
+struct op_pow { template <typename V> FORCE_INLINE V operator()(V a, V b) const noexcept { return V::pow(a, b); } };
+
+struct op_atan2 { template <typename V> FORCE_INLINE V operator()(V y, V x) const noexcept { return V::atan2(y, x); } };
+
+struct op_neg   { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return -x; } };
+struct op_abs   { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::abs  (x); } };
+struct op_sqrt  { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::sqrt (x); } };
+struct op_cbrt  { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::cbrt (x); } };
+struct op_exp   { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::exp  (x); } };
+struct op_exp2  { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::exp2 (x); } };
+struct op_expm1 { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::expm1(x); } };
+struct op_log   { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::log  (x); } };
+struct op_log2  { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::log2 (x); } };
+struct op_log1p { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::log1p(x); } };
+struct op_sin   { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::sin  (x); } };
+struct op_cos   { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::cos  (x); } };
+struct op_asin  { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::asin (x); } };
+struct op_acos  { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::acos (x); } };
+struct op_atan  { template <typename V> FORCE_INLINE V operator()(V x) const noexcept { return V::atan (x); } };
+
+template <typename E>
+using scalar_of = scalar_expression<typename E::value_type, E::level>;
+
+template <typename Op, typename L, typename R>
+FORCE_INLINE binary_expression<Op, L, R> makeBinary(const expression<L>& l, const expression<R>& r) noexcept
+{
+	return binary_expression<Op, L, R>(l.derived(), r.derived());
+}
+
+template <typename Op, typename E>
+FORCE_INLINE binary_expression<Op, E, scalar_of<E>> makeBinary(const expression<E>& e, typename E::value_type s) noexcept
+{
+	return binary_expression<Op, E, scalar_of<E>>(e.derived(), scalar_of<E>(s));
+}
+
+template <typename Op, typename E>
+FORCE_INLINE binary_expression<Op, scalar_of<E>, E> makeBinary(typename E::value_type s, const expression<E>& e) noexcept
+{
+	return binary_expression<Op, scalar_of<E>, E>(scalar_of<E>(s), e.derived());
+}
+
+}
+
+// Arithmetic operators, between expressions or with scalars
+template <typename L, typename R> FORCE_INLINE auto operator+(const expression<L>& l, const expression<R>& r) noexcept { return detail::makeBinary<detail::op_add>(l, r); }
+template <typename L, typename R> FORCE_INLINE auto operator-(const expression<L>& l, const expression<R>& r) noexcept { return detail::makeBinary<detail::op_sub>(l, r); }
+template <typename L, typename R> FORCE_INLINE auto operator*(const expression<L>& l, const expression<R>& r) noexcept { return detail::makeBinary<detail::op_mul>(l, r); }
+template <typename L, typename R> FORCE_INLINE auto operator/(const expression<L>& l, const expression<R>& r) noexcept { return detail::makeBinary<detail::op_div>(l, r); }
+
+template <typename E> FORCE_INLINE auto operator+(const expression<E>& e, typename E::value_type s) noexcept { return detail::makeBinary<detail::op_add, E>(e, s); }
+template <typename E> FORCE_INLINE auto operator-(const expression<E>& e, typename E::value_type s) noexcept { return detail::makeBinary<detail::op_sub, E>(e, s); }
+template <typename E> FORCE_INLINE auto operator*(const expression<E>& e, typename E::value_type s) noexcept { return detail::makeBinary<detail::op_mul, E>(e, s); }
+template <typename E> FORCE_INLINE auto operator/(const expression<E>& e, typename E::value_type s) noexcept { return detail::makeBinary<detail::op_div, E>(e, s); }
+
+template <typename E> FORCE_INLINE auto operator+(typename E::value_type s, const expression<E>& e) noexcept { return detail::makeBinary<detail::op_add, E>(s, e); }
+template <typename E> FORCE_INLINE auto operator-(typename E::value_type s, const expression<E>& e) noexcept { return detail::makeBinary<detail::op_sub, E>(s, e); }
+template <typename E> FORCE_INLINE auto operator*(typename E::value_type s, const expression<E>& e) noexcept { return detail::makeBinary<detail::op_mul, E>(s, e); }
+template <typename E> FORCE_INLINE auto operator/(typename E::value_type s, const expression<E>& e) noexcept { return detail::makeBinary<detail::op_div, E>(s, e); }
+
+template <typename E> FORCE_INLINE auto operator-(const expression<E>& e) noexcept { return unary_expression<detail::op_neg, E>(e.derived()); }
+
+// Element-wise functions, evaluated with the Vectratype kernels
+template <typename L, typename R> FORCE_INLINE auto min  (const expression<L>& l, const expression<R>& r) noexcept { return detail::makeBinary<detail::op_min  >(l, r); }
+template <typename L, typename R> FORCE_INLINE auto max  (const expression<L>& l, const expression<R>& r) noexcept { return detail::makeBinary<detail::op_max  >(l, r); }
+template <typename L, typename R> FORCE_INLINE auto pow  (const expression<L>& l, const expression<R>& r) noexcept { return detail::makeBinary<detail::op_pow  >(l, r); }
+template <typename L, typename R> FORCE_INLINE auto atan2(const expression<L>& y, const expression<R>& x) noexcept { return detail::makeBinary<detail::op_atan2>(y, x); }
+
+template <typename E> FORCE_INLINE auto abs  (const expression<E>& e) noexcept { return unary_expression<detail::op_abs  , E>(e.derived()); }
+template <typename E> FORCE_INLINE auto sqrt (const expression<E>& e) noexcept { return unary_expression<detail::op_sqrt , E>(e.derived()); }
+template <typename E> FORCE_INLINE auto cbrt (const expression<E>& e) noexcept { return unary_expression<detail::op_cbrt , E>(e.derived()); }
+template <typename E> FORCE_INLINE auto exp  (const expression<E>& e) noexcept { return unary_expression<detail::op_exp  , E>(e.derived()); }
+template <typename E> FORCE_INLINE auto exp2 (const expression<E>& e) noexcept { return unary_expression<detail::op_exp2 , E>(e.derived()); }
+template <typename E> FORCE_INLINE auto expm1(const expression<E>& e) noexcept { return unary_expression<detail::op_expm1, E>(e.derived()); }
+template <typename E> FORCE_INLINE auto log  (const expression<E>& e) noexcept { return unary_expression<detail::op_log  , E>(e.derived()); }
+template <typename E> FORCE_INLINE auto log2 (const expression<E>& e) noexcept { return unary_expression<detail::op_log2 , E>(e.derived()); }
+template <typename E> FORCE_INLINE auto log1p(const expression<E>& e) noexcept { return unary_expression<detail::op_log1p, E>(e.derived()); }
+template <typename E> FORCE_INLINE auto sin  (const expression<E>& e) noexcept { return unary_expression<detail::op_sin  , E>(e.derived()); }
+template <typename E> FORCE_INLINE auto cos  (const expression<E>& e) noexcept { return unary_expression<detail::op_cos  , E>(e.derived()); }
+template <typename E> FORCE_INLINE auto asin (const expression<E>& e) noexcept { return unary_expression<detail::op_asin , E>(e.derived()); }
+template <typename E> FORCE_INLINE auto acos (const expression<E>& e) noexcept { return unary_expression<detail::op_acos , E>(e.derived()); }
+template <typename E> FORCE_INLINE auto atan (const expression<E>& e) noexcept { return unary_expression<detail::op_atan , E>(e.derived()); }
+
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+
+#include <type_traits>
+
+#include <vectra/core/attributes.hpp>
+#include <vectra/math/approximate.hpp>
+
+
+namespace vectra::accuracy
+{
+
+/*
+ * @brief Accuracy policies of the transcendental functions.
+ *
+ * A policy is a set of static kernels templated on <T, Backend>,
+ * selected at compile time per call site, e.g.
+ *
+ *     vct::exp<vectra::accuracy::fast>(x)
+ *
+ * Error bounds, for arguments where the full accuracy functions
+ * are documented (e.g. |x| <= 8192 for float sin):
+ *  - fast    : relative error below 2^-12 (about 4 decimal digits)
+ *              for float and double, 1.5 * 2^-12 for the rcp and
+ *              rsqrt hardware estimates. Shortest polynomials, up to
+ *              about 40% cheaper than the precise kernels (log),
+ *              less for sin and exp whose cost is mostly in the
+ *              argument reduction.
+ *  - balanced: <= 4 ULP in float. Polynomials a few terms shorter
+ *              than the precise ones. Double uses the precise
+ *              kernels, already within the bound. rcp and rsqrt are
+ *              the estimates refined by Newton steps, for float and
+ *              double, over the whole range: arguments the hardware
+ *              estimates cannot take (subnormal ones, or beyond the
+ *              float range for double on SSE and AVX) are divided.
+ *  - precise : the backend functions, i.e. the default ones, within
+ *              1 to 2.5 ULP as documented for each of them. rcp and
+ *              rsqrt are correctly rounded divisions and square roots.
+ *
+ * Special values (infinities, NaN, zeros, subnormals, overflow and
+ * underflow) are handled by every policy, the sign of zero excepted.
+ */
+struct fast
+{
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type sin (typename Backend::type x) noexcept { return math::sin_approx <T, Backend, math::detail::fast_polynomials>(x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type cos (typename Backend::type x) noexcept { return math::cos_approx <T, Backend, math::detail::fast_polynomials>(x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type exp (typename Backend::type x) noexcept { return math::exp_approx <T, Backend, math::detail::fast_polynomials>(x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type exp2(typename Backend::type x) noexcept { return math::exp2_approx<T, Backend, math::detail::fast_polynomials>(x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type log (typename Backend::type x) noexcept { return math::log_approx <T, Backend, math::detail::fast_polynomials>(x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type log2(typename Backend::type x) noexcept { return math::log2_approx<T, Backend, math::detail::fast_polynomials>(x); }
+
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type rcp  (typename Backend::type x) noexcept { return Backend::rcp  (x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type rsqrt(typename Backend::type x) noexcept { return Backend::rsqrt(x); }
+};
+
+struct balanced
+{
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type sin(typename Backend::type x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) return math::sin_approx<T, Backend, math::detail::balanced_polynomials>(x);
+		else                                    return Backend::sin(x);
+	}
+
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type cos(typename Backend::type x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) return math::cos_approx<T, Backend, math::detail::balanced_polynomials>(x);
+		else                                    return Backend::cos(x);
+	}
+
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type exp(typename Backend::type x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) return math::exp_approx<T, Backend, math::detail::balanced_polynomials>(x);
+		else                                    return Backend::exp(x);
+	}
+
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type exp2(typename Backend::type x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) return math::exp2_approx<T, Backend, math::detail::balanced_polynomials>(x);
+		else                                    return Backend::exp2(x);
+	}
+
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type log(typename Backend::type x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) return math::log_approx<T, Backend, math::detail::balanced_polynomials>(x);
+		else                                    return Backend::log(x);
+	}
+
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type log2(typename Backend::type x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) return math::log2_approx<T, Backend, math::detail::balanced_polynomials>(x);
+		else                                    return Backend::log2(x);
+	}
+
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type rcp  (typename Backend::type x) noexcept { return Backend::rcp_refined  (x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type rsqrt(typename Backend::type x) noexcept { return Backend::rsqrt_refined(x); }
+};
+
+struct precise
+{
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type sin (typename Backend::type x) noexcept { return Backend::sin (x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type cos (typename Backend::type x) noexcept { return Backend::cos (x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type exp (typename Backend::type x) noexcept { return Backend::exp (x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type exp2(typename Backend::type x) noexcept { return Backend::exp2(x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type log (typename Backend::type x) noexcept { return Backend::log (x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type log2(typename Backend::type x) noexcept { return Backend::log2(x); }
+
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type rcp  (typename Backend::type x) noexcept { return Backend::div(Backend::one(), x); }
+	template <typename T, typename Backend> FORCE_INLINE static typename Backend::type rsqrt(typename Backend::type x) noexcept { return Backend::div(Backend::one(), Backend::sqrt(x)); }
+};
+
+}
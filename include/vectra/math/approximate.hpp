@@ -0,0 +1,217 @@
+#pragma once
+
+
+#include <vectra/core/attributes.hpp>
+#include <vectra/math/exponential.hpp>
+#include <vectra/math/logarithmic.hpp>
+#include <vectra/math/polynomial.hpp>
+#include <vectra/math/trigonometric.hpp>
+
+
+namespace vectra::math
+{
+
+namespace detail
+{
+
+/*
+ * @brief Reduced-degree polynomials of the approximate kernels.
+ *
+ * Same reductions as the full accuracy kernels, with polynomials
+ * fitted (weighted least squares, relative error) for a target
+ * accuracy rather than for the last bit:
+ *  - sin(r) = r + r * z * S(z) and cos(r) = 1 + z * C(z), z = r^2,
+ *    on [-pi/4 ; pi/4]
+ *  - exp(r) = 1 + r + r^2 * E(r) on [-ln2/2 ; ln2/2]
+ *  - log(1 + f) = f - f^2 / 2 + f^3 * L(f) on [sqrt(1/2) - 1 ; sqrt(2) - 1]
+ *
+ * Relative errors of the polynomials alone are given below, the
+ * rounding errors of the evaluation add about 1 ULP on top.
+ */
+
+// About 13 correct bits: 2^-19 (sin), 2^-16 (cos), 2^-17 (exp) and
+// 2^-13 (log). Coefficients are exact in float, and used as is in
+// double, where the error is the same.
+struct fast_polynomials
+{
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type sin(typename Backend::type z) noexcept
+	{
+		return horner<Backend>(z, T(-1.6663337524e-1), T(8.1623033148e-3));
+	}
+
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type cos(typename Backend::type z) noexcept
+	{
+		return horner<Backend>(z, T(-4.9975680267e-1), T(4.0451580968e-2));
+	}
+
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type exp(typename Backend::type r) noexcept
+	{
+		return horner<Backend>(r, T(5.0008930975e-1), T(1.6753975960e-1), T(4.0917402900e-2));
+	}
+
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type log(typename Backend::type f) noexcept
+	{
+		return horner<Backend>(f, T(3.3676182496e-1), T(-2.6349273401e-1), T(1.6297576053e-1));
+	}
+};
+
+// Float results within a few ULP: 2^-28 (sin), 2^-24.6 (cos), 2^-23
+// (exp) and 2^-24.8 (log). Two to three terms shorter than the
+// Cephes polynomials of the full accuracy kernels.
+struct balanced_polynomials
+{
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type sin(typename Backend::type z) noexcept
+	{
+		return horner<Backend>(z, T(-1.6666654339e-1), T(8.3321482567e-3), T(-1.9513932606e-4));
+	}
+
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type cos(typename Backend::type z) noexcept
+	{
+		return horner<Backend>(z, T(-4.9999882201e-1), T(4.1655661585e-2), T(-1.3590623180e-3));
+	}
+
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type exp(typename Backend::type r) noexcept
+	{
+		return horner<Backend>(r, T(4.9999142573e-1), T(1.6666886383e-1), T(4.1898577938e-2), T(8.3338379503e-3));
+	}
+
+	template <typename T, typename Backend>
+	FORCE_INLINE static typename Backend::type log(typename Backend::type f) noexcept
+	{
+		return horner<Backend>(f,
+			T( 3.3333972565e-1),
+			T(-2.5000969372e-1),
+			T( 1.9960596538e-1),
+			T(-1.6587949049e-1),
+			T( 1.4950979439e-1),
+			T(-1.4197471902e-1),
+			T( 8.5069536748e-2));
+	}
+};
+
+// Sine of x = j * pi/2 + r, the cosine being the sine in quadrant j + 1
+template <typename T, typename Backend, typename P>
+FORCE_INLINE typename Backend::type sincos_approx(typename Backend::type r, typename Backend::type j) noexcept
+{
+	using type = typename Backend::type;
+
+	type z = Backend::mul(r, r);
+	type s = Backend::fma(Backend::mul(r, z), P::template sin<T, Backend>(z), r);
+	type c = Backend::fma(z, P::template cos<T, Backend>(z), Backend::one());
+
+	type h = Backend::floor(Backend::mul(j, Backend::set(T(0.5))));
+	type y = Backend::select(Backend::cmpeq(j, Backend::add(h, h)), s, c);
+	return Backend::mul(y, parity_sign<T, Backend>(h));
+}
+
+// 2^n * exp(r), with n integral and r in [-ln2/2 ; ln2/2]
+template <typename T, typename Backend, typename P>
+FORCE_INLINE typename Backend::type exp_reduced_approx(typename Backend::type r, typename Backend::type n) noexcept
+{
+	typename Backend::type y = Backend::fma(Backend::mul(r, r), P::template exp<T, Backend>(r), r);
+	return scale<T, Backend>(Backend::add(Backend::one(), y), n);
+}
+
+// log(1 + f), the decomposition being the one of the full kernels
+template <typename T, typename Backend, typename P>
+FORCE_INLINE typename Backend::type log_reduced_approx(typename Backend::type f) noexcept
+{
+	typename Backend::type f2 = Backend::mul(f, f);
+	typename Backend::type t  = Backend::mul(Backend::mul(f2, f), P::template log<T, Backend>(f));
+	return Backend::add(Backend::fnma(Backend::set(T(0.5)), f2, t), f);
+}
+
+}
+
+/*
+ * @brief Approximate sin, cos, exp, exp2, log and log2.
+ *
+ * These kernels share the argument reductions and special value
+ * handling of the full accuracy ones, but evaluate the shorter
+ * polynomials P (fast_polynomials or balanced_polynomials). The
+ * sign of zero is not restored by sin_approx. Arguments beyond the
+ * range of the reduction go through the standard library, like the
+ * full accuracy sin and cos. They are meant to be
+ * used through the accuracy policies rather than directly.
+ */
+template <typename T, typename Backend, typename P>
+FORCE_INLINE typename Backend::type sin_approx(typename Backend::type x) noexcept
+{
+	typename Backend::type j;
+	typename Backend::type r = detail::reduce_pio2<T, Backend>(x, j);
+	return detail::large_arguments<T, Backend>(x, detail::sincos_approx<T, Backend, P>(r, j), [](T v) { return std::sin(v); });
+}
+
+template <typename T, typename Backend, typename P>
+FORCE_INLINE typename Backend::type cos_approx(typename Backend::type x) noexcept
+{
+	typename Backend::type j;
+	typename Backend::type r = detail::reduce_pio2<T, Backend>(x, j);
+	return detail::large_arguments<T, Backend>(x, detail::sincos_approx<T, Backend, P>(r, Backend::add(j, Backend::one())), [](T v) { return std::cos(v); });
+}
+
+template <typename T, typename Backend, typename P>
+FORCE_INLINE typename Backend::type exp_approx(typename Backend::type x) noexcept
+{
+	using C = detail::exp_constants<T>;
+	using type = typename Backend::type;
+
+	x = detail::clamp<Backend>(x, Backend::set(C::lo), Backend::set(C::hi));
+
+	type n = Backend::round(Backend::mul(x, Backend::set(C::log2e)));
+	type r = Backend::fnma(n, Backend::set(C::ln2_hi), x);
+	r = Backend::fnma(n, Backend::set(C::ln2_lo), r);
+
+	return detail::exp_reduced_approx<T, Backend, P>(r, n);
+}
+
+template <typename T, typename Backend, typename P>
+FORCE_INLINE typename Backend::type exp2_approx(typename Backend::type x) noexcept
+{
+	using C = detail::exp_constants<T>;
+	using type = typename Backend::type;
+
+	x = detail::clamp<Backend>(x,
+		Backend::set(C::lo * C::log2e),
+		Backend::set(C::hi * C::log2e));
+
+	type n = Backend::round(x);
+	type r = Backend::mul(Backend::sub(x, n), Backend::set(C::ln2));
+
+	return detail::exp_reduced_approx<T, Backend, P>(r, n);
+}
+
+template <typename T, typename Backend, typename P>
+FORCE_INLINE typename Backend::type log_approx(typename Backend::type x) noexcept
+{
+	using C = detail::log_constants<T>;
+
+	typename Backend::type e;
+	typename Backend::type f = detail::decompose<T, Backend>(x, e);
+	typename Backend::type t = detail::log_reduced_approx<T, Backend, P>(f);
+
+	typename Backend::type y = Backend::fma(e, Backend::set(C::ln2_hi), Backend::fma(e, Backend::set(C::ln2_lo), t));
+	return detail::log_special<T, Backend>(x, y);
+}
+
+template <typename T, typename Backend, typename P>
+FORCE_INLINE typename Backend::type log2_approx(typename Backend::type x) noexcept
+{
+	using C = detail::log_constants<T>;
+
+	typename Backend::type e;
+	typename Backend::type f = detail::decompose<T, Backend>(x, e);
+	typename Backend::type t = detail::log_reduced_approx<T, Backend, P>(f);
+
+	typename Backend::type y = Backend::add(e, Backend::mul(t, Backend::set(C::log2e_hi)));
+	return detail::log_special<T, Backend>(x, y);
+}
+
+}
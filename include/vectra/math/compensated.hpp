@@ -0,0 +1,93 @@
+#pragma once
+
+
+#include <cstdint>
+
+#include <vectra/core/attributes.hpp>
+#include <vectra/detail/bit_cast.hpp>
+
+
+namespace vectra::math
+{
+
+namespace detail
+{
+
+// Mask keeping the upper half of the significand, such that the
+// product of two halves is exact in the working precision.
+template <typename T>
+struct split_mask;
+
+template <>
+struct split_mask<float>
+{
+	FORCE_INLINE static float value() noexcept { return vectra::detail::bit_cast<float>(std::uint32_t(0xFFFFF000u)); }
+};
+
+template <>
+struct split_mask<double>
+{
+	FORCE_INLINE static double value() noexcept { return vectra::detail::bit_cast<double>(std::uint64_t(0xFFFFFFFFF8000000ull)); }
+};
+
+}
+
+/*
+ * @brief Error-free transformations of sums and products.
+ *
+ * Each function returns the rounded result, and writes the exact
+ * rounding error in err, so that a + b (or a * b) == result + err.
+ * They are the building blocks of double-word arithmetic, used by
+ * kernels needing more precision than the working one (e.g. pow).
+ */
+
+// Requires |a| >= |b| (or a == 0). Dekker, 1971.
+template <typename Backend>
+FORCE_INLINE typename Backend::type fast_two_sum(typename Backend::type a, typename Backend::type b, typename Backend::type& err) noexcept
+{
+	typename Backend::type s = Backend::add(a, b);
+	err = Backend::sub(b, Backend::sub(s, a));
+	return s;
+}
+
+// No requirement on the magnitudes. Knuth, 1969.
+template <typename Backend>
+FORCE_INLINE typename Backend::type two_sum(typename Backend::type a, typename Backend::type b, typename Backend::type& err) noexcept
+{
+	typename Backend::type s  = Backend::add(a, b);
+	typename Backend::type bv = Backend::sub(s, a);
+	typename Backend::type av = Backend::sub(s, bv);
+	err = Backend::add(Backend::sub(a, av), Backend::sub(b, bv));
+	return s;
+}
+
+// Dekker's product. Operands are split by masking the significand
+// rather than with Veltkamp's multiplication, so that the split is
+// not broken by floating point contraction of the compiler. With a
+// fused multiply-add, the error is simply a * b - p, rounded once.
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type two_prod(typename Backend::type a, typename Backend::type b, typename Backend::type& err) noexcept
+{
+	typename Backend::type p = Backend::mul(a, b);
+
+	if constexpr (Backend::has_fma())
+	{
+		err = Backend::fms(a, b, p);
+		return p;
+	}
+
+	typename Backend::type mask = Backend::set(detail::split_mask<T>::value());
+
+	typename Backend::type ah = Backend::bit_and(a, mask);
+	typename Backend::type bh = Backend::bit_and(b, mask);
+	typename Backend::type al = Backend::sub(a, ah);
+	typename Backend::type bl = Backend::sub(b, bh);
+
+	err = Backend::sub(Backend::mul(ah, bh), p);
+	err = Backend::add(err, Backend::mul(ah, bl));
+	err = Backend::add(err, Backend::mul(al, bh));
+	err = Backend::add(err, Backend::mul(al, bl));
+	return p;
+}
+
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+
+#include <limits>
+
+#include <vectra/core/attributes.hpp>
+#include <vectra/math/polynomial.hpp>
+
+
+namespace vectra::math
+{
+
+namespace detail
+{
+
+/*
+ * @brief Precision-specific constants of the exponential kernels.
+ *
+ * exp(x) is computed as 2^n * exp(r), with n = round(x / ln2) and
+ * r = x - n * ln2 in [-ln2/2 ; ln2/2]. ln2 is split in two parts
+ * (Cody-Waite) so that n * ln2_hi is exact. The polynomial gives
+ * exp(r) - 1 - r = r^2 * P(r).
+ *
+ * Arguments are clamped to [lo ; hi], bounds for which the result
+ * has already underflowed to zero, or overflowed to infinity.
+ */
+template <typename T>
+struct exp_constants;
+
+template <>
+struct exp_constants<float>
+{
+	static constexpr float log2e  =  1.44269504088896341f;
+	static constexpr float ln2    =  0.693147180559945309f;
+	static constexpr float ln2_hi =  0.693359375f;
+	static constexpr float ln2_lo = -2.12194440e-4f;
+	static constexpr float lo     = -104.f;
+	static constexpr float hi     =  89.f;
+
+	// Cephes expf polynomial, minimax on [-ln2/2 ; ln2/2]
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type poly(typename Backend::type r) noexcept
+	{
+		return horner<Backend>(r,
+			5.0000001201e-1f,
+			1.6666665459e-1f,
+			4.1665795894e-2f,
+			8.3334519073e-3f,
+			1.3981999507e-3f,
+			1.9875691500e-4f);
+	}
+};
+
+template <>
+struct exp_constants<double>
+{
+	static constexpr double log2e  =  1.4426950408889634074;
+	static constexpr double ln2    =  0.69314718055994530942;
+	static constexpr double ln2_hi =  6.93145751953125e-1;
+	static constexpr double ln2_lo =  1.42860682030941723212e-6;
+	static constexpr double lo     = -746.;
+	static constexpr double hi     =  710.;
+
+	// Taylor expansion up to r^13, its truncation error is smaller
+	// than 2^-60 on [-ln2/2 ; ln2/2], and it avoids Cephes' division
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type poly(typename Backend::type r) noexcept
+	{
+		return horner<Backend>(r,
+			1. / 2.,
+			1. / 6.,
+			1. / 24.,
+			1. / 120.,
+			1. / 720.,
+			1. / 5040.,
+			1. / 40320.,
+			1. / 362880.,
+			1. / 3628800.,
+			1. / 39916800.,
+			1. / 479001600.,
+			1. / 6227020800.);
+	}
+};
+
+// Returns exp(r) - 1 for r in [-ln2/2 ; ln2/2]
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type expm1_reduced(typename Backend::type r) noexcept
+{
+	typename Backend::type p = exp_constants<T>::template poly<Backend>(r);
+	return Backend::fma(Backend::mul(r, r), p, r);
+}
+
+/*
+ * @brief Computes y * 2^n, with n holding integral values.
+ *
+ * The power of two is applied in two steps, so that intermediate
+ * factors stay normal when y * 2^n overflows, or is subnormal.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type scale(typename Backend::type y, typename Backend::type n) noexcept
+{
+	typename Backend::type a = Backend::floor(Backend::mul(n, Backend::set(T(0.5))));
+	typename Backend::type b = Backend::sub(n, a);
+	return Backend::mul(Backend::mul(y, Backend::exp2i(a)), Backend::exp2i(b));
+}
+
+// Clamps x to [lo ; hi]. x is passed as second operand of min and
+// max, since these return their second operand when one is a NaN.
+template <typename Backend>
+FORCE_INLINE typename Backend::type clamp(typename Backend::type x, typename Backend::type lo, typename Backend::type hi) noexcept
+{
+	return Backend::min(hi, Backend::max(lo, x));
+}
+
+}
+
+/*
+ * @brief Vectorized natural exponential.
+ *
+ * Accuracy: <= 1.1 ULP for float and double on the whole range,
+ * including subnormal results. Overflows to +inf, underflows to +0
+ * as expected, and exp(-inf) = 0, exp(+inf) = +inf, exp(NaN) = NaN.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type exp(typename Backend::type x) noexcept
+{
+	using C = detail::exp_constants<T>;
+	using type = typename Backend::type;
+
+	x = detail::clamp<Backend>(x, Backend::set(C::lo), Backend::set(C::hi));
+
+	type n = Backend::round(Backend::mul(x, Backend::set(C::log2e)));
+	type r = Backend::fnma(n, Backend::set(C::ln2_hi), x);
+	r = Backend::fnma(n, Backend::set(C::ln2_lo), r);
+
+	type y = Backend::add(Backend::one(), detail::expm1_reduced<T, Backend>(r));
+	return detail::scale<T, Backend>(y, n);
+}
+
+/*
+ * @brief Vectorized base-2 exponential.
+ *
+ * The fractional part is exact, then only scaled by ln2 to reuse
+ * the exp polynomial. Accuracy: <= 1.1 ULP for float and double.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type exp2(typename Backend::type x) noexcept
+{
+	using C = detail::exp_constants<T>;
+	using type = typename Backend::type;
+
+	x = detail::clamp<Backend>(x,
+		Backend::set(C::lo * C::log2e),
+		Backend::set(C::hi * C::log2e));
+
+	type n = Backend::round(x);
+	type r = Backend::mul(Backend::sub(x, n), Backend::set(C::ln2));
+
+	type y = Backend::add(Backend::one(), detail::expm1_reduced<T, Backend>(r));
+	return detail::scale<T, Backend>(y, n);
+}
+
+/*
+ * @brief Vectorized exp(x) - 1, accurate for x close to zero.
+ *
+ * With x = n * ln2 + r, we have expm1(x) = 2^n * expm1(r) + 2^n - 1
+ * where expm1(r) is given by the polynomial without cancellation.
+ * Everything is computed with 2^(n - 1) and doubled at the end, so
+ * that the largest finite results do not overflow too early.
+ *
+ * Accuracy: <= 2 ULP for float and double. Results saturate to -1
+ * for large negative x, and tiny x (including signed zeros) give x.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type expm1(typename Backend::type x) noexcept
+{
+	using C = detail::exp_constants<T>;
+	using type = typename Backend::type;
+
+	// Below lo, exp(x) is negligible in front of 1 and 2^n is normal
+	constexpr T lo = sizeof(T) == 4 ? T(-18) : T(-40);
+	type z = detail::clamp<Backend>(x, Backend::set(lo), Backend::set(C::hi));
+
+	type n = Backend::round(Backend::mul(z, Backend::set(C::log2e)));
+	type r = Backend::fnma(n, Backend::set(C::ln2_hi), z);
+	r = Backend::fnma(n, Backend::set(C::ln2_lo), r);
+
+	type q = detail::expm1_reduced<T, Backend>(r);
+	type t = Backend::exp2i(Backend::sub(n, Backend::one()));
+	type y = Backend::fma(t, q, Backend::sub(t, Backend::set(T(0.5))));
+	y = Backend::add(y, y);
+
+	// expm1(x) rounds to x for tiny x, this also keeps the sign of
+	// zero and subnormal values that would be flushed by 2^(n - 1)
+	typename Backend::mask tiny = Backend::cmplt(Backend::abs(x), Backend::set(std::numeric_limits<T>::epsilon() * T(0.125)));
+	return Backend::select(tiny, x, y);
+}
+
+}
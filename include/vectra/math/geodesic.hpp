@@ -0,0 +1,85 @@
+#pragma once
+
+
+#include <vectra/core/attributes.hpp>
+
+
+namespace vectra::math
+{
+
+/*
+ * @brief Great-circle kernels on a sphere, for registers of points.
+ *
+ * Angles are in radians, and distances are central angles, to be
+ * multiplied by the radius of the sphere. The first point is given
+ * by its latitude, with its sine and cosine, so that one-to-many
+ * batches compute them only once. dlat and dlon are lat2 - lat1 and
+ * lon2 - lon1, in [-pi ; pi] for dlon: callers with coordinates in
+ * degrees should subtract them first, which is exact for nearby
+ * points, rather than subtract rounded radians.
+ */
+
+// Haversine formula, well conditioned for every distance but the
+// nearly antipodal ones. a is clamped to 1 against rounding.
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type haversine(typename Backend::type cos1, typename Backend::type lat2,
+                                              typename Backend::type dlat, typename Backend::type dlon) noexcept
+{
+	using type = typename Backend::type;
+
+	const type half = Backend::set(T(0.5));
+
+	type s = Backend::sin(Backend::mul(dlat, half));
+	type t = Backend::sin(Backend::mul(dlon, half));
+	type a = Backend::fma(Backend::mul(cos1, Backend::cos(lat2)), Backend::mul(t, t), Backend::mul(s, s));
+
+	a = Backend::min(a, Backend::one());
+	return Backend::mul(Backend::set(T(2)), Backend::asin(Backend::sqrt(a)));
+}
+
+// Spherical law of cosines. Cheaper, but cos(d) is rounded close to
+// 1 for short distances: in float, it is only accurate above a few
+// kilometers on Earth (a few meters in double).
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type spherical_cosines(typename Backend::type sin1, typename Backend::type cos1,
+                                                      typename Backend::type lat2, typename Backend::type dlon) noexcept
+{
+	using type = typename Backend::type;
+
+	type c = Backend::mul(Backend::mul(cos1, Backend::cos(lat2)), Backend::cos(dlon));
+	c = Backend::fma(sin1, Backend::sin(lat2), c);
+
+	c = Backend::max(Backend::min(c, Backend::one()), Backend::sub(Backend::zero(), Backend::one()));
+	return Backend::acos(c);
+}
+
+// Initial bearing (forward azimuth) from the first point towards the
+// second one, clockwise from north, in ]-pi ; pi].
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type initial_bearing(typename Backend::type sin1, typename Backend::type cos1,
+                                                    typename Backend::type lat2, typename Backend::type dlon) noexcept
+{
+	using type = typename Backend::type;
+
+	type sin2 = Backend::sin(lat2);
+	type cos2 = Backend::cos(lat2);
+
+	type y = Backend::mul(Backend::sin(dlon), cos2);
+	type x = Backend::fnma(Backend::mul(sin1, cos2), Backend::cos(dlon), Backend::mul(cos1, sin2));
+	return Backend::atan2(y, x);
+}
+
+// Equirectangular projection around the mean latitude, then planar
+// distance. The error stays below 0.1% up to about 100 km at mid
+// latitudes, and grows with the distance.
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type equirectangular(typename Backend::type lat1, typename Backend::type lat2,
+                                                    typename Backend::type dlat, typename Backend::type dlon) noexcept
+{
+	using type = typename Backend::type;
+
+	type x = Backend::mul(dlon, Backend::cos(Backend::mul(Backend::add(lat1, lat2), Backend::set(T(0.5)))));
+	return Backend::sqrt(Backend::fma(x, x, Backend::mul(dlat, dlat)));
+}
+
+}
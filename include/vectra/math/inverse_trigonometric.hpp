@@ -0,0 +1,319 @@
+#pragma once
+
+
+#include <limits>
+
+#include <vectra/core/attributes.hpp>
+#include <vectra/math/compensated.hpp>
+#include <vectra/math/polynomial.hpp>
+
+
+namespace vectra::math
+{
+
+namespace detail
+{
+
+/*
+ * @brief Precision-specific constants of the inverse trigonometric
+ * kernels.
+ *
+ * asin(x) = x + x * R(x^2) on [0 ; 1/2], the other half of [0 ; 1]
+ * being brought back with asin(x) = pi/2 - 2 * asin(sqrt((1 - x) / 2)).
+ * atan is reduced to [-tan(pi/8) ; tan(pi/8)] (or a slightly wider
+ * interval in double) with the identities on pi/4 and pi/2, and the
+ * approximation is atan(x) = x + x * S(x^2).
+ *
+ * pi/2 is split as pio2_hi + pio2_lo, so that results close to pi/2
+ * or pi do not lose the bits of the constant.
+ */
+template <typename T>
+struct atrig_constants;
+
+template <>
+struct atrig_constants<float>
+{
+	static constexpr float pio2_hi  =  1.57079637050628662109375f;
+	static constexpr float pio2_lo  = -4.37113900018624283e-8f;
+	static constexpr float pio4_hi  =  0.785398185253143310546875f;
+	static constexpr float t3p8     =  2.414213562373095f;    // tan(3pi/8)
+	static constexpr float atan_mid =  0.4142135623730950f;   // tan(pi/8)
+
+	// Cephes asinf polynomial: R(z) = z * P(z)
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type asin_tail(typename Backend::type z) noexcept
+	{
+		return Backend::mul(z, horner<Backend>(z,
+			1.6666752422e-1f,
+			7.4953002686e-2f,
+			4.5470025998e-2f,
+			2.4181311049e-2f,
+			4.2163199048e-2f));
+	}
+
+	// Cephes atanf polynomial: S(z) = z * P(z)
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type atan_tail(typename Backend::type z) noexcept
+	{
+		return Backend::mul(z, horner<Backend>(z,
+			-3.33329491539e-1f,
+			 1.99777106478e-1f,
+			-1.38776856032e-1f,
+			 8.05374449538e-2f));
+	}
+};
+
+template <>
+struct atrig_constants<double>
+{
+	static constexpr double pio2_hi  = 1.57079632679489655800e+00;
+	static constexpr double pio2_lo  = 6.12323399573676603587e-17;
+	static constexpr double pio4_hi  = 7.85398163397448278999e-01;
+	static constexpr double t3p8     = 2.41421356237309504880;    // tan(3pi/8)
+	static constexpr double atan_mid = 0.66;
+
+	// fdlibm asin rational approximation: R(z) = z * P(z) / Q(z)
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type asin_tail(typename Backend::type z) noexcept
+	{
+		typename Backend::type p = horner<Backend>(z,
+			 1.66666666666666657415e-01,
+			-3.25565818622400915405e-01,
+			 2.01212532134862925881e-01,
+			-4.00555345006794114027e-02,
+			 7.91534994289814532176e-04,
+			 3.47933107596021167570e-05);
+		typename Backend::type q = horner<Backend>(z,
+			 1.0,
+			-2.40339491173441421878e+00,
+			 2.02094576023350569471e+00,
+			-6.88283971605453293030e-01,
+			 7.70381505559019352791e-02);
+		return Backend::div(Backend::mul(z, p), q);
+	}
+
+	// Cephes atan rational approximation: S(z) = z * P(z) / Q(z)
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type atan_tail(typename Backend::type z) noexcept
+	{
+		typename Backend::type p = horner<Backend>(z,
+			-6.485021904942025371773e1,
+			-1.228866684490136173410e2,
+			-7.500855792314704667340e1,
+			-1.615753718733365076637e1,
+			-8.750608600031904122785e-1);
+		typename Backend::type q = horner<Backend>(z,
+			1.945506571482613964425e2,
+			4.853903996359136964868e2,
+			4.328810604912902668951e2,
+			1.650270098316988542046e2,
+			2.485846490142306297962e1,
+			1.0);
+		return Backend::div(Backend::mul(z, p), q);
+	}
+};
+
+// Returns the sign bit of x, all other bits cleared
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type sign_bit(typename Backend::type x) noexcept
+{
+	return Backend::bit_and(x, Backend::set(T(-0.)));
+}
+
+/*
+ * @brief Shared reduction of asin and acos on |x| in [1/2 ; 1].
+ *
+ * With z = (1 - |x|) / 2 and s = sqrt(z), writes s as df + c where
+ * df keeps the upper half of the significand of s, so that df^2 is
+ * exact and z - df^2 is computed without cancellation error (fdlibm).
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type asin_split(typename Backend::type z, typename Backend::type s, typename Backend::type& c) noexcept
+{
+	typename Backend::type df = Backend::bit_and(s, Backend::set(split_mask<T>::value()));
+	c = Backend::div(Backend::fnma(df, df, z), Backend::add(s, df));
+	c = Backend::select(Backend::cmpeq(z, Backend::zero()), Backend::zero(), c); // |x| = 1
+	return df;
+}
+
+/*
+ * @brief Arctangent of a non-negative argument a, including +inf.
+ *
+ * a is reduced to t = -1/a above tan(3pi/8) (offset pi/2) and to
+ * t = (a - 1) / (a + 1) above atan_mid (offset pi/4). The quotient
+ * n / d is corrected with its exact residual, since the offset
+ * cancels out with atan(t) near atan_mid, and the low part of the
+ * offset is added to the tail before the final rounding.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type atan_positive(typename Backend::type a) noexcept
+{
+	using C = atrig_constants<T>;
+	using type = typename Backend::type;
+	using mask = typename Backend::mask;
+
+	mask big = Backend::cmplt(Backend::set(C::t3p8), a);
+	mask mid = Backend::cmplt(Backend::set(C::atan_mid), a);
+
+	// t = n / d, with n and d given as exact double-words
+	type nl, dl;
+	type nh = two_sum<Backend>(a, Backend::set(T(-1)), nl);
+	type dh = two_sum<Backend>(a, Backend::one(), dl);
+	nh = Backend::select(mid, nh, a);
+	nl = Backend::select(mid, nl, Backend::zero());
+	dh = Backend::select(mid, dh, Backend::one());
+	dl = Backend::select(mid, dl, Backend::zero());
+	nh = Backend::select(big, Backend::set(T(-1)), nh);
+	nl = Backend::select(big, Backend::zero(), nl);
+	dh = Backend::select(big, a, dh);
+	dl = Backend::select(big, Backend::zero(), dl);
+
+	type t = Backend::div(nh, dh);
+	type pl;
+	type ph = two_prod<T, Backend>(t, dh, pl);
+	type r  = Backend::sub(Backend::sub(Backend::sub(nh, ph), pl), Backend::sub(Backend::mul(t, dl), nl));
+	type tl = Backend::div(r, dh);
+
+	// +inf gives t = -0 and a NaN residual, which is not needed
+	tl = Backend::select(Backend::cmpeq(t, Backend::zero()), Backend::zero(), tl);
+
+	type hi = Backend::select(mid, Backend::set(C::pio4_hi), Backend::zero());
+	type lo = Backend::select(mid, Backend::set(C::pio2_lo * T(0.5)), Backend::zero());
+	hi = Backend::select(big, Backend::set(C::pio2_hi), hi);
+	lo = Backend::select(big, Backend::set(C::pio2_lo), lo);
+
+	type y = Backend::fma(t, C::template atan_tail<Backend>(Backend::mul(t, t)), Backend::add(tl, lo));
+	return Backend::add(hi, Backend::add(t, y));
+}
+
+}
+
+/*
+ * @brief Vectorized arcsine.
+ *
+ * Accuracy: <= 1 ULP for float and double. asin(+-0) = +-0, and
+ * arguments outside of [-1 ; 1], as well as NaN, give NaN.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type asin(typename Backend::type x) noexcept
+{
+	using C = detail::atrig_constants<T>;
+	using type = typename Backend::type;
+
+	type a = Backend::abs(x);
+
+	// |x| < 1/2: asin(a) = a + a * R(a^2)
+	type small = Backend::fma(a, C::template asin_tail<Backend>(Backend::mul(a, a)), a);
+
+	// 1/2 <= |x| <= 0.975: asin(a) = pi/2 - 2 * (s + s * R(z)),
+	// where pi/4 - 2 * df is exact and absorbs the cancellation
+	type z = Backend::mul(Backend::sub(Backend::one(), a), Backend::set(T(0.5)));
+	type s = Backend::sqrt(z);
+	type c;
+	type df = detail::asin_split<T, Backend>(z, s, c);
+
+	type p = Backend::mul(Backend::add(s, s), C::template asin_tail<Backend>(z));
+	p = Backend::sub(p, Backend::sub(Backend::set(C::pio2_lo), Backend::add(c, c)));
+	type q = Backend::sub(Backend::set(C::pio4_hi), Backend::add(df, df));
+	type large = Backend::sub(Backend::set(C::pio4_hi), Backend::sub(p, q));
+
+	// Close to 1 there is no cancellation, and pi/2 - 2 * s is
+	// rounded once, which keeps asin(+-1) = +-pi/2 exact
+	type w   = Backend::fma(s, C::template asin_tail<Backend>(z), s);
+	type top = Backend::sub(Backend::set(C::pio2_hi), Backend::sub(Backend::add(w, w), Backend::set(C::pio2_lo)));
+	large = Backend::select(Backend::cmplt(Backend::set(T(0.975)), a), top, large);
+
+	type y = Backend::select(Backend::cmplt(a, Backend::set(T(0.5))), small, large);
+	return Backend::bit_or(y, detail::sign_bit<T, Backend>(x));
+}
+
+/*
+ * @brief Vectorized arccosine.
+ *
+ * Accuracy: <= 1.1 ULP for float and double. Arguments outside
+ * of [-1 ; 1], as well as NaN, give NaN.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type acos(typename Backend::type x) noexcept
+{
+	using C = detail::atrig_constants<T>;
+	using type = typename Backend::type;
+
+	type a = Backend::abs(x);
+
+	// |x| < 1/2: acos(x) = pi/2 - (x + x * R(x^2))
+	type small = Backend::mul(x, C::template asin_tail<Backend>(Backend::mul(x, x)));
+	small = Backend::sub(Backend::set(C::pio2_hi), Backend::sub(x, Backend::sub(Backend::set(C::pio2_lo), small)));
+
+	// |x| >= 1/2: acos(|x|) = 2 * asin(s) = 2 * (df + c + s * R(z)),
+	// and acos(-|x|) = pi - acos(|x|)
+	type z = Backend::mul(Backend::sub(Backend::one(), a), Backend::set(T(0.5)));
+	type s = Backend::sqrt(z);
+	type c;
+	type df = detail::asin_split<T, Backend>(z, s, c);
+
+	type w = Backend::fma(s, C::template asin_tail<Backend>(z), c);
+	type large = Backend::mul(Backend::set(T(2)), Backend::add(df, w));
+	type negative = Backend::sub(Backend::set(C::pio2_hi * T(2)), Backend::sub(large, Backend::set(C::pio2_lo * T(2))));
+	large = Backend::select(Backend::cmplt(x, Backend::zero()), negative, large);
+
+	return Backend::select(Backend::cmplt(a, Backend::set(T(0.5))), small, large);
+}
+
+/*
+ * @brief Vectorized arctangent.
+ *
+ * Accuracy: <= 1.1 ULP for float and double. atan(+-0) = +-0 and
+ * atan(+-inf) = +-pi/2.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type atan(typename Backend::type x) noexcept
+{
+	typename Backend::type y = detail::atan_positive<T, Backend>(Backend::abs(x));
+	return Backend::bit_or(y, detail::sign_bit<T, Backend>(x));
+}
+
+/*
+ * @brief Vectorized two-argument arctangent, angle of the (x, y) point.
+ *
+ * The quotient min(|x|, |y|) / max(|x|, |y|) is always in [0 ; 1],
+ * and the octant is restored with pi/2 - a (when |y| > |x|), then
+ * pi - a (when x is negative, including -0). The sign is the one of
+ * y. Following the C standard, atan2(+-0, +0) = +-0, atan2(+-0, -0)
+ * = +-pi, infinite pairs give the odd multiples of pi/4, and a NaN
+ * operand gives NaN.
+ *
+ * Accuracy: <= 2 ULP for float and double.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type atan2(typename Backend::type y, typename Backend::type x) noexcept
+{
+	using C = detail::atrig_constants<T>;
+	using type = typename Backend::type;
+	using mask = typename Backend::mask;
+
+	const type inf = Backend::set(std::numeric_limits<T>::infinity());
+
+	type ax = Backend::abs(x);
+	type ay = Backend::abs(y);
+
+	// max and min return the other operand of a NaN, so the zero and
+	// infinite cases are restricted to ordered lanes, where the
+	// quotient stays NaN
+	mask ordered = Backend::mask_and(Backend::cmpeq(ax, ax), Backend::cmpeq(ay, ay));
+	mask swap = Backend::cmplt(ax, ay);
+	type t = Backend::div(Backend::select(swap, ax, ay), Backend::select(swap, ay, ax));
+	t = Backend::select(Backend::mask_and(ordered, Backend::cmpeq(Backend::max(ax, ay), Backend::zero())), Backend::zero(), t);
+	t = Backend::select(Backend::mask_and(ordered, Backend::cmpeq(Backend::min(ax, ay), inf)), Backend::one(), t);
+
+	type a = detail::atan_positive<T, Backend>(t);
+	a = Backend::select(swap, Backend::sub(Backend::set(C::pio2_hi), Backend::sub(a, Backend::set(C::pio2_lo))), a);
+
+	// -0 compares equal to +0, so the sign of x is read from +-1
+	mask negative = Backend::cmplt(Backend::bit_or(Backend::one(), detail::sign_bit<T, Backend>(x)), Backend::zero());
+	a = Backend::select(negative, Backend::sub(Backend::set(C::pio2_hi * T(2)), Backend::sub(a, Backend::set(C::pio2_lo * T(2)))), a);
+
+	return Backend::bit_or(a, detail::sign_bit<T, Backend>(y));
+}
+
+}
@@ -0,0 +1,240 @@
+#pragma once
+
+
+#include <limits>
+
+#include <vectra/core/attributes.hpp>
+#include <vectra/math/compensated.hpp>
+#include <vectra/math/polynomial.hpp>
+
+
+namespace vectra::math
+{
+
+namespace detail
+{
+
+/*
+ * @brief Precision-specific constants of the logarithm kernels.
+ *
+ * x is decomposed as 2^e * (1 + f), with 1 + f in [sqrt(1/2) ; sqrt(2)[
+ * and log(1 + f) = f - f^2 / 2 + tail(f), the tail being given by a
+ * minimax polynomial. ln2 is split in two parts (Cody-Waite), so that
+ * e * ln2_hi is exact.
+ */
+template <typename T>
+struct log_constants;
+
+template <>
+struct log_constants<float>
+{
+	static constexpr float ln2_hi   =  0.693359375f;
+	static constexpr float ln2_lo   = -2.12194440e-4f;
+	static constexpr float log2e_hi =  1.44269502162933349609375f;
+	static constexpr float log2e_lo =  1.925963033500011e-08f;
+
+	// Scaling applied to subnormal inputs before reading exponents
+	static constexpr float subnormal_scale    = 16777216.f; // 2^24
+	static constexpr float subnormal_exponent = 24.f;
+
+	// Cephes logf polynomial: tail(f) = f^3 * P(f)
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type tail(typename Backend::type f) noexcept
+	{
+		typename Backend::type p = horner<Backend>(f,
+			 3.3333331174e-1f,
+			-2.4999993993e-1f,
+			 2.0000714765e-1f,
+			-1.6668057665e-1f,
+			 1.4249322787e-1f,
+			-1.2420140846e-1f,
+			 1.1676998740e-1f,
+			-1.1514610310e-1f,
+			 7.0376836292e-2f);
+		return Backend::mul(Backend::mul(f, Backend::mul(f, f)), p);
+	}
+};
+
+template <>
+struct log_constants<double>
+{
+	static constexpr double ln2_hi   = 6.93147180369123816490e-01;
+	static constexpr double ln2_lo   = 1.90821492927058770002e-10;
+	static constexpr double log2e_hi = 1.4426950408889634;
+	static constexpr double log2e_lo = 2.0355273740931033e-17;
+
+	// Scaling applied to subnormal inputs before reading exponents
+	static constexpr double subnormal_scale    = 18014398509481984.; // 2^54
+	static constexpr double subnormal_exponent = 54.;
+
+	// fdlibm log polynomial: with s = f / (2 + f), z = s^2, we have
+	// tail(f) = s * (f^2 / 2 + R(z)) and R(z) = z * Lg(z)
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type tail(typename Backend::type f) noexcept
+	{
+		typename Backend::type s = Backend::div(f, Backend::add(Backend::set(2.), f));
+		typename Backend::type z = Backend::mul(s, s);
+		typename Backend::type r = Backend::mul(z, horner<Backend>(z,
+			6.666666666666735130e-01,
+			3.999999999940941908e-01,
+			2.857142874366239149e-01,
+			2.222219843214978396e-01,
+			1.818357216161805012e-01,
+			1.531383769920937332e-01,
+			1.479819860511658591e-01));
+		typename Backend::type hfsq = Backend::mul(Backend::set(0.5), Backend::mul(f, f));
+		return Backend::mul(s, Backend::add(hfsq, r));
+	}
+};
+
+/*
+ * @brief Decomposes x = 2^e * (1 + f), with 1 + f in [sqrt(1/2) ; sqrt(2)[
+ *
+ * x must be positive and finite, subnormal values being supported.
+ * Returns f, and writes e as a floating point integral value.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type decompose(typename Backend::type x, typename Backend::type& e) noexcept
+{
+	using C = log_constants<T>;
+	using type = typename Backend::type;
+	using mask = typename Backend::mask;
+
+	// Exponents of subnormal values are only readable once scaled up
+	mask tiny = Backend::cmplt(x, Backend::set(std::numeric_limits<T>::min()));
+	x = Backend::select(tiny, Backend::mul(x, Backend::set(C::subnormal_scale)), x);
+	e = Backend::sub(Backend::getexp(x), Backend::select(tiny, Backend::set(C::subnormal_exponent), Backend::zero()));
+
+	type m = Backend::getmant(x);
+	mask big = Backend::cmplt(Backend::set(T(1.41421356237309504880)), m);
+	m = Backend::select(big, Backend::mul(m, Backend::set(T(0.5))), m);
+	e = Backend::select(big, Backend::add(e, Backend::one()), e);
+
+	return Backend::sub(m, Backend::one());
+}
+
+/*
+ * @brief Returns e * ln2 + log(1 + f) + c, c being a tiny correction.
+ *
+ * Terms are summed from the smallest to the largest, following the
+ * fdlibm ordering, so that only the last addition is really rounded
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type log_reduced(typename Backend::type f, typename Backend::type e, typename Backend::type c) noexcept
+{
+	using C = log_constants<T>;
+	using type = typename Backend::type;
+
+	type hfsq = Backend::mul(Backend::set(T(0.5)), Backend::mul(f, f));
+	type t    = Backend::fma(e, Backend::set(C::ln2_lo), C::template tail<Backend>(f));
+	t = Backend::add(t, c);
+
+	type y = Backend::sub(Backend::sub(hfsq, t), f);
+	return Backend::sub(Backend::mul(e, Backend::set(C::ln2_hi)), y);
+}
+
+/*
+ * @brief Base-2 logarithm as a double-word hi + lo.
+ *
+ * x must be positive and finite. The relative error of hi + lo is
+ * a few bits below the working precision, so that it can be used
+ * by pow(), where the logarithm is multiplied by large exponents.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type log2_dw(typename Backend::type x, typename Backend::type& lo) noexcept
+{
+	using C = log_constants<T>;
+	using type = typename Backend::type;
+
+	type e;
+	type f = decompose<T, Backend>(x, e);
+
+	// f^2 / 2, exactly, since halving is exact
+	type ffl;
+	type ffh = two_prod<T, Backend>(f, f, ffl);
+	ffh = Backend::mul(ffh, Backend::set(T(0.5)));
+	ffl = Backend::mul(ffl, Backend::set(T(0.5)));
+
+	// log(1 + f) = f - f^2 / 2 + tail(f), with |f| >= f^2 / 2
+	type ll;
+	type lh = fast_two_sum<Backend>(f, Backend::sub(Backend::zero(), ffh), ll);
+	ll = Backend::add(Backend::sub(ll, ffl), C::template tail<Backend>(f));
+	lh = fast_two_sum<Backend>(lh, ll, ll);
+
+	// log2(1 + f) = log(1 + f) * log2(e)
+	type pl;
+	type ph = two_prod<T, Backend>(lh, Backend::set(C::log2e_hi), pl);
+	pl = Backend::fma(lh, Backend::set(C::log2e_lo), pl);
+	pl = Backend::fma(ll, Backend::set(C::log2e_hi), pl);
+
+	// e is integral, so either zero or larger than |log2(1 + f)|
+	type hi = fast_two_sum<Backend>(e, ph, lo);
+	lo = Backend::add(lo, pl);
+	return hi;
+}
+
+// Handles the special values of logarithms: log(+inf) = +inf,
+// log(0) = -inf, log(x < 0) = NaN and log(NaN) = NaN.
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type log_special(typename Backend::type x, typename Backend::type y) noexcept
+{
+	y = Backend::select(Backend::cmplt(x, Backend::set(std::numeric_limits<T>::infinity())), y, x);
+	y = Backend::select(Backend::cmpeq(x, Backend::zero()), Backend::set(-std::numeric_limits<T>::infinity()), y);
+	return Backend::select(Backend::cmplt(x, Backend::zero()), Backend::set(std::numeric_limits<T>::quiet_NaN()), y);
+}
+
+}
+
+/*
+ * @brief Vectorized natural logarithm.
+ *
+ * Accuracy: <= 1 ULP for float and double, including
+ * subnormal arguments. Special values follow the C standard.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type log(typename Backend::type x) noexcept
+{
+	typename Backend::type e;
+	typename Backend::type f = detail::decompose<T, Backend>(x, e);
+	typename Backend::type y = detail::log_reduced<T, Backend>(f, e, Backend::zero());
+	return detail::log_special<T, Backend>(x, y);
+}
+
+/*
+ * @brief Vectorized base-2 logarithm.
+ *
+ * Evaluated in double-word arithmetic, so that exact powers of two
+ * give exact results. Accuracy: <= 1 ULP for float and double.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type log2(typename Backend::type x) noexcept
+{
+	typename Backend::type lo;
+	typename Backend::type hi = detail::log2_dw<T, Backend>(x, lo);
+	return detail::log_special<T, Backend>(x, Backend::add(hi, lo));
+}
+
+/*
+ * @brief Vectorized log(1 + x), accurate for x close to zero.
+ *
+ * u = 1 + x is rounded, and the rounding error is compensated with
+ * the first order term c = (x - (u - 1)) / u. Accuracy: <= 1 ULP
+ * for float and double. The sign of 0 is preserved.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type log1p(typename Backend::type x) noexcept
+{
+	using type = typename Backend::type;
+
+	type u = Backend::add(Backend::one(), x);
+	type c = Backend::div(Backend::sub(x, Backend::sub(u, Backend::one())), u);
+
+	type e;
+	type f = detail::decompose<T, Backend>(u, e);
+	type y = detail::log_reduced<T, Backend>(f, e, c);
+	y = detail::log_special<T, Backend>(u, y);
+
+	return Backend::select(Backend::cmpeq(x, Backend::zero()), x, y);
+}
+
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+
+#include <vectra/core/attributes.hpp>
+
+
+namespace vectra::math
+{
+
+/*
+ * @brief Evaluates a polynomial using Horner's scheme.
+ *
+ * Coefficients are given from the lowest to the highest degree,
+ * so that horner<Backend>(x, c0, c1, c2) computes:
+ *
+ *     c0 + x * (c1 + x * c2)
+ *
+ * The recursion is fully unrolled at compile time, and only uses
+ * the backend primitives, so it can be shared by every backend.
+ * Each step is a single fused multiply-add on backends having FMA.
+ *
+ * @param x  Point at which the polynomial is evaluated.
+ * @param c0 Constant coefficient.
+ * @param cs Remaining coefficients, by increasing degree.
+ */
+template <typename Backend, typename T>
+FORCE_INLINE typename Backend::type horner(typename Backend::type, T c0) noexcept
+{
+	return Backend::set(c0);
+}
+
+template <typename Backend, typename T, typename... Ts>
+FORCE_INLINE typename Backend::type horner(typename Backend::type x, T c0, Ts... cs) noexcept
+{
+	return Backend::fma(horner<Backend>(x, cs...), x, Backend::set(c0));
+}
+
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+
+#include <limits>
+
+#include <vectra/core/attributes.hpp>
+#include <vectra/math/compensated.hpp>
+#include <vectra/math/exponential.hpp>
+#include <vectra/math/logarithmic.hpp>
+#include <vectra/math/polynomial.hpp>
+
+
+namespace vectra::math
+{
+
+/*
+ * @brief Vectorized power function, x^y.
+ *
+ * Computed as 2^(y * log2|x|), where both the logarithm and the
+ * product are evaluated in double-word arithmetic. The remaining
+ * error grows slowly with |y * log2|x||, i.e. with the magnitude
+ * of the exponent of the result:
+ *  - float : <= 2 ULP for results in [2^-64 ; 2^64], <= 5 ULP else
+ *  - double: <= 2 ULP on the whole range
+ *
+ * Special values follow the C standard: x^0 = 1 and 1^y = 1 even
+ * for NaN, negative x gives NaN unless y is an integer, and signed
+ * zeros or infinities with odd integer exponents keep their sign.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type pow(typename Backend::type x, typename Backend::type y) noexcept
+{
+	using C = detail::exp_constants<T>;
+	using type = typename Backend::type;
+
+	const type inf = Backend::set(std::numeric_limits<T>::infinity());
+	const type nan = Backend::set(std::numeric_limits<T>::quiet_NaN());
+
+	// log2|x| as hi + lo, with log2(0) = -inf and log2(inf) = inf
+	type ax = Backend::abs(x);
+	type lo;
+	type hi = detail::log2_dw<T, Backend>(ax, lo);
+	hi = Backend::select(Backend::cmplt(ax, inf), hi, ax);
+	hi = Backend::select(Backend::cmpeq(ax, Backend::zero()), Backend::sub(Backend::zero(), inf), hi);
+
+	// w = y * log2|x|, as wh + wl
+	type wl;
+	type wh = two_prod<T, Backend>(y, hi, wl);
+	wl = Backend::fma(y, lo, wl);
+
+	// When wh is clamped, the result has already overflowed, or
+	// underflowed, and wl may not even be finite: it is dropped.
+	type wc = detail::clamp<Backend>(wh,
+		Backend::set(C::lo * C::log2e),
+		Backend::set(C::hi * C::log2e));
+	wl = Backend::select(Backend::cmpeq(wc, wh), wl, Backend::zero());
+
+	// 2^w = 2^n * exp((w - n) * ln2), with w - n computed exactly
+	type n = Backend::round(wc);
+	type r = Backend::mul(Backend::add(Backend::sub(wc, n), wl), Backend::set(C::ln2));
+	type z = Backend::add(Backend::one(), detail::expm1_reduced<T, Backend>(r));
+	z = detail::scale<T, Backend>(z, n);
+
+	// |x| = 1 gives 1, even when y is infinite or NaN
+	z = Backend::select(Backend::cmpeq(ax, Backend::one()), Backend::one(), z);
+
+	// Negative x: the sign of x is kept when y is an odd integer,
+	// and the result is NaN when y is not an integer at all.
+	type half  = Backend::floor(Backend::mul(y, Backend::set(T(0.5))));
+	typename Backend::mask isint = Backend::cmpeq(Backend::round(y), y);
+	typename Backend::mask isodd = Backend::cmpeq(Backend::sub(y, Backend::add(half, half)), Backend::one());
+	z = Backend::select(isodd, Backend::bit_or(z, Backend::bit_and(x, Backend::set(T(-0.)))), z);
+	z = Backend::select(Backend::cmplt(x, Backend::zero()), Backend::select(isint, z, nan), z);
+
+	return Backend::select(Backend::cmpeq(y, Backend::zero()), Backend::one(), z);
+}
+
+/*
+ * @brief Vectorized cube root.
+ *
+ * With |x| = m * 2^(3q + k), m in [1 ; 2[ and k in {0, 1, 2}, we
+ * have cbrt|x| = cbrt(m * 2^k) * 2^q. The first factor is seeded
+ * with the Cephes polynomial (about 12 correct bits) and refined
+ * with Halley's method, once for float and twice for double.
+ *
+ * Accuracy: <= 1 ULP for float and double, including subnormals.
+ * Zeros, infinities and NaN are returned unchanged.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type cbrt(typename Backend::type x) noexcept
+{
+	using C = detail::log_constants<T>;
+	using type = typename Backend::type;
+	using mask = typename Backend::mask;
+
+	type ax = Backend::abs(x);
+
+	// Subnormal values are scaled up by a power of 2^3 first
+	mask tiny = Backend::cmplt(ax, Backend::set(std::numeric_limits<T>::min()));
+	type sx   = Backend::select(tiny, Backend::mul(ax, Backend::set(C::subnormal_scale)), ax);
+	type e    = Backend::sub(Backend::getexp(sx), Backend::select(tiny, Backend::set(C::subnormal_exponent), Backend::zero()));
+	type m    = Backend::getmant(sx);
+
+	// e = 3q + k, then t = m * 2^k. Since 1/3 is rounded, e / 3 is
+	// offset by half a third to avoid flooring 3q slightly below q
+	type q = Backend::floor(Backend::mul(Backend::add(e, Backend::set(T(0.5))), Backend::set(T(1) / T(3))));
+	type k = Backend::fnma(q, Backend::set(T(3)), e);
+	mask k1 = Backend::cmpeq(k, Backend::one());
+	mask k2 = Backend::cmpeq(k, Backend::set(T(2)));
+	type t  = Backend::mul(m, Backend::select(k1, Backend::set(T(2)), Backend::select(k2, Backend::set(T(4)), Backend::one())));
+
+	// cbrt(t) = cbrt(m / 2) * cbrt(2^(k + 1)), seeded by polynomial
+	type y = horner<Backend>(Backend::mul(m, Backend::set(T(0.5))),
+		T( 4.0238979564544752126924e-1),
+		T( 1.1399983354717293273738e0),
+		T(-9.5438224771509446525043e-1),
+		T( 5.4664601366395524503440e-1),
+		T(-1.3466110473359520655053e-1));
+	y = Backend::mul(y, Backend::select(k1, Backend::set(T(1.5874010519681994748)),
+	                    Backend::select(k2, Backend::set(T(2)), Backend::set(T(1.2599210498948731648)))));
+
+	// Halley: y -= y * (y^3 - t) / (2 y^3 + t), cubic convergence
+	constexpr int iterations = sizeof(T) == 4 ? 1 : 2;
+	for (int i = 0; i < iterations; ++i)
+	{
+		type y3 = Backend::mul(Backend::mul(y, y), y);
+		type d  = Backend::div(Backend::sub(y3, t), Backend::add(Backend::add(y3, y3), t));
+		y = Backend::fnma(y, d, y);
+	}
+
+	y = Backend::mul(y, Backend::exp2i(q));
+	y = Backend::bit_or(y, Backend::bit_and(x, Backend::set(T(-0.))));
+
+	// Zeros, infinities and NaN are their own cube root
+	y = Backend::select(Backend::cmpeq(ax, Backend::zero()), x, y);
+	return Backend::select(Backend::cmplt(ax, Backend::set(std::numeric_limits<T>::infinity())), y, x);
+}
+
+}
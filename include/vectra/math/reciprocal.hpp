@@ -0,0 +1,114 @@
+#pragma once
+
+
+#include <type_traits>
+
+#include <vectra/core/attributes.hpp>
+
+
+namespace vectra::math
+{
+
+/*
+ * @brief Newton-Raphson refinement of reciprocal estimates.
+ *
+ * Each step roughly doubles the number of correct bits of y:
+ *  - 1/x      : y' = y + y * (1 - x * y)
+ *  - 1/sqrt(x): y' = y + y/2 * (1 - x * y^2)
+ * the correction being computed from the residual, so that the last
+ * step only adds a small term to y and rounds once more.
+ *
+ * Zeros and infinities make the residual NaN (0 * inf), the estimate
+ * is then already exact (inf or 0) and is returned as is. NaN and
+ * negative arguments of rsqrt stay NaN.
+ */
+namespace detail
+{
+
+// Arguments whose reciprocal and reciprocal square root are normal
+template <typename T> struct estimate_range;
+template <> struct estimate_range<float>  { static constexpr float  min = 0x1p-126f; static constexpr float  max = 0x1p126f; };
+template <> struct estimate_range<double> { static constexpr double min = 0x1p-1022; static constexpr double max = 0x1p1022; };
+
+}
+
+/*
+ * @brief Reciprocal estimates over the whole range, for the backends
+ * built on rcpps and rsqrtps (SSE4.1, AVX and AVX2).
+ *
+ * Those instructions read subnormal arguments as zeros and flush
+ * subnormal results, and double is seeded in float, whose exponent
+ * range is far narrower. Double estimates are therefore taken on the
+ * significand, in [1 ; 2[ for 1/x and [1 ; 4[ for 1/sqrt(x), and
+ * scaled back by the exponent. Lanes out of estimate_range, zeros,
+ * infinities and NaN included, are divided instead, behind a branch
+ * that normal data does not take.
+ */
+template <typename T, typename Backend, typename Estimate>
+FORCE_INLINE typename Backend::type rcp_estimate(typename Backend::type x, Estimate estimate) noexcept
+{
+	using R = detail::estimate_range<T>;
+
+	const typename Backend::type ax = Backend::abs(x);
+
+	typename Backend::type y;
+	if constexpr (std::is_same_v<T, float>)
+		y = estimate(x);
+	else
+	{
+		y = Backend::mul(estimate(Backend::getmant(ax)), Backend::exp2i(Backend::sub(Backend::zero(), Backend::getexp(ax))));
+		y = Backend::bit_or(y, Backend::bit_and(x, Backend::set(T(-0.))));
+	}
+
+	const typename Backend::mask inside = Backend::mask_and(Backend::cmpge(ax, Backend::set(R::min)), Backend::cmple(ax, Backend::set(R::max)));
+	if (Backend::all(inside))
+		return y;
+	return Backend::select(inside, y, Backend::div(Backend::one(), x));
+}
+
+template <typename T, typename Backend, typename Estimate>
+FORCE_INLINE typename Backend::type rsqrt_estimate(typename Backend::type x, Estimate estimate) noexcept
+{
+	using R = detail::estimate_range<T>;
+
+	typename Backend::type y;
+	if constexpr (std::is_same_v<T, float>)
+		y = estimate(x);
+	else
+	{
+		// x = m * 2^(2h), the exponent being made even
+		const typename Backend::type h = Backend::floor(Backend::mul(Backend::getexp(x), Backend::set(T(0.5))));
+		const typename Backend::type m = Backend::mul(x, Backend::exp2i(Backend::mul(h, Backend::set(T(-2)))));
+		y = Backend::mul(estimate(m), Backend::exp2i(Backend::sub(Backend::zero(), h)));
+	}
+
+	const typename Backend::mask inside = Backend::mask_and(Backend::cmpge(x, Backend::set(R::min)), Backend::cmple(x, Backend::set(R::max)));
+	if (Backend::all(inside))
+		return y;
+	return Backend::select(inside, y, Backend::div(Backend::one(), Backend::sqrt(x)));
+}
+
+template <typename T, typename Backend, int steps>
+FORCE_INLINE typename Backend::type rcp_newton(typename Backend::type x, typename Backend::type y) noexcept
+{
+	typename Backend::type r = y;
+	for (int i = 0; i < steps; ++i)
+		r = Backend::fma(r, Backend::fnma(x, r, Backend::one()), r);
+
+	return Backend::select(Backend::cmpeq(r, r), r, y);
+}
+
+template <typename T, typename Backend, int steps>
+FORCE_INLINE typename Backend::type rsqrt_newton(typename Backend::type x, typename Backend::type y) noexcept
+{
+	typename Backend::type r = y;
+	for (int i = 0; i < steps; ++i)
+	{
+		typename Backend::type e = Backend::fnma(Backend::mul(x, r), r, Backend::one());
+		r = Backend::fma(Backend::mul(r, Backend::set(T(0.5))), e, r);
+	}
+
+	return Backend::select(Backend::cmpeq(r, r), r, y);
+}
+
+}
@@ -0,0 +1,250 @@
+#pragma once
+
+
+#include <cmath>
+#include <cstddef>
+
+#include <vectra/core/attributes.hpp>
+#include <vectra/math/polynomial.hpp>
+
+
+namespace vectra::math
+{
+
+namespace detail
+{
+
+/*
+ * @brief Precision-specific constants of the sin/cos kernels.
+ *
+ * The argument is reduced as r = x - j * pi/2 with the Cody-Waite
+ * scheme: pi/2 is split into several parts whose leading ones have
+ * so few significant bits that j * part is exact. The polynomials
+ * are the Cephes minimax approximations of sin, cos on [-pi/4, pi/4]
+ */
+template <typename T>
+struct sincos_constants;
+
+template <>
+struct sincos_constants<float>
+{
+	static constexpr float two_over_pi     = 0.636619772367581343f;
+	static constexpr float reduction_limit = 8192.f;
+
+	// Single precision needs a four parts split, 11 bits for each of
+	// the leading ones, so that the reduction stays exact up to 8192
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type reduce(typename Backend::type x, typename Backend::type j) noexcept
+	{
+		typename Backend::type r = Backend::fnma(j, Backend::set(1.5703125f), x);
+		r = Backend::fnma(j, Backend::set(4.837512969970703125e-4f), r);
+		r = Backend::fnma(j, Backend::set(7.54953362047672271728515625e-8f), r);
+		r = Backend::fnma(j, Backend::set(2.56334406825708960298e-12f), r);
+		return r;
+	}
+
+	// sin(r) = r + r * z * P(z), with z = r^2
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type sin(typename Backend::type r, typename Backend::type z) noexcept
+	{
+		typename Backend::type p = horner<Backend>(z,
+			-1.6666654611e-1f,
+			 8.3321608736e-3f,
+			-1.9515295891e-4f);
+		return Backend::fma(Backend::mul(r, z), p, r);
+	}
+
+	// cos(r) = 1 - z / 2 + z^2 * Q(z), with z = r^2
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type cos(typename Backend::type z) noexcept
+	{
+		typename Backend::type q = horner<Backend>(z,
+			 4.166664568298827e-2f,
+			-1.388731625493765e-3f,
+			 2.443315711809948e-5f);
+		typename Backend::type c = Backend::fnma(Backend::set(0.5f), z, Backend::one());
+		return Backend::fma(Backend::mul(z, z), q, c);
+	}
+};
+
+template <>
+struct sincos_constants<double>
+{
+	static constexpr double two_over_pi     = 0.63661977236758134308;
+	static constexpr double reduction_limit = 1e7;
+
+	// Three parts split, as in Cephes (with pi/2 instead of pi/4)
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type reduce(typename Backend::type x, typename Backend::type j) noexcept
+	{
+		typename Backend::type r = Backend::fnma(j, Backend::set(1.57079625129699707031e0), x);
+		r = Backend::fnma(j, Backend::set(7.54978941586159635336e-8), r);
+		r = Backend::fnma(j, Backend::set(5.39030285815811905290e-15), r);
+		return r;
+	}
+
+	// sin(r) = r + r * z * P(z), with z = r^2
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type sin(typename Backend::type r, typename Backend::type z) noexcept
+	{
+		typename Backend::type p = horner<Backend>(z,
+			-1.66666666666666307295e-1,
+			 8.33333333332211858878e-3,
+			-1.98412698295895385996e-4,
+			 2.75573136213857245213e-6,
+			-2.50507477628578072866e-8,
+			 1.58962301576546568060e-10);
+		return Backend::fma(Backend::mul(r, z), p, r);
+	}
+
+	// cos(r) = 1 - z / 2 + z^2 * Q(z), with z = r^2
+	template <typename Backend>
+	FORCE_INLINE static typename Backend::type cos(typename Backend::type z) noexcept
+	{
+		typename Backend::type q = horner<Backend>(z,
+			 4.16666666666665929218e-2,
+			-1.38888888888730564116e-3,
+			 2.48015872888517045348e-5,
+			-2.75573141792967388112e-7,
+			 2.08757008419747316778e-9,
+			-1.13585365213876817300e-11);
+		typename Backend::type c = Backend::fnma(Backend::set(0.5), z, Backend::one());
+		return Backend::fma(Backend::mul(z, z), q, c);
+	}
+};
+
+/*
+ * @brief Reduces x to r in [-pi/4 ; pi/4], with x = j * pi/2 + r.
+ *
+ * Both j and r are returned as floating point registers, so that
+ * the quadrant logic can stay in the floating point domain, which
+ * is available on every backend (AVX has no 256-bit integer ops).
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type reduce_pio2(typename Backend::type x, typename Backend::type& j) noexcept
+{
+	using C = sincos_constants<T>;
+
+	// Adding zero turns j = -0 into +0, so that x - j * pi/2 keeps
+	// the sign of x when x is a signed zero (-0 - -0 would be +0).
+	j = Backend::round(Backend::mul(x, Backend::set(C::two_over_pi)));
+	j = Backend::add(j, Backend::zero());
+
+	return C::template reduce<Backend>(x, j);
+}
+
+// Scalar path of large_arguments(), kept out of line
+template <typename T, typename Backend, typename F>
+typename Backend::type large_arguments_slow(typename Backend::type x, typename Backend::type y, unsigned lanes, F f) noexcept
+{
+	T xs[Backend::width()];
+	T ys[Backend::width()];
+	Backend::unloadu(xs, x);
+	Backend::unloadu(ys, y);
+	for (std::size_t k = 0; k < Backend::width(); ++k)
+		if ((lanes >> k) & 1u)
+			ys[k] = f(xs[k]);
+	return Backend::loadu(ys);
+}
+
+/*
+ * @brief Recomputes with f (std::sin or std::cos) the lanes of y
+ * whose argument is beyond sincos_constants<T>::reduction_limit.
+ *
+ * The Cody-Waite reduction loses accuracy past that limit, and for
+ * huge arguments its result is no longer in [-pi/4 ; pi/4] at all,
+ * so the polynomials would return anything. The standard library
+ * reduces exactly (Payne-Hanek). Its scalar path is only taken when
+ * such a lane exists, infinities included (they give NaN).
+ */
+template <typename T, typename Backend, typename F>
+FORCE_INLINE typename Backend::type large_arguments(typename Backend::type x, typename Backend::type y, F f) noexcept
+{
+	const typename Backend::mask large = Backend::cmpgt(Backend::abs(x), Backend::set(sincos_constants<T>::reduction_limit));
+	if (!Backend::any(large))
+		return y;
+	return large_arguments_slow<T, Backend>(x, y, Backend::movemask(large), f);
+}
+
+/*
+ * @brief Returns +1 when h is even and -1 when h is odd.
+ *
+ * h must hold integral values. Computed as 1 - 2 * (h mod 2), so
+ * that the result can simply be multiplied with the polynomials.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type parity_sign(typename Backend::type h) noexcept
+{
+	typename Backend::type half = Backend::floor(Backend::mul(h, Backend::set(T(0.5))));
+	typename Backend::type odd  = Backend::sub(h, Backend::add(half, half));
+	return Backend::sub(Backend::one(), Backend::add(odd, odd));
+}
+
+}
+
+/*
+ * @brief Vectorized sine, built only from backend primitives.
+ *
+ * Range reduction by pi/2 (Cody-Waite), then evaluation of both
+ * the sine and cosine minimax polynomials, and selection of the
+ * right one according to the quadrant. The kernel is branch-free
+ *
+ * Accuracy, measured against a higher precision reference:
+ *  - float : <= 1.5 ULP on [-pi ; pi], <= 2.5 ULP for |x| <= 8192
+ *  - double: <= 1.5 ULP on [-pi ; pi], <= 2   ULP for |x| <= 1e7
+ *
+ * Beyond these ranges, lanes are computed by the standard library,
+ * which reduces the argument exactly, on a much slower scalar path.
+ * The sign of zero is preserved, and infinities or NaN give NaN.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type sin(typename Backend::type x) noexcept
+{
+	using C = detail::sincos_constants<T>;
+	using type = typename Backend::type;
+
+	type j;
+	type r = detail::reduce_pio2<T, Backend>(x, j);
+	type z = Backend::mul(r, r);
+
+	type s = C::template sin<Backend>(r, z);
+	type c = C::template cos<Backend>(z);
+
+	// Quadrant j mod 4: 0 -> s, 1 -> c, 2 -> -s, 3 -> -c
+	type h = Backend::floor(Backend::mul(j, Backend::set(T(0.5))));
+	type y = Backend::select(Backend::cmpeq(j, Backend::add(h, h)), s, c);
+	y = Backend::mul(y, detail::parity_sign<T, Backend>(h));
+
+	// The polynomial turns -0 into +0, restore the sign of zero
+	y = Backend::select(Backend::cmpeq(x, Backend::zero()), x, y);
+	return detail::large_arguments<T, Backend>(x, y, [](T v) { return std::sin(v); });
+}
+
+/*
+ * @brief Vectorized cosine, built only from backend primitives.
+ *
+ * Same kernel as sin(x), evaluated in the quadrant j + 1 since we
+ * have cos(x) = sin(x + pi/2). Accuracy bounds are the same too.
+ */
+template <typename T, typename Backend>
+FORCE_INLINE typename Backend::type cos(typename Backend::type x) noexcept
+{
+	using C = detail::sincos_constants<T>;
+	using type = typename Backend::type;
+
+	type j;
+	type r = detail::reduce_pio2<T, Backend>(x, j);
+	type z = Backend::mul(r, r);
+
+	type s = C::template sin<Backend>(r, z);
+	type c = C::template cos<Backend>(z);
+
+	// Quadrant j mod 4: 0 -> c, 1 -> -s, 2 -> -c, 3 -> s
+	j = Backend::add(j, Backend::one());
+	type h = Backend::floor(Backend::mul(j, Backend::set(T(0.5))));
+	type y = Backend::select(Backend::cmpeq(j, Backend::add(h, h)), s, c);
+	y = Backend::mul(y, detail::parity_sign<T, Backend>(h));
+	return detail::large_arguments<T, Backend>(x, y, [](T v) { return std::cos(v); });
+}
+
+}
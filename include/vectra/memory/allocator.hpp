@@ -1,8 +1,21 @@
 #pragma once
 
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
 namespace vectra
 {
 
+/*
+ * @brief Largest register alignment among the supported backends.
+ *
+ * AVX-512 registers (__m512, __m512d) are 64 bytes wide, which also
+ * matches the cache line size of x86 processors. Buffers aligned on
+ * this boundary can be processed with aligned loads by any backend.
+ */
+inline constexpr std::size_t max_simd_alignment = 64;
+
 /*
  * @brief STL-compatible aligned allocator.
  *
@@ -24,9 +37,11 @@ namespace vectra
  *  - A power of two
  *  - >= alignof(T)
  *
+ * By default, blocks are aligned to max_simd_alignment (64 bytes).
+ *
  * This allocator is stateless and all instances are interchangeable.
  */
-template <typename T, std::size_t Alignment>
+template <typename T, std::size_t Alignment = max_simd_alignment>
 class aligned_allocator
 {
     // Alignment must be a power of two
@@ -0,0 +1,239 @@
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <vectra/memory/allocator.hpp>
+
+
+namespace vectra
+{
+
+/*
+ * @brief Monotonic arena of aligned memory.
+ *
+ * Allocations bump an offset in large blocks obtained from aligned
+ * operator new, and are only given back all at once: deallocate() is
+ * a no-op, reset() (or rewind() to a mark) makes the memory of every
+ * allocation available again. Blocks are kept across resets, so an
+ * arena reused for similar work stops calling operator new after
+ * the first round.
+ *
+ * Every allocation is aligned on max_simd_alignment at least. The
+ * arena is neither copyable nor movable, allocators referring to it,
+ * and is not thread-safe: see scratch_arena() for one per thread.
+ */
+class aligned_arena
+{
+public:
+	// Position in the arena, returned by mark() and passed to rewind()
+	struct marker
+	{
+		std::size_t block  = 0;
+		std::size_t offset = 0;
+	};
+
+	explicit aligned_arena(std::size_t block_size = std::size_t(64) << 10) noexcept
+		: block_size_(std::max(block_size, max_simd_alignment))
+	{
+	}
+
+	~aligned_arena() { release(); }
+
+	aligned_arena(const aligned_arena&) = delete;
+	aligned_arena& operator=(const aligned_arena&) = delete;
+
+	/*
+	 * @brief Allocates bytes aligned on alignment (a power of two).
+	 *
+	 * Requests that do not fit in the current block go to the next
+	 * kept block large enough, or to a new block at least twice as
+	 * large as the previous one. Throws std::bad_alloc on failure.
+	 */
+	[[nodiscard]] void* allocate(std::size_t bytes, std::size_t alignment = max_simd_alignment)
+	{
+		alignment = std::max(alignment, max_simd_alignment);
+
+		for (; current_.block < blocks_.size(); ++current_.block, current_.offset = 0)
+		{
+			const block& b = blocks_[current_.block];
+
+			const std::uintptr_t base    = reinterpret_cast<std::uintptr_t>(b.data);
+			const std::size_t    aligned = ((base + current_.offset + alignment - 1) & ~std::uintptr_t(alignment - 1)) - base;
+
+			if (aligned <= b.size && bytes <= b.size - aligned)
+			{
+				current_.offset = aligned + bytes;
+				return b.data + aligned;
+			}
+		}
+
+		// The new block goes at the end, where rewinding finds it again
+		const std::size_t previous = blocks_.empty() ? block_size_ : blocks_.back().size * 2;
+		const std::size_t size     = std::max(previous, bytes + alignment);
+
+		blocks_.reserve(blocks_.size() + 1);
+		std::byte* data = static_cast<std::byte*>(::operator new(size, std::align_val_t{ max_simd_alignment }));
+		blocks_.push_back({ data, size });
+
+		return allocate(bytes, alignment);
+	}
+
+	// Memory is only released by reset(), rewind() or release()
+	void deallocate(void*, std::size_t) noexcept {}
+
+	// Every allocation made after m is released, the older ones stay
+	marker mark() const noexcept { return current_; }
+	void rewind(marker m) noexcept { current_ = m; }
+
+	// Every allocation is released, blocks are kept for the next ones
+	void reset() noexcept { current_ = marker{}; }
+
+	// Every allocation is released, and blocks are freed
+	void release() noexcept
+	{
+		for (const block& b : blocks_)
+			::operator delete(b.data, std::align_val_t{ max_simd_alignment });
+
+		blocks_.clear();
+		current_ = marker{};
+	}
+
+	// Bytes of the kept blocks
+	std::size_t capacity() const noexcept
+	{
+		std::size_t bytes = 0;
+		for (const block& b : blocks_)
+			bytes += b.size;
+		return bytes;
+	}
+
+private:
+	struct block
+	{
+		std::byte*  data;
+		std::size_t size;
+	};
+
+	std::vector<block> blocks_;
+	marker             current_;
+	std::size_t        block_size_;
+};
+
+/*
+ * @brief STL allocator drawing from an aligned_arena.
+ *
+ * Stateful: it refers to its arena, which must outlive containers
+ * using it, and two allocators are equal when they share the arena.
+ * The allocator propagates on copy and move assignment and on swap,
+ * so that the memory of a container always comes from the arena of
+ * its allocator: moves and swaps are O(1), and never mix arenas.
+ *
+ * Deallocation is a no-op, e.g. a growing vector leaves its previous
+ * buffers in the arena until the next reset: reserve() first.
+ */
+template <typename T, std::size_t Alignment = max_simd_alignment>
+class arena_allocator
+{
+	static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two.");
+	static_assert(Alignment >= alignof(T), "Alignment must be >= alignof(T).");
+
+public:
+	using value_type = T;
+
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap            = std::true_type;
+	using is_always_equal                        = std::false_type;
+
+	arena_allocator(aligned_arena& arena) noexcept : arena_(&arena) {}
+
+	template <typename U>
+	arena_allocator(const arena_allocator<U, Alignment>& other) noexcept : arena_(&other.arena()) {}
+
+	[[nodiscard]] T* allocate(std::size_t n)
+	{
+		if (n > std::size_t(-1) / sizeof(T))
+			throw std::bad_array_new_length();
+
+		return static_cast<T*>(arena_->allocate(n * sizeof(T), Alignment));
+	}
+
+	void deallocate(T* ptr, std::size_t n) noexcept { arena_->deallocate(ptr, n * sizeof(T)); }
+
+	aligned_arena& arena() const noexcept { return *arena_; }
+
+	template <typename U>
+	struct rebind
+	{
+		using other = arena_allocator<U, Alignment>;
+	};
+
+private:
+	aligned_arena* arena_;
+};
+
+template <typename T1, std::size_t A1, typename T2, std::size_t A2>
+bool operator==(const arena_allocator<T1, A1>& a, const arena_allocator<T2, A2>& b) noexcept
+{
+	return A1 == A2 && &a.arena() == &b.arena();
+}
+
+template <typename T1, std::size_t A1, typename T2, std::size_t A2>
+bool operator!=(const arena_allocator<T1, A1>& a, const arena_allocator<T2, A2>& b) noexcept
+{
+	return !(a == b);
+}
+
+/*
+ * @brief Arena of the calling thread, for per-request scratch memory.
+ *
+ * Each thread has its own arena, so no locking is involved. Scratch
+ * buffers are meant to be released in bulk with a scratch_scope:
+ *
+ *     vectra::scratch_scope scope;
+ *     vectra::scratch_vector<float> tmp(n, scope.allocator<float>());
+ *
+ * Memory must not be handed over to another thread that outlives
+ * the scope.
+ */
+inline aligned_arena& scratch_arena() noexcept
+{
+	thread_local aligned_arena arena;
+	return arena;
+}
+
+template <typename T>
+using scratch_vector = std::vector<T, arena_allocator<T>>;
+
+// Releases every scratch allocation made during its lifetime. Scopes
+// may be nested, inner ones being destroyed first.
+class scratch_scope
+{
+public:
+	explicit scratch_scope(aligned_arena& arena = scratch_arena()) noexcept
+		: arena_(arena), mark_(arena.mark())
+	{
+	}
+
+	~scratch_scope() { arena_.rewind(mark_); }
+
+	scratch_scope(const scratch_scope&) = delete;
+	scratch_scope& operator=(const scratch_scope&) = delete;
+
+	template <typename T>
+	arena_allocator<T> allocator() const noexcept { return arena_allocator<T>(arena_); }
+
+	aligned_arena& arena() const noexcept { return arena_; }
+
+private:
+	aligned_arena&        arena_;
+	aligned_arena::marker mark_;
+};
+
+}
@@ -0,0 +1,292 @@
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#include <vectra/core/simd_level.hpp>
+#include <vectra/memory/allocator.hpp>
+#include <vectra/parallel/parallel_for.hpp>
+
+#if defined(__linux__)
+	#include <linux/mempolicy.h>
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
+
+
+namespace vectra
+{
+
+// Size of the huge pages used by large buffers (x86-64 2 MB pages)
+inline constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+/*
+ * @brief Pages backing large buffers.
+ *
+ *  - standard        : regular 4 KB pages.
+ *  - transparent_huge: regular mapping aligned on huge_page_size and
+ *                      advised with MADV_HUGEPAGE, so that the kernel
+ *                      backs it with huge pages when it can. Needs
+ *                      transparent huge pages set to "madvise" or
+ *                      "always" (/sys/kernel/mm/transparent_hugepage).
+ *  - explicit_huge   : pages reserved from the hugetlbfs pool (see
+ *                      vm.nr_hugepages), falling back to transparent
+ *                      huge pages when the pool is empty.
+ */
+enum class page_size : std::uint8_t
+{
+	standard,
+	transparent_huge,
+	explicit_huge
+};
+
+/*
+ * @brief NUMA placement of large buffers.
+ *
+ *  - none       : pages go to the node of the thread writing them
+ *                 first, usually the one initializing the buffer.
+ *  - first_touch: pages are written once at allocation, by the threads
+ *                 of thread_pool::global(), chunk by chunk as the
+ *                 execution::parallel algorithms split the buffer:
+ *                 each chunk tends to live on the node of the thread
+ *                 that later processes it. Threads are not pinned, so
+ *                 this is a best effort.
+ *  - bind       : pages are bound to the node given in the policy.
+ *                 Nodes 0 to 63 only: larger ones are left to the
+ *                 default placement, as when binding fails.
+ */
+enum class numa_placement : std::uint8_t
+{
+	none,
+	first_touch,
+	bind
+};
+
+struct large_buffer_policy
+{
+	page_size      pages = page_size::transparent_huge;
+	numa_placement numa  = numa_placement::first_touch;
+	int            node  = 0;
+};
+
+inline bool operator==(const large_buffer_policy& a, const large_buffer_policy& b) noexcept
+{
+	return a.pages == b.pages && a.numa == b.numa && (a.numa != numa_placement::bind || a.node == b.node);
+}
+
+inline bool operator!=(const large_buffer_policy& a, const large_buffer_policy& b) noexcept
+{
+	return !(a == b);
+}
+
+namespace detail
+{
+
+// Mapped length of a buffer, a function of its size and policy only,
+// so that deallocation unmaps exactly what allocation mapped
+inline std::size_t mappedLength(std::size_t bytes, page_size pages) noexcept
+{
+	const std::size_t page = pages == page_size::standard ? std::size_t(4096) : huge_page_size;
+	return (bytes + page - 1) / page * page;
+}
+
+#if defined(__linux__)
+
+// Anonymous mapping of length bytes (a multiple of alignment), aligned
+// on alignment by over-mapping then trimming both ends
+inline void* mapAligned(std::size_t length, std::size_t alignment) noexcept
+{
+	void* p = ::mmap(nullptr, length + alignment, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (p == MAP_FAILED)
+		return nullptr;
+
+	const std::uintptr_t base  = reinterpret_cast<std::uintptr_t>(p);
+	const std::uintptr_t start = (base + alignment - 1) & ~std::uintptr_t(alignment - 1);
+
+	if (start != base)
+		::munmap(p, start - base);
+	if (start + length != base + length + alignment)
+		::munmap(reinterpret_cast<void*>(start + length), base + alignment - start);
+
+	return reinterpret_cast<void*>(start);
+}
+
+// Placement failures are ignored: the memory is still valid, only on
+// another node (e.g. no NUMA support, or a seccomp filter)
+inline void bindToNode(void* p, std::size_t length, int node) noexcept
+{
+	constexpr int bits = int(sizeof(unsigned long) * 8);
+	if (node < 0 || node >= bits)
+		return;
+
+	// The kernel reads maxnode - 1 bits of the mask
+	const unsigned long mask = 1ul << node;
+	::syscall(SYS_mbind, p, length, MPOL_BIND, &mask, static_cast<unsigned long>(bits + 1), 0u);
+}
+
+#endif
+
+}
+
+/*
+ * @brief Allocates bytes of memory for a large buffer.
+ *
+ * Buffers of at least huge_page_size bytes are mapped directly, with
+ * the pages and NUMA placement of policy. They are aligned on the
+ * page size, or on alignment when it is larger. Smaller ones come
+ * from aligned operator new, aligned on alignment, as does every
+ * buffer on systems other than Linux. Memory is not initialized,
+ * and is freed by deallocate_large() with the same size and policy.
+ * Throws std::bad_alloc on failure.
+ *
+ * First touch placement is done by the typed large_allocator, which
+ * knows how the algorithms will split the buffer.
+ */
+inline void* allocate_large(std::size_t bytes, large_buffer_policy policy = {}, std::size_t alignment = max_simd_alignment)
+{
+#if defined(__linux__)
+	if (bytes >= huge_page_size)
+	{
+		const std::size_t length = detail::mappedLength(bytes, policy.pages);
+
+		void* p = nullptr;
+
+		if (policy.pages == page_size::explicit_huge)
+		{
+			p = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+			if (p == MAP_FAILED)
+				p = nullptr;
+		}
+
+		if (p == nullptr)
+		{
+			const bool        huge = policy.pages != page_size::standard;
+			const std::size_t page = huge ? huge_page_size : std::size_t(4096);
+
+			p = detail::mapAligned(length, alignment > page ? alignment : page);
+			if (p == nullptr)
+				throw std::bad_alloc();
+
+#if defined(MADV_HUGEPAGE)
+			if (huge)
+				::madvise(p, length, MADV_HUGEPAGE);
+#endif
+		}
+
+		// Before any page is touched, so that they are all placed
+		if (policy.numa == numa_placement::bind)
+			detail::bindToNode(p, length, policy.node);
+
+		return p;
+	}
+#else
+	(void)policy;
+#endif
+
+	return ::operator new(bytes, std::align_val_t{ alignment });
+}
+
+inline void deallocate_large(void* p, std::size_t bytes, large_buffer_policy policy = {}, std::size_t alignment = max_simd_alignment) noexcept
+{
+	if (p == nullptr)
+		return;
+
+#if defined(__linux__)
+	if (bytes >= huge_page_size)
+	{
+		::munmap(p, detail::mappedLength(bytes, policy.pages));
+		return;
+	}
+#else
+	(void)policy;
+#endif
+
+	::operator delete(p, std::align_val_t{ alignment });
+}
+
+/*
+ * @brief STL allocator for large buffers, see allocate_large().
+ *
+ * A drop-in replacement for aligned_allocator, e.g.
+ * std::vector<float, large_allocator<float>>, whose default policy
+ * uses transparent huge pages and first touch placement. Allocators
+ * are equal when their policies are, and propagate with the memory.
+ *
+ * With first touch placement, the chunks touched at allocation are
+ * the ones of parallel_for<level>() on this buffer, hence of the
+ * execution::parallel algorithms writing to it.
+ */
+template <typename T, std::size_t Alignment = max_simd_alignment, SIMDLevel level = compiletimeSIMDLevel()>
+class large_allocator
+{
+	static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two.");
+	static_assert(Alignment >= alignof(T), "Alignment must be >= alignof(T).");
+
+public:
+	using value_type = T;
+
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap            = std::true_type;
+	using is_always_equal                        = std::false_type;
+
+	large_allocator() noexcept = default;
+	large_allocator(large_buffer_policy policy) noexcept : policy_(policy) {}
+
+	template <typename U>
+	large_allocator(const large_allocator<U, Alignment, level>& other) noexcept : policy_(other.policy()) {}
+
+	[[nodiscard]] T* allocate(std::size_t n)
+	{
+		if (n > std::size_t(-1) / sizeof(T))
+			throw std::bad_array_new_length();
+
+		const std::size_t bytes = n * sizeof(T);
+		T* p = static_cast<T*>(allocate_large(bytes, policy_, Alignment));
+
+		if (bytes >= huge_page_size && policy_.numa == numa_placement::first_touch)
+		{
+			parallel_for<level>(p, n, [p](std::size_t begin, std::size_t end)
+			{
+				std::memset(static_cast<void*>(p + begin), 0, (end - begin) * sizeof(T));
+			});
+		}
+
+		return p;
+	}
+
+	void deallocate(T* p, std::size_t n) noexcept
+	{
+		deallocate_large(p, n * sizeof(T), policy_, Alignment);
+	}
+
+	const large_buffer_policy& policy() const noexcept { return policy_; }
+
+	template <typename U>
+	struct rebind
+	{
+		using other = large_allocator<U, Alignment, level>;
+	};
+
+private:
+	large_buffer_policy policy_;
+};
+
+template <typename T1, typename T2, std::size_t A, SIMDLevel level>
+bool operator==(const large_allocator<T1, A, level>& a, const large_allocator<T2, A, level>& b) noexcept
+{
+	return a.policy() == b.policy();
+}
+
+template <typename T1, typename T2, std::size_t A, SIMDLevel level>
+bool operator!=(const large_allocator<T1, A, level>& a, const large_allocator<T2, A, level>& b) noexcept
+{
+	return !(a == b);
+}
+
+}
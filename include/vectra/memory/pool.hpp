@@ -0,0 +1,192 @@
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <vectra/memory/allocator.hpp>
+
+
+namespace vectra
+{
+
+/*
+ * @brief Pool of fixed-size aligned blocks.
+ *
+ * Blocks are carved from large chunks obtained from aligned operator
+ * new, and recycled through an intrusive free list: allocate() and
+ * deallocate() are a few instructions, and memory is only returned
+ * to the system by release() or the destructor. reset() gives every
+ * block back at once, without walking the live ones.
+ *
+ * Blocks are block_size bytes rounded up to max_simd_alignment, and
+ * aligned on it. The pool is neither copyable nor movable, and is
+ * not thread-safe.
+ */
+class aligned_pool
+{
+public:
+	explicit aligned_pool(std::size_t block_size, std::size_t blocks_per_chunk = 64) noexcept
+		: block_size_((std::max<std::size_t>(block_size, 1) + max_simd_alignment - 1) / max_simd_alignment * max_simd_alignment)
+		, blocks_per_chunk_(std::max<std::size_t>(blocks_per_chunk, 1))
+	{
+	}
+
+	~aligned_pool() { release(); }
+
+	aligned_pool(const aligned_pool&) = delete;
+	aligned_pool& operator=(const aligned_pool&) = delete;
+
+	// Throws std::bad_alloc when a new chunk cannot be allocated
+	[[nodiscard]] void* allocate()
+	{
+		if (free_ == nullptr)
+			grow();
+
+		node* n = free_;
+		free_ = n->next;
+		return n;
+	}
+
+	void deallocate(void* ptr) noexcept
+	{
+		node* n = static_cast<node*>(ptr);
+		n->next = free_;
+		free_ = n;
+	}
+
+	// Every block is free again, chunks are kept for the next ones
+	void reset() noexcept
+	{
+		free_ = nullptr;
+		for (std::byte* chunk : chunks_)
+			link(chunk);
+	}
+
+	// Every block is free again, and chunks are freed
+	void release() noexcept
+	{
+		for (std::byte* chunk : chunks_)
+			::operator delete(chunk, std::align_val_t{ max_simd_alignment });
+
+		chunks_.clear();
+		free_ = nullptr;
+	}
+
+	std::size_t block_size() const noexcept { return block_size_; }
+
+	// Number of blocks of the kept chunks, free or not
+	std::size_t capacity() const noexcept { return chunks_.size() * blocks_per_chunk_; }
+
+private:
+	struct node
+	{
+		node* next;
+	};
+
+	void grow()
+	{
+		chunks_.reserve(chunks_.size() + 1);
+		std::byte* chunk = static_cast<std::byte*>(::operator new(block_size_ * blocks_per_chunk_, std::align_val_t{ max_simd_alignment }));
+		chunks_.push_back(chunk);
+		link(chunk);
+	}
+
+	// Pushes the blocks of a chunk to the free list, the first one on top
+	void link(std::byte* chunk) noexcept
+	{
+		for (std::size_t k = blocks_per_chunk_; k-- > 0;)
+			deallocate(chunk + k * block_size_);
+	}
+
+	std::vector<std::byte*> chunks_;
+	node*                   free_ = nullptr;
+	std::size_t             block_size_;
+	std::size_t             blocks_per_chunk_;
+};
+
+/*
+ * @brief STL allocator drawing single elements from an aligned_pool.
+ *
+ * Meant for node-based containers (std::list, std::map...), which
+ * allocate one node at a time: the rebound node type must fit in a
+ * block of the pool. Other requests, e.g. arrays of buckets, fall
+ * back to aligned operator new, so that any container works.
+ *
+ * Stateful like arena_allocator: the pool must outlive the containers
+ * using it, allocators are equal when they share the pool, and they
+ * propagate on assignment and swap.
+ */
+template <typename T, std::size_t Alignment = max_simd_alignment>
+class pool_allocator
+{
+	static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two.");
+	static_assert(Alignment >= alignof(T), "Alignment must be >= alignof(T).");
+
+public:
+	using value_type = T;
+
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap            = std::true_type;
+	using is_always_equal                        = std::false_type;
+
+	pool_allocator(aligned_pool& pool) noexcept : pool_(&pool) {}
+
+	template <typename U>
+	pool_allocator(const pool_allocator<U, Alignment>& other) noexcept : pool_(&other.pool()) {}
+
+	[[nodiscard]] T* allocate(std::size_t n)
+	{
+		if (pooled(n))
+			return static_cast<T*>(pool_->allocate());
+
+		if (n > std::size_t(-1) / sizeof(T))
+			throw std::bad_array_new_length();
+
+		return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ Alignment }));
+	}
+
+	void deallocate(T* ptr, std::size_t n) noexcept
+	{
+		if (pooled(n))
+			pool_->deallocate(ptr);
+		else
+			::operator delete(ptr, std::align_val_t{ Alignment });
+	}
+
+	aligned_pool& pool() const noexcept { return *pool_; }
+
+	template <typename U>
+	struct rebind
+	{
+		using other = pool_allocator<U, Alignment>;
+	};
+
+private:
+	// Blocks are aligned on max_simd_alignment, larger alignments are
+	// left to operator new
+	bool pooled(std::size_t n) const noexcept
+	{
+		return n == 1 && sizeof(T) <= pool_->block_size() && Alignment <= max_simd_alignment;
+	}
+
+	aligned_pool* pool_;
+};
+
+template <typename T1, std::size_t A1, typename T2, std::size_t A2>
+bool operator==(const pool_allocator<T1, A1>& a, const pool_allocator<T2, A2>& b) noexcept
+{
+	return A1 == A2 && &a.pool() == &b.pool();
+}
+
+template <typename T1, std::size_t A1, typename T2, std::size_t A2>
+bool operator!=(const pool_allocator<T1, A1>& a, const pool_allocator<T2, A2>& b) noexcept
+{
+	return !(a == b);
+}
+
+}
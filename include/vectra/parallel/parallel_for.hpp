@@ -0,0 +1,145 @@
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <vectra/backend/compute_backend.hpp>
+#include <vectra/core/simd_level.hpp>
+#include <vectra/parallel/thread_pool.hpp>
+
+
+namespace vectra
+{
+
+/*
+ * @brief Execution policy of the array algorithms.
+ *
+ *  - sequential: the calling thread only, the default.
+ *  - parallel  : chunks of the arrays are processed by the threads
+ *                of thread_pool::global(). Small arrays still run
+ *                on the calling thread only.
+ */
+enum class execution : std::uint8_t
+{
+	sequential,
+	parallel
+};
+
+namespace detail
+{
+
+inline constexpr std::size_t cache_line = 64;
+
+// Smallest chunk, below which starting the threads costs more than
+// what they save on cheap kernels (about 10 us of arithmetic)
+inline constexpr std::size_t parallel_grain = std::size_t(1) << 14;
+
+// Chunks per thread, so that faster threads can steal the last ones
+inline constexpr std::size_t chunks_per_thread = 4;
+
+/*
+ * @brief Split of [0 ; n) into chunks.
+ *
+ * Every boundary but the first and last ones falls on a cache line
+ * of data, when data is aligned on its element type: no two threads
+ * write to the same line, and each chunk is a whole number of
+ * registers. The first chunk also holds the head elements before
+ * the first line boundary.
+ */
+struct chunking
+{
+	std::size_t n     = 0;
+	std::size_t head  = 0;
+	std::size_t size  = 0;
+	std::size_t count = 0;
+
+	std::size_t begin(std::size_t k) const noexcept { return k == 0 ? 0 : std::min(n, head + k * size); }
+	std::size_t end  (std::size_t k) const noexcept { return begin(k + 1); }
+};
+
+template <SIMDLevel level, typename T>
+chunking chunksOf(const T* data, std::size_t n, std::size_t threads) noexcept
+{
+	// Cache lines hold a whole number of registers on every backend.
+	// 16-bit storage (half, bfloat16) is processed in float registers.
+	using lane = std::conditional_t<sizeof(T) == 2, float, T>;
+	constexpr std::size_t line = std::max(cache_line / sizeof(T), ComputeBackend<lane, level>::width());
+
+	chunking c;
+	c.n = n;
+	if (n == 0)
+		return c;
+
+	const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(data);
+	if (address % sizeof(T) == 0)
+		c.head = std::min(n, (cache_line - address % cache_line) % cache_line / sizeof(T));
+
+	const std::size_t target = (n + threads * chunks_per_thread - 1) / (threads * chunks_per_thread);
+	c.size  = (std::max(target, parallel_grain) + line - 1) / line * line;
+	c.count = n > c.head ? (n - c.head + c.size - 1) / c.size : 1;
+	return c;
+}
+
+// Partial result alone on its cache line, written by one thread
+template <typename R>
+struct alignas(cache_line) padded
+{
+	R value;
+};
+
+}
+
+/*
+ * @brief Runs f(begin, end) over chunks covering [0 ; n).
+ *
+ * data is the array being processed, only used to align the chunks
+ * on its cache lines (see detail::chunking): chunks are at least
+ * detail::parallel_grain elements long, and about four per thread.
+ * f is called concurrently and must not throw. Ranges shorter than
+ * two chunks run on the calling thread.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T, typename F>
+void parallel_for(const T* data, std::size_t n, F f, thread_pool& pool = thread_pool::global())
+{
+	const detail::chunking c = detail::chunksOf<level>(data, n, pool.size());
+
+	if (c.count <= 1)
+	{
+		if (n != 0)
+			f(std::size_t(0), n);
+		return;
+	}
+
+	pool.run(c.count, [&](std::size_t k) { f(c.begin(k), c.end(k)); });
+}
+
+/*
+ * @brief Reduces [0 ; n) by chunks, as combine(identity, map(b, e)...).
+ *
+ * map(begin, end) reduces one chunk and returns an R, then partial
+ * results are combined in the order of the chunks, on the calling
+ * thread. combine must be associative. For a given pool size the
+ * chunks are always the same, and so are the results.
+ */
+template <SIMDLevel level = compiletimeSIMDLevel(), typename T, typename R, typename Map, typename Combine>
+R parallel_reduce(const T* data, std::size_t n, R identity, Map map, Combine combine, thread_pool& pool = thread_pool::global())
+{
+	const detail::chunking c = detail::chunksOf<level>(data, n, pool.size());
+
+	if (c.count <= 1)
+		return n != 0 ? combine(identity, map(std::size_t(0), n)) : identity;
+
+	std::vector<detail::padded<R>> partial(c.count, detail::padded<R>{ identity });
+	pool.run(c.count, [&](std::size_t k) { partial[k].value = map(c.begin(k), c.end(k)); });
+
+	R result = identity;
+	for (const detail::padded<R>& p : partial)
+		result = combine(result, p.value);
+	return result;
+}
+
+}
@@ -0,0 +1,216 @@
+#pragma once
+
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace vectra
+{
+
+/*
+ * @brief Work-stealing pool of worker threads.
+ *
+ * run(tasks, f) calls f(0), ..., f(tasks - 1) on the workers and on
+ * the calling thread, and returns once every call is done. Tasks are
+ * dealt in contiguous blocks, one block per thread queue, so that
+ * each thread first walks through neighbouring data. A thread whose
+ * queue is empty steals from the back of the other queues, which
+ * balances uneven tasks and threads descheduled by the OS.
+ *
+ * The calling thread runs tasks while waiting, so run() may be called
+ * from a task (nested loops) without deadlocking. f must not throw.
+ */
+class thread_pool
+{
+public:
+	// threads counts the calling thread, threads - 1 workers are started
+	explicit thread_pool(std::size_t threads = std::thread::hardware_concurrency())
+	{
+		threads = std::max<std::size_t>(threads, 1);
+
+		for (std::size_t k = 0; k < threads; ++k)
+			queues_.push_back(std::make_unique<queue>());
+
+		workers_.reserve(threads - 1);
+		for (std::size_t k = 1; k < threads; ++k)
+			workers_.emplace_back([this, k] { work(k); });
+	}
+
+	~thread_pool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(sleep_);
+			stop_ = true;
+		}
+		wake_.notify_all();
+
+		for (std::thread& worker : workers_)
+			worker.join();
+	}
+
+	thread_pool(const thread_pool&) = delete;
+	thread_pool& operator=(const thread_pool&) = delete;
+
+	// Number of threads running tasks, the calling one included
+	std::size_t size() const noexcept { return queues_.size(); }
+
+	template <typename F>
+	void run(std::size_t tasks, const F& f)
+	{
+		if (tasks == 0)
+			return;
+
+		if (tasks == 1 || workers_.empty())
+		{
+			for (std::size_t i = 0; i < tasks; ++i)
+				f(i);
+			return;
+		}
+
+		job j{ [](const void* fn, std::size_t i) { (*static_cast<const F*>(fn))(i); }, &f, { tasks } };
+
+		const std::size_t self = index();
+		submit(j, tasks, self);
+
+		while (j.remaining.load(std::memory_order_acquire) != 0)
+		{
+			task t;
+			if (take(self, t))
+				execute(t);
+			else
+				std::this_thread::yield();
+		}
+	}
+
+	// Pool shared by the parallel algorithms, one thread per core
+	static thread_pool& global()
+	{
+		static thread_pool pool;
+		return pool;
+	}
+
+private:
+	// Type-erased loop body, living on the stack of run()
+	struct job
+	{
+		void (*call)(const void*, std::size_t);
+		const void* fn;
+		std::atomic<std::size_t> remaining;
+	};
+
+	struct task
+	{
+		job*        owner = nullptr;
+		std::size_t index = 0;
+	};
+
+	// Own cache line per queue, they are locked by different threads
+	struct alignas(64) queue
+	{
+		std::mutex       mutex;
+		std::deque<task> tasks;
+	};
+
+	// Queue of the current thread: its own one for workers, the first
+	// one for outside threads (shared, hence locked)
+	std::size_t index() const noexcept { return current_pool_ == this ? current_index_ : 0; }
+
+	void submit(job& j, std::size_t tasks, std::size_t self)
+	{
+		const std::size_t q = queues_.size();
+
+		// Counted before being visible, so that it never goes below zero
+		pending_.fetch_add(tasks, std::memory_order_relaxed);
+
+		// Block k goes to the k-th queue from the current thread, which
+		// starts with the first tasks
+		for (std::size_t k = 0; k < q; ++k)
+		{
+			const std::size_t first = k * tasks / q;
+			const std::size_t last  = (k + 1) * tasks / q;
+
+			queue& target = *queues_[(self + k) % q];
+			std::lock_guard<std::mutex> lock(target.mutex);
+			for (std::size_t i = first; i < last; ++i)
+				target.tasks.push_back({ &j, i });
+		}
+
+		// Taking the lock orders the update of pending_ with a worker
+		// about to sleep, which would otherwise miss the notification
+		{
+			std::lock_guard<std::mutex> lock(sleep_);
+		}
+		wake_.notify_all();
+	}
+
+	// Front of the own queue first, then back of the others
+	bool take(std::size_t self, task& t)
+	{
+		const std::size_t q = queues_.size();
+
+		for (std::size_t k = 0; k < q; ++k)
+		{
+			queue& source = *queues_[(self + k) % q];
+			std::lock_guard<std::mutex> lock(source.mutex);
+			if (source.tasks.empty())
+				continue;
+
+			if (k == 0) { t = source.tasks.front(); source.tasks.pop_front(); }
+			else        { t = source.tasks.back();  source.tasks.pop_back();  }
+
+			pending_.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+		return false;
+	}
+
+	// The job must not be used after the last decrement, run() returns
+	static void execute(const task& t)
+	{
+		t.owner->call(t.owner->fn, t.index);
+		t.owner->remaining.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	void work(std::size_t self)
+	{
+		current_pool_  = this;
+		current_index_ = self;
+
+		for (;;)
+		{
+			task t;
+			if (take(self, t))
+			{
+				execute(t);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(sleep_);
+			wake_.wait(lock, [this] { return stop_ || pending_.load(std::memory_order_relaxed) != 0; });
+			if (stop_)
+				return;
+		}
+	}
+
+	std::vector<std::unique_ptr<queue>> queues_;
+	std::vector<std::thread>            workers_;
+
+	std::atomic<std::size_t> pending_{ 0 };
+
+	std::mutex              sleep_;
+	std::condition_variable wake_;
+	bool                    stop_ = false;
+
+	static inline thread_local const thread_pool* current_pool_  = nullptr;
+	static inline thread_local std::size_t        current_index_ = 0;
+};
+
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+
+#include <vectra/algorithm/transform.hpp>
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/simd_level.hpp>
+#include <vectra/expression/expression.hpp>
+#include <vectra/memory/allocator.hpp>
+#include <vectra/types/vectratype.hpp>
+
+
+namespace vectra
+{
+
+/*
+ * @brief Aligned array of T, with lazily evaluated operators.
+ *
+ * Arithmetic between arrays builds an expression (see expression.hpp)
+ * evaluated on assignment, in a single loop over the registers of
+ * the result:
+ *
+ *     vectra::array<float> a(n), b(n), c(n), d(n);
+ *     vectra::array<float> r = a * b + c * d; // One pass over memory
+ *
+ * Storage is allocated with aligned_allocator, so that every full
+ * register is loaded and stored with aligned instructions, and the
+ * main loop is unrolled like transform(). The last elements use a
+ * masked partial register.
+ *
+ * An array may appear in the expression assigned to it, as long as
+ * every element only depends on the same index (always true with the
+ * element-wise operators). level defaults to the highest backend
+ * enabled at compile time.
+ */
+template <typename T, SIMDLevel simdLevel = compiletimeSIMDLevel()>
+class array : public expression<array<T, simdLevel>>
+{
+public:
+	using value_type = T;
+	using vct        = Vectratype<T, simdLevel>;
+	using backend    = typename vct::backend;
+
+	static constexpr SIMDLevel level        = simdLevel;
+	static constexpr bool      is_scalar    = false;
+	static constexpr bool      by_reference = true;
+
+	array() = default;
+	explicit array(std::size_t n, T value = T(0)) : data_(n, value) {}
+	array(std::initializer_list<T> values) : data_(values) {}
+
+	// Evaluates an expression into a new array
+	template <typename E, typename = std::enable_if_t<!std::is_same_v<E, array>>>
+	array(const expression<E>& e) : data_(e.derived().size()) { assign(e.derived()); }
+
+	/*
+	 * @brief Evaluates an expression into this array.
+	 *
+	 * When the sizes differ, the expression is evaluated into a new
+	 * buffer first, since it may still read the current one.
+	 */
+	template <typename E, typename = std::enable_if_t<!std::is_same_v<E, array>>>
+	array& operator=(const expression<E>& e)
+	{
+		if (e.derived().size() != size())
+		{
+			array result(e);
+			data_.swap(result.data_);
+		}
+		else
+		{
+			assign(e.derived());
+		}
+		return *this;
+	}
+
+	template <typename E> array& operator+=(const expression<E>& e) { return *this = *this + e; }
+	template <typename E> array& operator-=(const expression<E>& e) { return *this = *this - e; }
+	template <typename E> array& operator*=(const expression<E>& e) { return *this = *this * e; }
+	template <typename E> array& operator/=(const expression<E>& e) { return *this = *this / e; }
+
+	array& operator+=(T s) { return *this = *this + s; }
+	array& operator-=(T s) { return *this = *this - s; }
+	array& operator*=(T s) { return *this = *this * s; }
+	array& operator/=(T s) { return *this = *this / s; }
+
+	FORCE_INLINE std::size_t size() const noexcept { return data_.size(); }
+	FORCE_INLINE bool empty() const noexcept { return data_.empty(); }
+
+	FORCE_INLINE       T* data()       noexcept { return data_.data(); }
+	FORCE_INLINE const T* data() const noexcept { return data_.data(); }
+
+	FORCE_INLINE       T& operator[](std::size_t i)       noexcept { return data_[i]; }
+	FORCE_INLINE const T& operator[](std::size_t i) const noexcept { return data_[i]; }
+
+	FORCE_INLINE       T* begin()       noexcept { return data(); }
+	FORCE_INLINE const T* begin() const noexcept { return data(); }
+	FORCE_INLINE       T* end  ()       noexcept { return data() + size(); }
+	FORCE_INLINE const T* end  () const noexcept { return data() + size(); }
+
+	// Expression leaf interface. i is a multiple of the register
+	// width, and buffers are 64 bytes aligned: loads are aligned.
+	FORCE_INLINE vct evaluate        (std::size_t i)                const noexcept { return vct(backend::loada(data() + i)); }
+	FORCE_INLINE vct evaluate_partial(std::size_t i, std::size_t n) const noexcept { return vct(backend::loadu_partial(data() + i, n)); }
+
+	FORCE_INLINE bool reads(const void* p) const noexcept { return static_cast<const void*>(data()) == p; }
+
+private:
+	// Same loop structure as transform(): unrolled full registers,
+	// then one at a time, then a masked partial register. Outputs
+	// above detail::stream_threshold bytes are streamed, unless the
+	// expression reads them (a *= 2), as in detail::streamOutput().
+	template <typename E>
+	void assign(const E& e) noexcept
+	{
+		if (size() * sizeof(T) >= detail::stream_threshold && !e.reads(data()))
+		{
+			assignBody<true>(e);
+			backend::sfence();
+		}
+		else
+			assignBody<false>(e);
+	}
+
+	template <bool streaming, typename E>
+	FORCE_INLINE void assignBody(const E& e) noexcept
+	{
+		constexpr std::size_t w = backend::width();
+		constexpr std::size_t u = detail::transform_unroll;
+
+		T* out = data();
+		const std::size_t n = size();
+
+		std::size_t i = 0;
+		for (; i + u * w <= n; i += u * w)
+		{
+			vct r0 = e.evaluate(i        );
+			vct r1 = e.evaluate(i +     w);
+			vct r2 = e.evaluate(i + 2 * w);
+			vct r3 = e.evaluate(i + 3 * w);
+
+			detail::store<true, streaming, backend>(out + i        , r0.value);
+			detail::store<true, streaming, backend>(out + i +     w, r1.value);
+			detail::store<true, streaming, backend>(out + i + 2 * w, r2.value);
+			detail::store<true, streaming, backend>(out + i + 3 * w, r3.value);
+		}
+
+		for (; i + w <= n; i += w)
+			detail::store<true, streaming, backend>(out + i, e.evaluate(i).value);
+
+		if (i < n)
+			backend::unloadu_partial(out + i, e.evaluate_partial(i, n - i).value, n - i);
+	}
+
+	std::vector<T, aligned_allocator<T>> data_;
+};
+
+}
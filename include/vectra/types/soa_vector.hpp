@@ -0,0 +1,222 @@
+#pragma once
+
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/simd_level.hpp>
+#include <vectra/memory/allocator.hpp>
+#include <vectra/types/vectratype.hpp>
+
+
+namespace vectra
+{
+
+/*
+ * @brief Structure-of-arrays container of records made of Fields.
+ *
+ * Each field is stored in its own column, allocated with
+ * aligned_allocator, so that a register of consecutive records is
+ * loaded from a column with a single aligned load. For instance
+ * 3D points are stored as soa_vector<float, float, float>, i.e.
+ * x0 x1 x2 ... | y0 y1 y2 ... | z0 z1 z2 ...
+ *
+ * Columns are always padded to a multiple of the register width,
+ * so that iterating over blocks() only yields full registers, with
+ * no remainder to handle. The padding is zero-initialized when the
+ * columns grow, but stores through blocks may overwrite it: it is
+ * never part of size(), and new records are always zeroed.
+ *
+ * Fields must share the same register width at the chosen level
+ * (e.g. only float, or only double), so that a block holds the same
+ * records in every column.
+ */
+template <SIMDLevel level, typename... Fields>
+class basic_soa_vector
+{
+	static_assert(sizeof...(Fields) > 0, "At least one field is required.");
+	static_assert(((Vectratype<Fields, level>::width() == Vectratype<std::tuple_element_t<0, std::tuple<Fields...>>, level>::width()) && ...),
+		"Every field must have the same register width.");
+
+public:
+	template <std::size_t K> using field_type = std::tuple_element_t<K, std::tuple<Fields...>>;
+	template <std::size_t K> using vct        = Vectratype<field_type<K>, level>;
+
+	static constexpr std::size_t fields = sizeof...(Fields);
+
+	// Number of records per register, in every column
+	FORCE_INLINE static constexpr std::size_t width() noexcept { return vct<0>::width(); }
+
+	/*
+	 * @brief One register-wide block of records, seen in every column.
+	 *
+	 * Loads and stores are aligned. count() is the number of records
+	 * of the block, below width() for the last block only.
+	 */
+	template <bool constant>
+	class block
+	{
+		using owner = std::conditional_t<constant, const basic_soa_vector, basic_soa_vector>;
+
+	public:
+		FORCE_INLINE block(owner& v, std::size_t index) noexcept : v_(&v), index_(index) {}
+
+		// Index of the first record of the block
+		FORCE_INLINE std::size_t index() const noexcept { return index_; }
+		FORCE_INLINE std::size_t count() const noexcept { return v_->size() - index_ < width() ? v_->size() - index_ : width(); }
+
+		template <std::size_t K>
+		FORCE_INLINE vct<K> load() const noexcept { return vct<K>::loada(v_->template data<K>() + index_); }
+
+		template <std::size_t K, bool c = constant, typename = std::enable_if_t<!c>>
+		FORCE_INLINE void store(vct<K> x) const noexcept { vct<K>::backend::unloada(v_->template data<K>() + index_, x.value); }
+
+	private:
+		owner*      v_;
+		std::size_t index_;
+	};
+
+	// Random access iterator over the blocks, yielding them by value
+	template <bool constant>
+	class block_iterator
+	{
+		using owner = std::conditional_t<constant, const basic_soa_vector, basic_soa_vector>;
+
+	public:
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type        = block<constant>;
+		using difference_type   = std::ptrdiff_t;
+		using pointer           = void;
+		using reference         = block<constant>;
+
+		FORCE_INLINE block_iterator(owner& v, std::size_t index) noexcept : v_(&v), index_(index) {}
+
+		FORCE_INLINE reference operator* () const noexcept { return block<constant>(*v_, index_); }
+		FORCE_INLINE reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+		FORCE_INLINE block_iterator& operator++() noexcept { index_ += width(); return *this; }
+		FORCE_INLINE block_iterator& operator--() noexcept { index_ -= width(); return *this; }
+		FORCE_INLINE block_iterator  operator++(int) noexcept { block_iterator it = *this; ++*this; return it; }
+		FORCE_INLINE block_iterator  operator--(int) noexcept { block_iterator it = *this; --*this; return it; }
+
+		FORCE_INLINE block_iterator& operator+=(difference_type n) noexcept { index_ += n * width(); return *this; }
+		FORCE_INLINE block_iterator& operator-=(difference_type n) noexcept { index_ -= n * width(); return *this; }
+
+		FORCE_INLINE friend block_iterator  operator+(block_iterator it, difference_type n) noexcept { return it += n; }
+		FORCE_INLINE friend block_iterator  operator-(block_iterator it, difference_type n) noexcept { return it -= n; }
+		FORCE_INLINE friend difference_type operator-(block_iterator a, block_iterator b) noexcept
+		{
+			return (static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_)) / static_cast<difference_type>(width());
+		}
+
+		FORCE_INLINE friend bool operator==(block_iterator a, block_iterator b) noexcept { return a.index_ == b.index_; }
+		FORCE_INLINE friend bool operator!=(block_iterator a, block_iterator b) noexcept { return a.index_ != b.index_; }
+		FORCE_INLINE friend bool operator< (block_iterator a, block_iterator b) noexcept { return a.index_ <  b.index_; }
+
+	private:
+		owner*      v_;
+		std::size_t index_;
+	};
+
+	template <typename Iterator>
+	struct block_range
+	{
+		Iterator first;
+		Iterator last;
+
+		FORCE_INLINE Iterator begin() const noexcept { return first; }
+		FORCE_INLINE Iterator end  () const noexcept { return last; }
+	};
+
+	basic_soa_vector() = default;
+	explicit basic_soa_vector(std::size_t n) { resize(n); }
+
+	FORCE_INLINE std::size_t size()     const noexcept { return size_; }
+	FORCE_INLINE bool        empty()    const noexcept { return size_ == 0; }
+	FORCE_INLINE std::size_t capacity() const noexcept { return std::get<0>(columns_).capacity(); }
+
+	// Size of every column, padding included
+	FORCE_INLINE std::size_t padded_size() const noexcept { return std::get<0>(columns_).size(); }
+
+	// Column of field K, padded_size() elements long
+	template <std::size_t K> FORCE_INLINE       field_type<K>* data()       noexcept { return std::get<K>(columns_).data(); }
+	template <std::size_t K> FORCE_INLINE const field_type<K>* data() const noexcept { return std::get<K>(columns_).data(); }
+
+	// Field K of record i
+	template <std::size_t K> FORCE_INLINE       field_type<K>& get(std::size_t i)       noexcept { return std::get<K>(columns_)[i]; }
+	template <std::size_t K> FORCE_INLINE const field_type<K>& get(std::size_t i) const noexcept { return std::get<K>(columns_)[i]; }
+
+	// Record i, as a tuple of references to its fields
+	FORCE_INLINE std::tuple<Fields&...>       operator[](std::size_t i)       noexcept { return record(i, std::index_sequence_for<Fields...>{}); }
+	FORCE_INLINE std::tuple<const Fields&...> operator[](std::size_t i) const noexcept { return record(i, std::index_sequence_for<Fields...>{}); }
+
+	FORCE_INLINE block_range<block_iterator<false>> blocks() noexcept { return { block_iterator<false>(*this, 0), block_iterator<false>(*this, padded_size()) }; }
+	FORCE_INLINE block_range<block_iterator<true >> blocks() const noexcept { return { block_iterator<true>(*this, 0), block_iterator<true>(*this, padded_size()) }; }
+
+	void reserve(std::size_t n)
+	{
+		std::apply([&](auto&... column) { (column.reserve(padded(n)), ...); }, columns_);
+	}
+
+	// Resizes every column to n records, new ones being zeroed. Those
+	// reusing the padding are cleared, the others are value-initialized.
+	void resize(std::size_t n)
+	{
+		std::apply([&](auto&... column)
+		{
+			(clearRange(column, size_, n), ...);
+			(column.resize(padded(n)), ...);
+		}, columns_);
+		size_ = n;
+	}
+
+	void clear() { resize(0); }
+
+	void push_back(const Fields&... values)
+	{
+		if (size_ == padded_size())
+			std::apply([&](auto&... column) { (column.resize(size_ + width()), ...); }, columns_);
+
+		assign(size_, std::index_sequence_for<Fields...>{}, values...);
+		++size_;
+	}
+
+	void pop_back() noexcept { --size_; }
+
+private:
+	FORCE_INLINE static std::size_t padded(std::size_t n) noexcept { return (n + width() - 1) / width() * width(); }
+
+	// Zeroes the existing elements of [first ; last[ in a column
+	template <typename Column>
+	static void clearRange(Column& column, std::size_t first, std::size_t last) noexcept
+	{
+		for (std::size_t i = first; i < last && i < column.size(); ++i)
+			column[i] = typename Column::value_type(0);
+	}
+
+	template <std::size_t... K>
+	FORCE_INLINE void assign(std::size_t i, std::index_sequence<K...>, const Fields&... values) noexcept
+	{
+		((std::get<K>(columns_)[i] = values), ...);
+	}
+
+	template <std::size_t... K>
+	FORCE_INLINE std::tuple<Fields&...> record(std::size_t i, std::index_sequence<K...>) noexcept { return { std::get<K>(columns_)[i]... }; }
+
+	template <std::size_t... K>
+	FORCE_INLINE std::tuple<const Fields&...> record(std::size_t i, std::index_sequence<K...>) const noexcept { return { std::get<K>(columns_)[i]... }; }
+
+	std::tuple<std::vector<Fields, aligned_allocator<Fields>>...> columns_;
+	std::size_t size_ = 0;
+};
+
+// Structure-of-arrays container at the default, compile-time level
+template <typename... Fields>
+using soa_vector = basic_soa_vector<compiletimeSIMDLevel(), Fields...>;
+
+}
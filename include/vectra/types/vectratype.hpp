@@ -1,19 +1,56 @@
 #pragma once
 
 
+#include <cstdint>
+#include <type_traits>
+
 #include <vectra/backend/compute_backend.hpp>
 #include <vectra/core/attributes.hpp>
+#include <vectra/core/half.hpp>
 #include <vectra/core/simd_level.hpp>
+#include <vectra/math/accuracy.hpp>
 
 
 namespace vectra
 {
 
+/*
+ * @brief Lane-wise boolean, result of the Vectratype comparisons.
+ *
+ * The representation is backend-specific: a bool for scalar data,
+ * a register with all bits set in true lanes for SSE and AVX, and
+ * a bit mask for AVX-512. It should only be combined with the
+ * operators below, and consumed by select() or the reductions.
+ */
+template <typename T, SIMDLevel level>
+struct Vectramask
+{
+	using backend = ComputeBackend<T, level>;
+	using type    = typename backend::mask;
+
+	type value;
+
+	FORCE_INLINE Vectramask() = default;
+	FORCE_INLINE explicit Vectramask(type m) noexcept : value(m) {}
+
+	FORCE_INLINE friend Vectramask operator&(Vectramask a, Vectramask b) noexcept { return Vectramask(backend::mask_and(a.value, b.value)); }
+	FORCE_INLINE friend Vectramask operator|(Vectramask a, Vectramask b) noexcept { return Vectramask(backend::mask_or (a.value, b.value)); }
+	FORCE_INLINE Vectramask operator!() const noexcept { return Vectramask(backend::mask_not(value)); }
+
+	// True if at least one lane, or every lane, is set
+	FORCE_INLINE bool any() const noexcept { return backend::any(value); }
+	FORCE_INLINE bool all() const noexcept { return backend::all(value); }
+
+	// Bit i is set when lane i is true, e.g. to count or locate lanes
+	FORCE_INLINE unsigned movemask() const noexcept { return backend::movemask(value); }
+};
+
 template <typename T, SIMDLevel level>
 struct alignas(ComputeBackend<T, level>::alignment()) Vectratype
 {
 	using backend = ComputeBackend<T, level>;
 	using type    = typename backend::type;
+	using mask    = Vectramask<T, level>;
 
 	type value;
 
@@ -68,6 +105,17 @@ struct alignas(ComputeBackend<T, level>::alignment()) Vectratype
 	// Scalar constructor
 	FORCE_INLINE explicit Vectratype(T scalar) noexcept : value(backend::set(scalar)) {}
 
+	// Load-and-widen constructors from 16-bit storage (see half.hpp),
+	// reading width() values: kernels compute in float on data stored
+	// at half the size. Float only.
+	template<typename U = T,
+		     typename = std::enable_if_t<std::is_same_v<U, float>>>
+	FORCE_INLINE explicit Vectratype(const half* ptr) noexcept : value(backend::loadu(ptr)) {}
+
+	template<typename U = T,
+		     typename = std::enable_if_t<std::is_same_v<U, float>>>
+	FORCE_INLINE explicit Vectratype(const bfloat16* ptr) noexcept : value(backend::loadu(ptr)) {}
+
 	FORCE_INLINE friend Vectratype operator+(Vectratype a, Vectratype b) noexcept { return Vectratype(backend::add(a.value, b.value)); }
 	FORCE_INLINE friend Vectratype operator-(Vectratype a, Vectratype b) noexcept { return Vectratype(backend::sub(a.value, b.value)); }
 	FORCE_INLINE friend Vectratype operator*(Vectratype a, Vectratype b) noexcept { return Vectratype(backend::mul(a.value, b.value)); }
@@ -75,16 +123,91 @@ struct alignas(ComputeBackend<T, level>::alignment()) Vectratype
 
     FORCE_INLINE Vectratype operator-() const noexcept { return Vectratype(backend::sub(backend::zero(), value)); }
 
+    // Lane-wise comparisons. Ordered, i.e. false when a lane is NaN,
+    // except != which is true for NaN like the scalar operator.
+    FORCE_INLINE friend mask operator==(Vectratype a, Vectratype b) noexcept { return mask(backend::cmpeq (a.value, b.value)); }
+    FORCE_INLINE friend mask operator!=(Vectratype a, Vectratype b) noexcept { return mask(backend::cmpneq(a.value, b.value)); }
+    FORCE_INLINE friend mask operator< (Vectratype a, Vectratype b) noexcept { return mask(backend::cmplt (a.value, b.value)); }
+    FORCE_INLINE friend mask operator<=(Vectratype a, Vectratype b) noexcept { return mask(backend::cmple (a.value, b.value)); }
+    FORCE_INLINE friend mask operator> (Vectratype a, Vectratype b) noexcept { return mask(backend::cmpgt (a.value, b.value)); }
+    FORCE_INLINE friend mask operator>=(Vectratype a, Vectratype b) noexcept { return mask(backend::cmpge (a.value, b.value)); }
+
+    // Branch-free conditional, lane-wise m ? a : b
+    FORCE_INLINE static Vectratype select(mask m, Vectratype a, Vectratype b) noexcept { return Vectratype(backend::select(m.value, a.value, b.value)); }
+
     FORCE_INLINE static Vectratype sin (Vectratype x) noexcept { return Vectratype(backend::sin (x.value)); }
     FORCE_INLINE static Vectratype cos (Vectratype x) noexcept { return Vectratype(backend::cos (x.value)); }
+    FORCE_INLINE static Vectratype asin(Vectratype x) noexcept { return Vectratype(backend::asin(x.value)); }
     FORCE_INLINE static Vectratype acos(Vectratype x) noexcept { return Vectratype(backend::acos(x.value)); }
+    FORCE_INLINE static Vectratype atan(Vectratype x) noexcept { return Vectratype(backend::atan(x.value)); }
+    FORCE_INLINE static Vectratype atan2(Vectratype y, Vectratype x) noexcept { return Vectratype(backend::atan2(y.value, x.value)); }
     FORCE_INLINE static Vectratype sqrt(Vectratype x) noexcept { return Vectratype(backend::sqrt(x.value)); }
-    FORCE_INLINE static Vectratype exp (Vectratype x) noexcept { return Vectratype(backend::exp (x.value)); }
+
+    // Estimates of 1/x and 1/sqrt(x) (about 12 bits), and estimates
+    // refined by Newton steps (a few ULP), far cheaper than a division
+    // or a square root. Valid over the whole range, subnormals, zeros
+    // and infinities included. Exact on the scalar backend.
+    FORCE_INLINE static Vectratype rcp  (Vectratype x) noexcept { return Vectratype(backend::rcp  (x.value)); }
+    FORCE_INLINE static Vectratype rsqrt(Vectratype x) noexcept { return Vectratype(backend::rsqrt(x.value)); }
+    FORCE_INLINE static Vectratype rcp_refined  (Vectratype x) noexcept { return Vectratype(backend::rcp_refined  (x.value)); }
+    FORCE_INLINE static Vectratype rsqrt_refined(Vectratype x) noexcept { return Vectratype(backend::rsqrt_refined(x.value)); }
+    FORCE_INLINE static Vectratype cbrt(Vectratype x) noexcept { return Vectratype(backend::cbrt(x.value)); }
+
+    FORCE_INLINE static Vectratype exp  (Vectratype x) noexcept { return Vectratype(backend::exp  (x.value)); }
+    FORCE_INLINE static Vectratype exp2 (Vectratype x) noexcept { return Vectratype(backend::exp2 (x.value)); }
+    FORCE_INLINE static Vectratype expm1(Vectratype x) noexcept { return Vectratype(backend::expm1(x.value)); }
+    FORCE_INLINE static Vectratype log  (Vectratype x) noexcept { return Vectratype(backend::log  (x.value)); }
+    FORCE_INLINE static Vectratype log2 (Vectratype x) noexcept { return Vectratype(backend::log2 (x.value)); }
+    FORCE_INLINE static Vectratype log1p(Vectratype x) noexcept { return Vectratype(backend::log1p(x.value)); }
+    FORCE_INLINE static Vectratype pow  (Vectratype a, Vectratype b) noexcept { return Vectratype(backend::pow(a.value, b.value)); }
+
+    // Same functions with an accuracy policy, e.g. exp<accuracy::fast>(x),
+    // see vectra/math/accuracy.hpp for the error bounds of each policy
+    template <typename Policy> FORCE_INLINE static Vectratype sin (Vectratype x) noexcept { return Vectratype(Policy::template sin <T, backend>(x.value)); }
+    template <typename Policy> FORCE_INLINE static Vectratype cos (Vectratype x) noexcept { return Vectratype(Policy::template cos <T, backend>(x.value)); }
+    template <typename Policy> FORCE_INLINE static Vectratype exp (Vectratype x) noexcept { return Vectratype(Policy::template exp <T, backend>(x.value)); }
+    template <typename Policy> FORCE_INLINE static Vectratype exp2(Vectratype x) noexcept { return Vectratype(Policy::template exp2<T, backend>(x.value)); }
+    template <typename Policy> FORCE_INLINE static Vectratype log (Vectratype x) noexcept { return Vectratype(Policy::template log <T, backend>(x.value)); }
+    template <typename Policy> FORCE_INLINE static Vectratype log2(Vectratype x) noexcept { return Vectratype(Policy::template log2<T, backend>(x.value)); }
+    template <typename Policy> FORCE_INLINE static Vectratype rcp  (Vectratype x) noexcept { return Vectratype(Policy::template rcp  <T, backend>(x.value)); }
+    template <typename Policy> FORCE_INLINE static Vectratype rsqrt(Vectratype x) noexcept { return Vectratype(Policy::template rsqrt<T, backend>(x.value)); }
+
+    // Returns a * b + c. It is fused, i.e. rounded only once, when
+    // backend::has_fma() is true (AVX2 and later), and is computed
+    // as a product followed by a sum on the other backends.
+    FORCE_INLINE static Vectratype fma(Vectratype a, Vectratype b, Vectratype c) noexcept { return Vectratype(backend::fma(a.value, b.value, c.value)); }
     
 	FORCE_INLINE static Vectratype abs(Vectratype x)               noexcept { return Vectratype(backend::abs(x.value)); }
     FORCE_INLINE static Vectratype min(Vectratype a, Vectratype b) noexcept { return Vectratype(backend::min(a.value, b.value)); }
 	FORCE_INLINE static Vectratype max(Vectratype a, Vectratype b) noexcept { return Vectratype(backend::max(a.value, b.value)); }
 
+    // Clamps x to [lo ; hi]. NaN lanes of x are returned as lo, max()
+    // returning its second operand when the first one is NaN.
+    FORCE_INLINE static Vectratype clamp(Vectratype x, Vectratype lo, Vectratype hi) noexcept { return min(max(x, lo), hi); }
+
+    // Bitwise operators, on the IEEE-754 representation of floating-
+    // point lanes. ~, shifts and the conversions are for int32_t and
+    // int64_t lanes only: arithmetic wraps around, shift counts are in
+    // [0 ; bits[ and >> is arithmetic.
+    FORCE_INLINE friend Vectratype operator&(Vectratype a, Vectratype b) noexcept { return Vectratype(backend::bit_and(a.value, b.value)); }
+    FORCE_INLINE friend Vectratype operator|(Vectratype a, Vectratype b) noexcept { return Vectratype(backend::bit_or (a.value, b.value)); }
+    FORCE_INLINE friend Vectratype operator^(Vectratype a, Vectratype b) noexcept { return Vectratype(backend::bit_xor(a.value, b.value)); }
+    FORCE_INLINE Vectratype operator~() const noexcept { return Vectratype(backend::bit_not(value)); }
+
+    FORCE_INLINE friend Vectratype operator<<(Vectratype x, int n) noexcept { return Vectratype(backend::shl(x.value, n)); }
+    FORCE_INLINE friend Vectratype operator>>(Vectratype x, int n) noexcept { return Vectratype(backend::shr(x.value, n)); }
+    FORCE_INLINE static Vectratype shr_logical(Vectratype x, int n) noexcept { return Vectratype(backend::shr_logical(x.value, n)); }
+
+    // Floating-point lanes of the same width: float for int32_t, double
+    // for int64_t. from_float() rounds to nearest even, from_float_trunc()
+    // toward zero like static_cast, for arguments in the integer range
+    // (and below 2^51 in magnitude for int64_t before AVX-512).
+    using floating = Vectratype<std::conditional_t<sizeof(T) == 4, float, double>, level>;
+
+    FORCE_INLINE static Vectratype from_float      (floating x) noexcept { return Vectratype(backend::from_float      (x.value)); }
+    FORCE_INLINE static Vectratype from_float_trunc(floating x) noexcept { return Vectratype(backend::from_float_trunc(x.value)); }
+    FORCE_INLINE floating to_float() const noexcept { return floating(backend::to_float(value)); }
+
     FORCE_INLINE static constexpr Vectratype one    () noexcept { return Vectratype(backend::one    ()); }
     FORCE_INLINE static constexpr Vectratype zero   () noexcept { return Vectratype(backend::zero   ()); }
     FORCE_INLINE static constexpr Vectratype half_pi() noexcept { return Vectratype(backend::half_pi()); }
@@ -106,11 +229,31 @@ struct alignas(ComputeBackend<T, level>::alignment()) Vectratype
     // data, added here for complete compatibility.
     FORCE_INLINE static Vectratype loadu(const T* ptr) noexcept { return Vectratype(backend::loadu(ptr)); }
     FORCE_INLINE static Vectratype loada(const T* ptr) noexcept { return Vectratype(backend::loada(ptr)); }
+
+    // Indexed accesses, for table lookups, sparse updates and
+    // permutations: lane i is base[idx[i]], with signed indices of the
+    // width of T (int32_t for float, int64_t for double). Masked-off
+    // lanes keep src and are never read, nor written by scatters; when
+    // indices repeat, the highest lane is written last.
+    using index = Vectratype<std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>, level>;
+
+    FORCE_INLINE static Vectratype gather(const T* base, index idx) noexcept { return Vectratype(backend::gather(base, idx.value)); }
+    FORCE_INLINE static Vectratype mask_gather(Vectratype src, mask m, const T* base, index idx) noexcept { return Vectratype(backend::mask_gather(src.value, m.value, base, idx.value)); }
+    FORCE_INLINE void scatter(T* base, index idx) const noexcept { backend::scatter(base, idx.value, value); }
+    FORCE_INLINE void mask_scatter(T* base, mask m, index idx) const noexcept { backend::mask_scatter(base, m.value, idx.value, value); }
+
+    // Narrows to 16-bit storage, rounding to nearest even. Float only.
+    template<typename U = T, typename = std::enable_if_t<std::is_same_v<U, float>>>
+    FORCE_INLINE void unloadu(half* ptr) const noexcept { backend::unloadu(ptr, value); }
+    template<typename U = T, typename = std::enable_if_t<std::is_same_v<U, float>>>
+    FORCE_INLINE void unloadu(bfloat16* ptr) const noexcept { backend::unloadu(ptr, value); }
 };
 
 // Compilation checks for alignment safety
 static_assert(alignof(Vectratype<float, SIMDLevel::None >) >= ComputeBackend<float, SIMDLevel::None >::alignment());
 static_assert(alignof(Vectratype<float, SIMDLevel::SSE41>) >= ComputeBackend<float, SIMDLevel::SSE41>::alignment());
 static_assert(alignof(Vectratype<float, SIMDLevel::AVX  >) >= ComputeBackend<float, SIMDLevel::AVX  >::alignment());
+static_assert(alignof(Vectratype<float, SIMDLevel::AVX2 >) >= ComputeBackend<float, SIMDLevel::AVX2 >::alignment());
+static_assert(alignof(Vectratype<float, SIMDLevel::AVX512>) >= ComputeBackend<float, SIMDLevel::AVX512>::alignment());
 
 }
\ No newline at end of file
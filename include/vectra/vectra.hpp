@@ -7,10 +7,46 @@
 // Aligned memory allocator header.
 #include <vectra/memory/allocator.hpp>
 
+// Arena and pool allocators, and per-thread scratch
+// memory released in bulk, for short-lived buffers.
+#include <vectra/memory/arena.hpp>
+#include <vectra/memory/pool.hpp>
+
+// Allocator of multi-megabyte buffers, on huge pages
+// and with NUMA placement where the system has them.
+#include <vectra/memory/large_allocator.hpp>
+
+// Half-precision and bfloat16 storage types, widened
+// to float by the backends and by convert().
+#include <vectra/core/half.hpp>
+
 // Vectratype header. This is the main 
 // type of the library, easier to use.
 #include <vectra/types/vectratype.hpp>
 
+// Aligned array type, whose operators build lazily
+// evaluated expressions fused in a single loop.
+#include <vectra/types/array.hpp>
+
+// Structure-of-arrays container, with register-wide
+// aligned blocks of records in every column.
+#include <vectra/types/soa_vector.hpp>
+
+// Array algorithms, running Vectratype operations
+// over whole buffers with vectorized remainders.
+#include <vectra/algorithm/convert.hpp>
+#include <vectra/algorithm/gather.hpp>
+#include <vectra/algorithm/geodesic.hpp>
+#include <vectra/algorithm/geometry.hpp>
+#include <vectra/algorithm/interleave.hpp>
+#include <vectra/algorithm/reduce.hpp>
+#include <vectra/algorithm/transform.hpp>
+
+// Work-stealing thread pool, and the parallel loops
+// behind the execution::parallel algorithms.
+#include <vectra/parallel/parallel_for.hpp>
+#include <vectra/parallel/thread_pool.hpp>
+
 // Runtime checks header. There is no need to
 // include cpuid.hpp or any other header that
 // is inside the detail namespace.
@@ -0,0 +1,50 @@
+#include <cstdlib>
+
+#include <vectra/dispatch/kernels.hpp>
+#include <vectra/dispatch/runtime_checks.hpp>
+
+#include "kernel_tables.hpp"
+
+
+namespace vectra::kernels
+{
+
+SIMDLevel activeLevel() noexcept
+{
+	static const SIMDLevel level = []
+	{
+		const SIMDLevel highest   = highestRuntimeSIMDLevel();
+		const SIMDLevel requested = fromString(std::getenv("VECTRA_SIMD_LEVEL"), highest);
+		return requested < highest ? requested : highest;
+	}();
+	return level;
+}
+
+template <typename T>
+const kernel_table<T>& table(SIMDLevel level) noexcept
+{
+	// Translation units for x86 levels are only built on x86 targets
+	#if defined(VECTRA_KERNELS_X86)
+		if (level >= SIMDLevel::AVX512) return detail::levelTable<T, SIMDLevel::AVX512>();
+		if (level >= SIMDLevel::AVX2)   return detail::levelTable<T, SIMDLevel::AVX2>();
+		if (level >= SIMDLevel::AVX)    return detail::levelTable<T, SIMDLevel::AVX>();
+		if (level >= SIMDLevel::SSE41)  return detail::levelTable<T, SIMDLevel::SSE41>();
+	#else
+		(void)level;
+	#endif
+	return detail::levelTable<T, SIMDLevel::None>();
+}
+
+template <typename T>
+const kernel_table<T>& table() noexcept
+{
+	static const kernel_table<T>& resolved = table<T>(activeLevel());
+	return resolved;
+}
+
+template const kernel_table<float>&  table<float> (SIMDLevel) noexcept;
+template const kernel_table<double>& table<double>(SIMDLevel) noexcept;
+template const kernel_table<float>&  table<float> () noexcept;
+template const kernel_table<double>& table<double>() noexcept;
+
+}
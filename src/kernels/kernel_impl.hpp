@@ -0,0 +1,92 @@
+#pragma once
+
+
+#include <cstddef>
+
+#include <vectra/backend/compute_backend.hpp>
+#include <vectra/core/attributes.hpp>
+#include <vectra/core/simd_level.hpp>
+
+#include "kernel_tables.hpp"
+
+
+/*
+ * Kernel loops, included once by each kernels_<level>.cpp.
+ *
+ * Every function defined here has internal linkage. Since each
+ * translation unit is built with different -m flags, functions with
+ * external linkage would be merged by the linker, and the copy kept
+ * could use instructions unavailable on the running processor. The
+ * backend primitives themselves are always inlined.
+ */
+namespace vectra::kernels::detail
+{
+
+namespace
+{
+
+template <typename T, SIMDLevel level>
+using register_t = typename ComputeBackend<T, level>::type;
+
+// Full registers first, then a single partial register for the tail
+template <typename T, SIMDLevel level, register_t<T, level> (*op)(register_t<T, level>) noexcept>
+void unary(const T* in, T* out, std::size_t n)
+{
+	using backend = ComputeBackend<T, level>;
+
+	std::size_t i = 0;
+	for (; i + backend::width() <= n; i += backend::width())
+		backend::unloadu(out + i, op(backend::loadu(in + i)));
+
+	if (i < n)
+		backend::unloadu_partial(out + i, op(backend::loadu_partial(in + i, n - i)), n - i);
+}
+
+template <typename T, SIMDLevel level, register_t<T, level> (*op)(register_t<T, level>, register_t<T, level>) noexcept>
+void binary(const T* a, const T* b, T* out, std::size_t n)
+{
+	using backend = ComputeBackend<T, level>;
+
+	std::size_t i = 0;
+	for (; i + backend::width() <= n; i += backend::width())
+		backend::unloadu(out + i, op(backend::loadu(a + i), backend::loadu(b + i)));
+
+	if (i < n)
+		backend::unloadu_partial(out + i, op(backend::loadu_partial(a + i, n - i), backend::loadu_partial(b + i, n - i)), n - i);
+}
+
+template <typename T, SIMDLevel level>
+constexpr kernel_table<T> makeTable() noexcept
+{
+	using backend = ComputeBackend<T, level>;
+
+	return kernel_table<T>{
+		level,
+		&unary<T, level, &backend::sin>,
+		&unary<T, level, &backend::cos>,
+		&unary<T, level, &backend::asin>,
+		&unary<T, level, &backend::acos>,
+		&unary<T, level, &backend::atan>,
+		&unary<T, level, &backend::sqrt>,
+		&unary<T, level, &backend::cbrt>,
+		&unary<T, level, &backend::exp>,
+		&unary<T, level, &backend::exp2>,
+		&unary<T, level, &backend::expm1>,
+		&unary<T, level, &backend::log>,
+		&unary<T, level, &backend::log2>,
+		&unary<T, level, &backend::log1p>,
+		&binary<T, level, &backend::atan2>,
+		&binary<T, level, &backend::pow>
+	};
+}
+
+template <typename T, SIMDLevel level>
+struct tableHolder
+{
+	// Constant-initialized, no guard is needed to read it
+	static constexpr kernel_table<T> value = makeTable<T, level>();
+};
+
+}
+
+}
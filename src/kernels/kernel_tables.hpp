@@ -0,0 +1,17 @@
+#pragma once
+
+
+#include <vectra/core/simd_level.hpp>
+#include <vectra/dispatch/kernels.hpp>
+
+
+namespace vectra::kernels::detail
+{
+
+// Defined in the kernels_<level>.cpp translation unit, compiled with
+// the instruction set flags of that level. Only declared here, so
+// that the dispatcher never sees code built for another target.
+template <typename T, SIMDLevel level>
+const kernel_table<T>& levelTable() noexcept;
+
+}
@@ -0,0 +1,13 @@
+#include "kernel_impl.hpp"
+
+
+namespace vectra::kernels::detail
+{
+
+template <>
+const kernel_table<float>& levelTable<float, SIMDLevel::AVX>() noexcept { return tableHolder<float, SIMDLevel::AVX>::value; }
+
+template <>
+const kernel_table<double>& levelTable<double, SIMDLevel::AVX>() noexcept { return tableHolder<double, SIMDLevel::AVX>::value; }
+
+}
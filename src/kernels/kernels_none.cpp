@@ -0,0 +1,13 @@
+#include "kernel_impl.hpp"
+
+
+namespace vectra::kernels::detail
+{
+
+template <>
+const kernel_table<float>& levelTable<float, SIMDLevel::None>() noexcept { return tableHolder<float, SIMDLevel::None>::value; }
+
+template <>
+const kernel_table<double>& levelTable<double, SIMDLevel::None>() noexcept { return tableHolder<double, SIMDLevel::None>::value; }
+
+}
@@ -0,0 +1,13 @@
+#include "kernel_impl.hpp"
+
+
+namespace vectra::kernels::detail
+{
+
+template <>
+const kernel_table<float>& levelTable<float, SIMDLevel::SSE41>() noexcept { return tableHolder<float, SIMDLevel::SSE41>::value; }
+
+template <>
+const kernel_table<double>& levelTable<double, SIMDLevel::SSE41>() noexcept { return tableHolder<double, SIMDLevel::SSE41>::value; }
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+
+#include <string>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <vectra/core/simd_level.hpp>
+
+
+namespace vectra::test
+{
+
+// A SIMD level as a type, the parameter of the typed tests
+template <SIMDLevel l>
+struct simd_level : std::integral_constant<SIMDLevel, l> {};
+
+namespace detail
+{
+
+template <typename None, typename... Simd>
+struct level_lists
+{
+	using all  = ::testing::Types<None, Simd...>;
+	using simd = ::testing::Types<Simd...>;
+};
+
+// The only place listing the compiler macros that enable each backend
+using enabled_levels = level_lists<
+	simd_level<SIMDLevel::None>
+#if defined(__SSE4_1__)
+	, simd_level<SIMDLevel::SSE41>
+#endif
+#if defined(__AVX__)
+	, simd_level<SIMDLevel::AVX>
+#endif
+#if defined(__AVX2__) && defined(__FMA__)
+	, simd_level<SIMDLevel::AVX2>
+#endif
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+	, simd_level<SIMDLevel::AVX512>
+#endif
+>;
+
+}
+
+/*
+ * @brief Backends enabled at compile time, as typed test parameters.
+ *
+ *     VECTRA_LEVEL_TEST_SUITE(Gather, vectra::test::Levels);
+ *     TYPED_TEST(Gather, Operations) { checkAll<TypeParam::value>(); }
+ *
+ * runs Gather/None.Operations, Gather/SSE41.Operations, and so on.
+ * SIMDLevels leaves the scalar backend out, for kernels it does not
+ * implement (it calls the standard library instead).
+ */
+using Levels     = detail::enabled_levels::all;
+using SIMDLevels = detail::enabled_levels::simd;
+
+// Names the tests after the level rather than its index
+struct LevelNames
+{
+	template <typename Level>
+	static std::string GetName(int) { return toString(Level::value); }
+};
+
+}
+
+#define VECTRA_LEVEL_TEST_SUITE(Suite, levels)           \
+	template <typename Level>                            \
+	class Suite : public ::testing::Test {};             \
+	TYPED_TEST_SUITE(Suite, levels, vectra::test::LevelNames)
@@ -64,4 +64,25 @@ TEST(AlignedAllocator, M128VectorStorage)
     EXPECT_FLOAT_EQ(result[1], 5.f);
     EXPECT_FLOAT_EQ(result[2], 6.f);
     EXPECT_FLOAT_EQ(result[3], 7.f);
-}
\ No newline at end of file
+}
+
+TEST(AlignedAllocator, DefaultsToCacheLineAlignment)
+{
+    std::vector<double, vectra::aligned_allocator<double>> data(3);
+
+    const auto addr = reinterpret_cast<std::uintptr_t>(data.data());
+    EXPECT_EQ(addr % 64, 0u);
+    EXPECT_EQ(vectra::max_simd_alignment, 64u);
+}
+
+#if defined(__AVX512F__)
+TEST(AlignedAllocator, FloatVectorLoadedAsAVX512)
+{
+    std::vector<float, vectra::aligned_allocator<float, 64>> data(16);
+    for (std::size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<float>(i);
+
+    const __m512 v = _mm512_load_ps(data.data());
+    EXPECT_FLOAT_EQ(_mm512_reduce_add_ps(v), 120.f);
+}
+#endif
@@ -0,0 +1,151 @@
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+
+namespace
+{
+
+bool aligned(const void* ptr, std::size_t alignment)
+{
+	return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+}
+
+TEST(ArenaAllocator, AllocationsAreAligned)
+{
+	vectra::aligned_arena arena(1024);
+
+	for (std::size_t bytes : { 1, 3, 64, 100, 1000, 5000 })
+	{
+		void* p = arena.allocate(bytes);
+		EXPECT_TRUE(aligned(p, vectra::max_simd_alignment)) << "bytes = " << bytes;
+	}
+
+	EXPECT_TRUE(aligned(arena.allocate(10, 256), 256));
+	EXPECT_TRUE(aligned(arena.allocate(10, 4096), 4096));
+}
+
+TEST(ArenaAllocator, ResetReusesBlocks)
+{
+	vectra::aligned_arena arena(4096);
+
+	std::vector<void*> first;
+	for (int i = 0; i < 100; ++i)
+		first.push_back(arena.allocate(200));
+	const std::size_t capacity = arena.capacity();
+
+	// Same requests after a reset: same addresses, no new block
+	arena.reset();
+	for (int i = 0; i < 100; ++i)
+		EXPECT_EQ(arena.allocate(200), first[i]);
+	EXPECT_EQ(arena.capacity(), capacity);
+
+	arena.release();
+	EXPECT_EQ(arena.capacity(), 0u);
+}
+
+TEST(ArenaAllocator, RewindToMark)
+{
+	vectra::aligned_arena arena(256);
+
+	void* kept = arena.allocate(100);
+	const vectra::aligned_arena::marker m = arena.mark();
+
+	void* a = arena.allocate(1000);
+	void* b = arena.allocate(1000);
+	EXPECT_NE(b, a);
+	arena.rewind(m);
+
+	EXPECT_EQ(arena.allocate(1000), a);
+	EXPECT_NE(arena.allocate(10), kept);
+}
+
+TEST(ArenaAllocator, VectorOnArena)
+{
+	vectra::aligned_arena arena;
+
+	std::vector<float, vectra::arena_allocator<float>> x(1000, 1.f, arena);
+	std::iota(x.begin(), x.end(), 0.f);
+	x.resize(5000, 2.f);
+
+	EXPECT_TRUE(aligned(x.data(), vectra::max_simd_alignment));
+	EXPECT_EQ(x[999], 999.f);
+	EXPECT_EQ(x[4999], 2.f);
+	EXPECT_EQ(vectra::sum(x.data(), 1000), 499500.f);
+}
+
+TEST(ArenaAllocator, EqualityAndPropagation)
+{
+	using allocator = vectra::arena_allocator<float>;
+
+	vectra::aligned_arena a, b;
+
+	EXPECT_EQ(allocator(a), allocator(a));
+	EXPECT_NE(allocator(a), allocator(b));
+	EXPECT_EQ(allocator(a), vectra::arena_allocator<double>(a));
+	EXPECT_EQ(&vectra::arena_allocator<double>(allocator(b)).arena(), &b);
+
+	std::vector<float, allocator> x(10, 1.f, a);
+	std::vector<float, allocator> y(20, 2.f, b);
+
+	// Moves and swaps take the arena along with the memory
+	const float* data = x.data();
+	y = std::move(x);
+	EXPECT_EQ(y.data(), data);
+	EXPECT_EQ(&y.get_allocator().arena(), &a);
+
+	std::vector<float, allocator> z(5, 3.f, b);
+	y.swap(z);
+	EXPECT_EQ(&y.get_allocator().arena(), &b);
+	EXPECT_EQ(&z.get_allocator().arena(), &a);
+	EXPECT_EQ(z.data(), data);
+
+	// Copies stay on the arena of the copied vector
+	std::vector<float, allocator> c(z);
+	EXPECT_EQ(&c.get_allocator().arena(), &a);
+}
+
+TEST(ArenaAllocator, ScratchScopes)
+{
+	vectra::aligned_arena& arena = vectra::scratch_arena();
+	const vectra::aligned_arena::marker start = arena.mark();
+
+	const float* outer = nullptr;
+	{
+		vectra::scratch_scope scope;
+		vectra::scratch_vector<float> a(100, scope.allocator<float>());
+		outer = a.data();
+
+		{
+			vectra::scratch_scope inner;
+			vectra::scratch_vector<double> b(100, inner.allocator<double>());
+			EXPECT_TRUE(aligned(b.data(), vectra::max_simd_alignment));
+		}
+
+		// The inner scope released b, a is still there
+		vectra::scratch_vector<float> c(100, scope.allocator<float>());
+		EXPECT_NE(c.data(), outer);
+	}
+
+	EXPECT_EQ(arena.mark().block, start.block);
+	EXPECT_EQ(arena.mark().offset, start.offset);
+
+	// Another request reuses the same memory
+	vectra::scratch_scope scope;
+	vectra::scratch_vector<float> a(100, scope.allocator<float>());
+	EXPECT_EQ(a.data(), outer);
+
+	// Every thread has its own arena
+	vectra::aligned_arena* other = nullptr;
+	std::thread([&] { other = &vectra::scratch_arena(); }).join();
+	EXPECT_NE(other, &arena);
+}
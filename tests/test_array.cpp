@@ -0,0 +1,110 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+
+
+namespace
+{
+
+template <typename T, vectra::SIMDLevel level>
+void checkExpressions()
+{
+	using array = vectra::array<T, level>;
+
+	for (std::size_t n : { 0, 1, 3, 7, 16, 33, 100, 257 })
+	{
+		array a(n), b(n), c(n), d(n);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			a[i] = T(i) * T(0.25);
+			b[i] = T(3) - T(i % 11);
+			c[i] = T(i % 5) + T(1);
+			d[i] = T(0.5);
+		}
+
+		array r = a * b + c * d;
+		ASSERT_EQ(r.size(), n);
+		for (std::size_t i = 0; i < n; ++i)
+			ASSERT_EQ(r[i], a[i] * b[i] + c[i] * d[i]) << "n = " << n;
+
+		// Scalars on both sides, unary minus and functions
+		r = T(2) * a - b / T(4) + (-c);
+		for (std::size_t i = 0; i < n; ++i)
+			ASSERT_EQ(r[i], T(2) * a[i] - b[i] / T(4) - c[i]) << "n = " << n;
+
+		r = vectra::max(vectra::abs(b), d) + vectra::sqrt(c * c);
+		for (std::size_t i = 0; i < n; ++i)
+			ASSERT_EQ(r[i], std::fmax(std::fabs(b[i]), d[i]) + c[i]) << "n = " << n;
+
+		r = vectra::exp(vectra::log(c));
+		for (std::size_t i = 0; i < n; ++i)
+			ASSERT_NEAR(r[i], c[i], c[i] * T(4) * std::numeric_limits<T>::epsilon()) << "n = " << n;
+
+		// The assigned array may appear in its own expression
+		r = c;
+		r = r * r + r;
+		r += c;
+		r *= T(2);
+		for (std::size_t i = 0; i < n; ++i)
+			ASSERT_EQ(r[i], T(2) * (c[i] * c[i] + c[i] + c[i])) << "n = " << n;
+	}
+}
+
+}
+
+
+TEST(Array, IsLazy)
+{
+	vectra::array<float> a(8, 1.f), b(8, 2.f);
+
+	// Operators only build a node, holding references to the arrays
+	auto e = a * b + a;
+	static_assert(!std::is_same_v<decltype(e), vectra::array<float>>);
+	static_assert(sizeof(e) <= 4 * sizeof(void*));
+
+	a[0] = 5.f;
+	vectra::array<float> r = e;
+	EXPECT_EQ(r[0], 15.f);
+	EXPECT_EQ(r[7], 3.f);
+}
+
+// Arrays read by their own expression are not streamed, as in
+// transform(): the stores would bypass the lines being loaded
+TEST(Array, InPlaceAboveStreamThreshold)
+{
+	const std::size_t n = 2 * vectra::detail::stream_threshold / sizeof(float) + 5;
+
+	vectra::array<float> a(n, 3.f), b(n, 2.f);
+	EXPECT_TRUE ((a * 2.f).reads(a.data()));
+	EXPECT_TRUE ((b + -a).reads(a.data()));
+	EXPECT_FALSE((b * b + 1.f).reads(a.data()));
+
+	a *= 2.f;
+	a = a * b + b;
+	for (std::size_t i = 0; i < n; ++i)
+		ASSERT_EQ(a[i], 14.f) << "i = " << i;
+}
+
+TEST(Array, Resize)
+{
+	vectra::array<double> a = { 1., 2., 3. };
+	vectra::array<double> r;
+
+	r = a + 1.;
+	ASSERT_EQ(r.size(), 3u);
+	EXPECT_EQ(r[2], 4.);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(r.data()) % vectra::max_simd_alignment, 0u);
+}
+
+VECTRA_LEVEL_TEST_SUITE(Array, vectra::test::Levels);
+
+TYPED_TEST(Array, Float)  { checkExpressions<float,  TypeParam::value>(); }
+TYPED_TEST(Array, Double) { checkExpressions<double, TypeParam::value>(); }
@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+
+
+namespace
+{
+
+template <typename T>
+using index_t = std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>;
+
+template <typename T>
+std::vector<T> table(std::size_t n)
+{
+	std::vector<T> t(n);
+	for (std::size_t i = 0; i < n; ++i)
+		t[i] = static_cast<T>(3 * i + 1);
+	return t;
+}
+
+template <typename T>
+std::vector<index_t<T>> indices(std::size_t n, std::size_t range, unsigned seed)
+{
+	std::mt19937 generator(seed);
+	std::uniform_int_distribution<std::size_t> uniform(0, range - 1);
+
+	std::vector<index_t<T>> idx(n);
+	for (auto& i : idx)
+		i = static_cast<index_t<T>>(uniform(generator));
+	return idx;
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkVectratype()
+{
+	using vct = vectra::Vectratype<T, level>;
+	using vci = typename vct::index;
+
+	constexpr std::size_t w = vct::width();
+
+	const std::vector<T> t = table<T>(1000);
+	const std::vector<index_t<T>> idx = indices<T>(w, t.size(), 1);
+
+	T out[w];
+	vectra::ComputeBackend<T, level>::unloadu(out, vct::gather(t.data(), vci::loadu(idx.data())).value);
+	for (std::size_t i = 0; i < w; ++i)
+		EXPECT_EQ(out[i], t[idx[i]]);
+
+	// Masked-off lanes keep src, and their indices, far out of the
+	// table, are never read
+	std::vector<index_t<T>> far(idx);
+	for (std::size_t i = 0; i < w; i += 2)
+		far[i] = -(index_t<T>(1) << 28);
+
+	T odd[w];
+	for (std::size_t i = 0; i < w; ++i)
+		odd[i] = T(i % 2);
+
+	const vci  fi = vci::loadu(far.data());
+	const auto m  = vct::loadu(odd) > vct::zero();
+
+	vectra::ComputeBackend<T, level>::unloadu(out, vct::mask_gather(vct(T(-7)), m, t.data(), fi).value);
+	for (std::size_t i = 0; i < w; ++i)
+		EXPECT_EQ(out[i], i % 2 ? t[idx[i]] : T(-7));
+
+	// Scatters write the selected lanes only
+	std::vector<T> s(t.size(), T(0));
+	const vct x = vct::loadu(t.data()) + vct(T(1));
+
+	x.mask_scatter(s.data(), m, fi);
+	for (std::size_t i = 0; i < w; ++i)
+	{
+		if (i % 2)
+		{
+			EXPECT_EQ(s[idx[i]], t[i] + T(1));
+		}
+	}
+
+	// Repeated indices: the highest lane is written last
+	vct::loadu(t.data()).scatter(s.data(), vci(index_t<T>(5)));
+	EXPECT_EQ(s[5], t[w - 1]);
+}
+
+// Array algorithms, on sizes leaving every tail
+template <typename T, vectra::SIMDLevel level>
+void checkAlgorithms()
+{
+	constexpr std::size_t w = vectra::ComputeBackend<T, level>::width();
+
+	const std::vector<T> t = table<T>(513);
+
+	for (std::size_t n : { std::size_t(0), std::size_t(1), w - 1, w, w + 1, 2 * w + 3, std::size_t(4097) })
+	{
+		const std::vector<index_t<T>> idx = indices<T>(n, t.size(), unsigned(n));
+
+		std::vector<T> out(n + 1, T(-1));
+		vectra::gather<level>(t.data(), idx.data(), out.data(), n);
+		for (std::size_t i = 0; i < n; ++i)
+			ASSERT_EQ(out[i], t[idx[i]]) << "n = " << n << ", i = " << i;
+		EXPECT_EQ(out[n], T(-1));
+
+		std::vector<T> parallel(n);
+		vectra::gather<level>(vectra::execution::parallel, t.data(), idx.data(), parallel.data(), n);
+		for (std::size_t i = 0; i < n; ++i)
+			ASSERT_EQ(parallel[i], out[i]);
+	}
+
+	// Negative indices from the end of the table: table[0] is past the
+	// end, and must not be read for the missing lanes of the tail
+	const T* end = t.data() + t.size();
+	for (std::size_t n : { std::size_t(1), w + 1, 2 * w + 3 })
+	{
+		std::vector<index_t<T>> idx = indices<T>(n, t.size(), unsigned(n));
+		for (auto& i : idx)
+			i -= static_cast<index_t<T>>(t.size());
+
+		std::vector<T> out(n);
+		vectra::gather<level>(end, idx.data(), out.data(), n);
+		for (std::size_t i = 0; i < n; ++i)
+			ASSERT_EQ(out[i], end[idx[i]]) << "n = " << n << ", i = " << i;
+	}
+
+	// Scattering a permutation inverts it
+	std::vector<index_t<T>> permutation(t.size());
+	std::iota(permutation.begin(), permutation.end(), index_t<T>(0));
+	std::shuffle(permutation.begin(), permutation.end(), std::mt19937(7));
+
+	std::vector<T> shuffled(t.size()), restored(t.size());
+	vectra::gather <level>(t.data(), permutation.data(), shuffled.data(), t.size());
+	vectra::scatter<level>(shuffled.data(), permutation.data(), restored.data(), t.size());
+	EXPECT_EQ(restored, t);
+
+	// Repeated indices: the last one in array order wins
+	const std::vector<index_t<T>> same(2 * w + 1, index_t<T>(3));
+	std::vector<T> s(t);
+	vectra::scatter<level>(t.data(), same.data(), s.data(), same.size());
+	EXPECT_EQ(s[3], t[same.size() - 1]);
+}
+
+template <vectra::SIMDLevel level>
+void checkAll()
+{
+	checkVectratype<float,        level>();
+	checkVectratype<double,       level>();
+	checkVectratype<std::int32_t, level>();
+	checkVectratype<std::int64_t, level>();
+	checkAlgorithms<float,        level>();
+	checkAlgorithms<double,       level>();
+	checkAlgorithms<std::int32_t, level>();
+	checkAlgorithms<std::int64_t, level>();
+}
+
+}
+
+VECTRA_LEVEL_TEST_SUITE(Gather, vectra::test::Levels);
+
+TYPED_TEST(Gather, Operations) { checkAll<TypeParam::value>(); }
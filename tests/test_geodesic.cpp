@@ -0,0 +1,197 @@
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+
+
+namespace
+{
+
+using vectra::great_circle;
+
+constexpr long double pi = 3.141592653589793238462643383279502884L;
+constexpr long double rad = pi / 180;
+
+struct points
+{
+	explicit points(std::size_t n, unsigned seed)
+	{
+		std::mt19937 generator(seed);
+		std::uniform_real_distribution<double> latitude(-90., 90.), longitude(-180., 180.);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			lat.push_back(latitude(generator));
+			lon.push_back(longitude(generator));
+		}
+	}
+
+	std::vector<double> lat, lon;
+};
+
+// Long double references, on coordinates already rounded to T
+long double referenceHaversine(long double lat1, long double lon1, long double lat2, long double lon2)
+{
+	const long double s = std::sin((lat2 - lat1) * rad / 2);
+	const long double t = std::sin((lon2 - lon1) * rad / 2);
+	const long double a = s * s + std::cos(lat1 * rad) * std::cos(lat2 * rad) * t * t;
+	return 2 * std::asin(std::sqrt(std::fmin(a, 1.L))) * vectra::earth_radius;
+}
+
+long double referenceEquirectangular(long double lat1, long double lon1, long double lat2, long double lon2)
+{
+	long double dlon = (lon2 - lon1) * rad;
+	dlon -= 2 * pi * std::nearbyint(dlon / (2 * pi));
+	const long double x = dlon * std::cos((lat1 + lat2) * rad / 2);
+	const long double y = (lat2 - lat1) * rad;
+	return std::sqrt(x * x + y * y) * vectra::earth_radius;
+}
+
+long double referenceBearing(long double lat1, long double lon1, long double lat2, long double lon2)
+{
+	const long double dlon = (lon2 - lon1) * rad;
+	const long double y = std::sin(dlon) * std::cos(lat2 * rad);
+	const long double x = std::cos(lat1 * rad) * std::sin(lat2 * rad) - std::sin(lat1 * rad) * std::cos(lat2 * rad) * std::cos(dlon);
+	const long double b = std::atan2(y, x) / rad;
+	return b < 0 ? b + 360 : b;
+}
+
+template <typename T>
+std::vector<T> as(const std::vector<double>& x) { return std::vector<T>(x.begin(), x.end()); }
+
+// Pairwise kernels against the references, for a few hundred random
+// pairs (not a multiple of any register width, to cover the tail).
+// Errors are in meters on Earth: float has a 1 m resolution at 1e7 m.
+template <typename T, vectra::SIMDLevel level>
+void checkPairwise()
+{
+	const std::size_t n = 1003;
+	const points p(n, 1), q(n, 2);
+
+	const std::vector<T> lat1 = as<T>(p.lat), lon1 = as<T>(p.lon), lat2 = as<T>(q.lat), lon2 = as<T>(q.lon);
+	std::vector<T> out(n);
+
+	// Float resolution is about 1 m at 1e7 m, a few times worse close
+	// to the antipodes where asin is ill-conditioned
+	auto tolerance = [](long double reference) { return sizeof(T) == 4 ? 2. + reference * 2e-6 : 1e-6; };
+
+	vectra::great_circle_distance<level>(lat1.data(), lon1.data(), lat2.data(), lon2.data(), out.data(), n);
+	for (std::size_t i = 0; i < n; ++i)
+		ASSERT_NEAR(out[i], referenceHaversine(lat1[i], lon1[i], lat2[i], lon2[i]), tolerance(out[i])) << "i = " << i;
+
+	// Random pairs are far apart, where the law of cosines is accurate
+	vectra::great_circle_distance<level>(lat1.data(), lon1.data(), lat2.data(), lon2.data(), out.data(), n, great_circle::spherical_cosines);
+	for (std::size_t i = 0; i < n; ++i)
+		ASSERT_NEAR(out[i], referenceHaversine(lat1[i], lon1[i], lat2[i], lon2[i]), sizeof(T) == 4 ? 40. : 1e-4) << "i = " << i;
+
+	vectra::great_circle_distance<level>(lat1.data(), lon1.data(), lat2.data(), lon2.data(), out.data(), n, great_circle::equirectangular);
+	for (std::size_t i = 0; i < n; ++i)
+		ASSERT_NEAR(out[i], referenceEquirectangular(lat1[i], lon1[i], lat2[i], lon2[i]), tolerance(out[i])) << "i = " << i;
+
+	vectra::initial_bearing<level>(lat1.data(), lon1.data(), lat2.data(), lon2.data(), out.data(), n);
+	for (std::size_t i = 0; i < n; ++i)
+		ASSERT_NEAR(out[i], referenceBearing(lat1[i], lon1[i], lat2[i], lon2[i]), sizeof(T) == 4 ? 1e-3 : 1e-9) << "i = " << i;
+}
+
+// Distance between two results in ULP of the larger one
+template <typename T>
+double ulpDistance(T a, T b)
+{
+	const T spacing = std::nextafter(std::fmax(std::fabs(a), std::fabs(b)), std::numeric_limits<T>::infinity()) - std::fmax(std::fabs(a), std::fabs(b));
+	return static_cast<double>(std::fabs(a - b) / spacing);
+}
+
+// The one-to-many and matrix paths compute the same values as the
+// pairwise one, with the first point broadcast. They run the same
+// backend calls, but compilers may contract multiply-add pairs
+// differently in each loop, so results only agree to a few ULP.
+template <typename T, vectra::SIMDLevel level>
+void checkBatches()
+{
+	const double maxUlp = 64;
+
+	const std::size_t m = 3, n = 37;
+	const points p(m, 3), q(n, 4);
+
+	const std::vector<T> lat1 = as<T>(p.lat), lon1 = as<T>(p.lon), lat2 = as<T>(q.lat), lon2 = as<T>(q.lon);
+
+	for (great_circle formula : { great_circle::haversine, great_circle::spherical_cosines, great_circle::equirectangular })
+	{
+		std::vector<T> matrix(m * n), row(n), pairs(n);
+		vectra::great_circle_matrix<level>(lat1.data(), lon1.data(), m, lat2.data(), lon2.data(), n, matrix.data(), formula);
+
+		for (std::size_t i = 0; i < m; ++i)
+		{
+			const std::vector<T> la(n, lat1[i]), lo(n, lon1[i]);
+			vectra::great_circle_distance<level>(lat1[i], lon1[i], lat2.data(), lon2.data(), row.data(), n, formula);
+			vectra::great_circle_distance<level>(la.data(), lo.data(), lat2.data(), lon2.data(), pairs.data(), n, formula);
+
+			for (std::size_t j = 0; j < n; ++j)
+			{
+				EXPECT_EQ(matrix[i * n + j], row[j]);
+				EXPECT_LE(ulpDistance(row[j], pairs[j]), maxUlp) << row[j] << " vs " << pairs[j];
+			}
+		}
+	}
+
+	std::vector<T> row(n), pairs(n);
+	const std::vector<T> la(n, lat1[0]), lo(n, lon1[0]);
+	vectra::initial_bearing<level>(lat1[0], lon1[0], lat2.data(), lon2.data(), row.data(), n);
+	vectra::initial_bearing<level>(la.data(), lo.data(), lat2.data(), lon2.data(), pairs.data(), n);
+	for (std::size_t j = 0; j < n; ++j)
+		EXPECT_LE(ulpDistance(row[j], pairs[j]), maxUlp) << row[j] << " vs " << pairs[j];
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkKnownValues()
+{
+	// Paris to London, about 343.5 km, heading north-west
+	const T paris[]  = { T(48.8566), T(2.3522) };
+	const T london[] = { T(51.5074), T(-0.1278) };
+
+	T d, b;
+	vectra::great_circle_distance<level>(paris[0], paris[1], &london[0], &london[1], &d, 1);
+	vectra::initial_bearing<level>(paris[0], paris[1], &london[0], &london[1], &b, 1);
+	EXPECT_NEAR(d, T(343.56e3), T(100));
+	EXPECT_NEAR(b, T(330.), T(1));
+
+	// Short distances stay accurate with the haversine formula, and
+	// equirectangular agrees with it (10 m apart, and across the
+	// antimeridian)
+	const T lat[] = { T(45), T(0) };
+	const T lon[] = { T(10), T(179.9999) };
+	const T lat2[] = { T(45.00009), T(0) };
+	const T lon2[] = { T(10), T(-179.9999) };
+
+	T h[2], e[2];
+	vectra::great_circle_distance<level>(lat, lon, lat2, lon2, h, 2);
+	vectra::great_circle_distance<level>(lat, lon, lat2, lon2, e, 2, great_circle::equirectangular);
+	for (std::size_t i = 0; i < 2; ++i)
+	{
+		const T reference = T(referenceHaversine(lat[i], lon[i], lat2[i], lon2[i]));
+		EXPECT_NEAR(h[i], reference, reference * T(1e-3));
+		EXPECT_NEAR(e[i], reference, reference * T(1e-3));
+	}
+
+	// Same point, and antipodes
+	const T zero[] = { T(0) };
+	const T anti[] = { T(180) };
+	vectra::great_circle_distance<level>(T(0), T(0), zero, zero, &d, 1);
+	EXPECT_EQ(d, T(0));
+	vectra::great_circle_distance<level>(T(0), T(0), zero, anti, &d, 1);
+	EXPECT_NEAR(d, T(pi * vectra::earth_radius), T(pi * vectra::earth_radius) * T(1e-6));
+}
+
+}
+
+
+VECTRA_LEVEL_TEST_SUITE(Geodesic, vectra::test::Levels);
+
+TYPED_TEST(Geodesic, Float)  { checkPairwise<float,  TypeParam::value>(); checkBatches<float,  TypeParam::value>(); checkKnownValues<float,  TypeParam::value>(); }
+TYPED_TEST(Geodesic, Double) { checkPairwise<double, TypeParam::value>(); checkBatches<double, TypeParam::value>(); checkKnownValues<double, TypeParam::value>(); }
@@ -0,0 +1,150 @@
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+
+
+namespace
+{
+
+// Random vectors, with a few zero ones and a few (anti)parallel pairs
+template <typename T>
+struct vectors
+{
+	explicit vectors(std::size_t n)
+		: ax(n), ay(n), az(n), bx(n), by(n), bz(n)
+	{
+		std::mt19937 generator(7);
+		std::uniform_real_distribution<T> distribution(T(-10), T(10));
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			ax[i] = distribution(generator); ay[i] = distribution(generator); az[i] = distribution(generator);
+			bx[i] = distribution(generator); by[i] = distribution(generator); bz[i] = distribution(generator);
+
+			if (i % 11 == 3) { bx[i] = T(2) * ax[i]; by[i] = T(2) * ay[i]; bz[i] = T(2) * az[i]; }
+			if (i % 13 == 5) { bx[i] = -ax[i];       by[i] = -ay[i];       bz[i] = -az[i]; }
+			if (i % 17 == 7) { ax[i] = ay[i] = az[i] = T(0); }
+		}
+	}
+
+	std::vector<T> ax, ay, az, bx, by, bz;
+};
+
+template <typename T>
+T tolerance(long double reference, T ulps)
+{
+	return ulps * std::numeric_limits<T>::epsilon() * static_cast<T>(std::fabs(reference) > 1 ? std::fabs(reference) : 1);
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkGeometry()
+{
+	const std::size_t n = 203;
+	const vectors<T> v(n);
+	std::vector<T> out(n), ox(n), oy(n), oz(n);
+
+	auto dot = [&](std::size_t i) { return (long double)v.ax[i] * v.bx[i] + (long double)v.ay[i] * v.by[i] + (long double)v.az[i] * v.bz[i]; };
+	auto na  = [&](std::size_t i) { return std::sqrt((long double)v.ax[i] * v.ax[i] + (long double)v.ay[i] * v.ay[i] + (long double)v.az[i] * v.az[i]); };
+
+	vectra::dot3<level>(v.ax.data(), v.ay.data(), v.az.data(), v.bx.data(), v.by.data(), v.bz.data(), out.data(), n);
+	for (std::size_t i = 0; i < n; ++i)
+		ASSERT_NEAR(out[i], dot(i), tolerance<T>(300, 4)) << "i = " << i;
+
+	vectra::length3<level>(v.ax.data(), v.ay.data(), v.az.data(), out.data(), n);
+	for (std::size_t i = 0; i < n; ++i)
+		ASSERT_NEAR(out[i], na(i), tolerance<T>(na(i), 2)) << "i = " << i;
+
+	vectra::cross3<level>(v.ax.data(), v.ay.data(), v.az.data(), v.bx.data(), v.by.data(), v.bz.data(), ox.data(), oy.data(), oz.data(), n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		ASSERT_NEAR(ox[i], (long double)v.ay[i] * v.bz[i] - (long double)v.az[i] * v.by[i], tolerance<T>(100, 2)) << "i = " << i;
+		ASSERT_NEAR(oy[i], (long double)v.az[i] * v.bx[i] - (long double)v.ax[i] * v.bz[i], tolerance<T>(100, 2)) << "i = " << i;
+		ASSERT_NEAR(oz[i], (long double)v.ax[i] * v.by[i] - (long double)v.ay[i] * v.bx[i], tolerance<T>(100, 2)) << "i = " << i;
+	}
+
+	for (vectra::normalization mode : { vectra::normalization::exact, vectra::normalization::fast })
+	{
+		vectra::normalize3<level>(v.ax.data(), v.ay.data(), v.az.data(), ox.data(), oy.data(), oz.data(), n, mode);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const long double l = na(i) == 0 ? 1 : na(i);
+			ASSERT_NEAR(ox[i], v.ax[i] / l, tolerance<T>(1, 3)) << "i = " << i;
+			ASSERT_NEAR(oy[i], v.ay[i] / l, tolerance<T>(1, 3)) << "i = " << i;
+			ASSERT_NEAR(oz[i], v.az[i] / l, tolerance<T>(1, 3)) << "i = " << i;
+		}
+	}
+
+	// Tiny and large vectors, whose squared length leaves the float
+	// range, or is subnormal in float. In float, the squared length of
+	// vectors beyond 1e19 overflows in both modes.
+	for (T scale : { T(1e-20), sizeof(T) == 4 ? T(1e15) : T(1e20) })
+	{
+		std::vector<T> sx(n), sy(n), sz(n);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			sx[i] = v.ax[i] * scale; sy[i] = v.ay[i] * scale; sz[i] = v.az[i] * scale;
+		}
+
+		vectra::normalize3<level>(sx.data(), sy.data(), sz.data(), ox.data(), oy.data(), oz.data(), n, vectra::normalization::fast);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const long double l = na(i) == 0 ? 1 : na(i);
+			ASSERT_NEAR(ox[i], v.ax[i] / l, tolerance<T>(1, 8)) << "scale = " << scale << ", i = " << i;
+			ASSERT_NEAR(oy[i], v.ay[i] / l, tolerance<T>(1, 8)) << "scale = " << scale << ", i = " << i;
+			ASSERT_NEAR(oz[i], v.az[i] / l, tolerance<T>(1, 8)) << "scale = " << scale << ", i = " << i;
+		}
+	}
+
+	vectra::angle3<level>(v.ax.data(), v.ay.data(), v.az.data(), v.bx.data(), v.by.data(), v.bz.data(), out.data(), n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		if (i % 17 == 7)
+			ASSERT_EQ(out[i], T(0)) << "i = " << i;
+		else if (i % 13 == 5)
+			ASSERT_NEAR(out[i], std::acos(-1.L), tolerance<T>(1, 64)) << "i = " << i;
+		else if (i % 11 == 3)
+			ASSERT_NEAR(out[i], 0, tolerance<T>(1, 64)) << "i = " << i;
+		else
+		{
+			const long double c = dot(i) / (na(i) * std::sqrt((long double)v.bx[i] * v.bx[i] + (long double)v.by[i] * v.by[i] + (long double)v.bz[i] * v.bz[i]));
+			ASSERT_NEAR(out[i], std::acos(c), tolerance<T>(1, 64)) << "i = " << i;
+		}
+	}
+
+	vectra::project3<level>(v.ax.data(), v.ay.data(), v.az.data(), v.bx.data(), v.by.data(), v.bz.data(), ox.data(), oy.data(), oz.data(), n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const long double s = dot(i) / ((long double)v.bx[i] * v.bx[i] + (long double)v.by[i] * v.by[i] + (long double)v.bz[i] * v.bz[i]);
+		ASSERT_NEAR(ox[i], s * v.bx[i], tolerance<T>(20, 8)) << "i = " << i;
+		ASSERT_NEAR(oy[i], s * v.by[i], tolerance<T>(20, 8)) << "i = " << i;
+		ASSERT_NEAR(oz[i], s * v.bz[i], tolerance<T>(20, 8)) << "i = " << i;
+	}
+
+	// Reflection on the unit normals, in place: reflecting twice gives
+	// the original vector back
+	std::vector<T> mx(n), my(n), mz(n), rx = v.ax, ry = v.ay, rz = v.az;
+	vectra::normalize3<level>(v.bx.data(), v.by.data(), v.bz.data(), mx.data(), my.data(), mz.data(), n);
+	vectra::reflect3<level>(rx.data(), ry.data(), rz.data(), mx.data(), my.data(), mz.data(), rx.data(), ry.data(), rz.data(), n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const long double d = 2 * ((long double)v.ax[i] * mx[i] + (long double)v.ay[i] * my[i] + (long double)v.az[i] * mz[i]);
+		ASSERT_NEAR(rx[i], v.ax[i] - d * mx[i], tolerance<T>(20, 8)) << "i = " << i;
+		ASSERT_NEAR(ry[i], v.ay[i] - d * my[i], tolerance<T>(20, 8)) << "i = " << i;
+		ASSERT_NEAR(rz[i], v.az[i] - d * mz[i], tolerance<T>(20, 8)) << "i = " << i;
+	}
+}
+
+}
+
+
+VECTRA_LEVEL_TEST_SUITE(Geometry, vectra::test::Levels);
+
+TYPED_TEST(Geometry, Float)  { checkGeometry<float,  TypeParam::value>(); }
+TYPED_TEST(Geometry, Double) { checkGeometry<double, TypeParam::value>(); }
@@ -0,0 +1,241 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#if defined(__F16C__)
+	#include <immintrin.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+
+
+namespace
+{
+
+using vectra::bfloat16;
+using vectra::half;
+
+std::uint32_t bits(float f)
+{
+	std::uint32_t b;
+	std::memcpy(&b, &f, sizeof(b));
+	return b;
+}
+
+float fromBits(std::uint32_t b)
+{
+	float f;
+	std::memcpy(&f, &b, sizeof(f));
+	return f;
+}
+
+// Random bit patterns: every class of float (zeros, subnormals,
+// normals, infinities, NaN) with both signs, and values around the
+// half range and its rounding ties
+std::vector<float> floats(std::size_t n)
+{
+	std::mt19937 generator(17);
+	std::uniform_int_distribution<std::uint32_t> pattern;
+	std::uniform_real_distribution<float> exponent(-30.f, 17.f);
+
+	std::vector<float> x;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const std::uint32_t b = pattern(generator);
+		x.push_back((i & 1) ? fromBits(b) : std::exp2(exponent(generator)) * ((b & 1) ? -1.f : 1.f));
+	}
+
+	for (float f : { 0.f, -0.f, 1.f, 65504.f, 65519.f, 65520.f, 1e-8f, 0x1p-24f, 0x1p-25f, 0x3p-26f, 0x1p-14f, 1.f + 0x1p-11f, 1.f + 0x3p-11f,
+	                 std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(),
+	                 std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::max(), fromBits(0x7F800001u), fromBits(0xFFFFFFFFu) })
+		x.push_back(f);
+
+	return x;
+}
+
+template <typename H>
+std::vector<H> allValues()
+{
+	std::vector<H> h(65536);
+	for (std::size_t i = 0; i < h.size(); ++i)
+		h[i] = H::from_bits(static_cast<std::uint16_t>(i));
+	return h;
+}
+
+// Every conversion of a level matches the scalar ones bit for bit, on
+// arrays whose size leaves every possible tail
+template <vectra::SIMDLevel level>
+void checkConversions()
+{
+	constexpr std::size_t w = vectra::ComputeBackend<float, level>::width();
+
+	const std::vector<float>    x  = floats(4096);
+	const std::vector<half>     h  = allValues<half>();
+	const std::vector<bfloat16> bf = allValues<bfloat16>();
+
+	for (std::size_t n : { std::size_t(0), std::size_t(1), w - 1, w, w + 1, 2 * w + 3, x.size() })
+	{
+		std::vector<half>     nh(n + 1, half::from_bits(0xABCD));
+		std::vector<bfloat16> nb(n + 1, bfloat16::from_bits(0xABCD));
+
+		vectra::convert<level>(x.data(), nh.data(), n);
+		vectra::convert<level>(x.data(), nb.data(), n);
+
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			ASSERT_EQ(nh[i].bits, half(x[i]).bits)     << "x = " << x[i] << " (" << std::hex << bits(x[i]) << ")";
+			ASSERT_EQ(nb[i].bits, bfloat16(x[i]).bits) << "x = " << x[i] << " (" << std::hex << bits(x[i]) << ")";
+		}
+
+		// Nothing written past the end
+		EXPECT_EQ(nh[n].bits, 0xABCD);
+		EXPECT_EQ(nb[n].bits, 0xABCD);
+	}
+
+	std::vector<float> wide(h.size() + 1, 42.f);
+
+	vectra::convert<level>(h.data(), wide.data(), h.size() - 1);
+	for (std::size_t i = 0; i + 1 < h.size(); ++i)
+		ASSERT_EQ(bits(wide[i]), bits(static_cast<float>(h[i]))) << "half " << std::hex << h[i].bits;
+	EXPECT_EQ(wide[h.size() - 1], 42.f);
+
+	vectra::convert<level>(bf.data(), wide.data(), bf.size());
+	for (std::size_t i = 0; i < bf.size(); ++i)
+		ASSERT_EQ(bits(wide[i]), bits(static_cast<float>(bf[i]))) << "bfloat16 " << std::hex << bf[i].bits;
+}
+
+// Kernels widen 16-bit data on load and narrow their results on store
+template <vectra::SIMDLevel level>
+void checkVectratype()
+{
+	using vct = vectra::Vectratype<float, level>;
+
+	constexpr std::size_t w = vct::width();
+
+	half     h[w];
+	bfloat16 b[w];
+	for (std::size_t i = 0; i < w; ++i)
+	{
+		h[i] = half(0.25f * float(i) - 1.f);
+		b[i] = bfloat16(0.25f * float(i) - 1.f);
+	}
+
+	const vct y = vct(h) * vct(b) + vct(1.f);
+
+	half     out[w];
+	bfloat16 outb[w];
+	y.unloadu(out);
+	y.unloadu(outb);
+
+	for (std::size_t i = 0; i < w; ++i)
+	{
+		const float v = 0.25f * float(i) - 1.f;
+		EXPECT_EQ(static_cast<float>(out[i]),  static_cast<float>(half(v * v + 1.f)));
+		EXPECT_EQ(static_cast<float>(outb[i]), static_cast<float>(bfloat16(v * v + 1.f)));
+	}
+
+	EXPECT_EQ(static_cast<float>(out[0]), 2.f);
+}
+
+template <vectra::SIMDLevel level>
+void checkParallel()
+{
+	const std::size_t n = (std::size_t(1) << 18) + 7;
+
+	std::vector<float> x(n);
+	for (std::size_t i = 0; i < n; ++i)
+		x[i] = std::sin(float(i)) * 1000.f;
+
+	std::vector<half> sequential(n), parallel(n);
+	vectra::convert<level>(x.data(), sequential.data(), n);
+	vectra::convert<level>(vectra::execution::parallel, x.data(), parallel.data(), n);
+
+	std::vector<float> back(n);
+	vectra::convert<level>(vectra::execution::parallel, parallel.data(), back.data(), n);
+
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		ASSERT_EQ(parallel[i].bits, sequential[i].bits);
+		ASSERT_EQ(back[i], static_cast<float>(sequential[i]));
+	}
+}
+
+template <vectra::SIMDLevel level>
+void checkAll()
+{
+	checkConversions<level>();
+	checkVectratype<level>();
+	checkParallel<level>();
+}
+
+}
+
+TEST(HalfScalar, Encodings)
+{
+	EXPECT_EQ(half(1.f).bits,      0x3C00);
+	EXPECT_EQ(half(-2.f).bits,     0xC000);
+	EXPECT_EQ(half(65504.f).bits,  0x7BFF);
+	EXPECT_EQ(half(65519.f).bits,  0x7BFF);
+	EXPECT_EQ(half(65520.f).bits,  0x7C00); // Tie, rounded to even: infinity
+	EXPECT_EQ(half(0x1p-14f).bits, 0x0400); // Smallest normal
+	EXPECT_EQ(half(0x1p-24f).bits, 0x0001); // Smallest subnormal
+	EXPECT_EQ(half(0x1p-25f).bits, 0x0000); // Tie, rounded to even: zero
+	EXPECT_EQ(half(0x3p-26f).bits, 0x0001);
+	EXPECT_EQ(half(-0.f).bits,     0x8000);
+	EXPECT_EQ(half(1.f + 0x1p-11f).bits, 0x3C00);
+	EXPECT_EQ(half(1.f + 0x3p-11f).bits, 0x3C02);
+	EXPECT_EQ(half(std::numeric_limits<float>::infinity()).bits, 0x7C00);
+	EXPECT_EQ(half(std::numeric_limits<float>::quiet_NaN()).bits & 0x7E00, 0x7E00);
+
+	EXPECT_EQ(bfloat16(1.f).bits, 0x3F80);
+	EXPECT_EQ(bfloat16(fromBits(0x3F808000u)).bits, 0x3F80); // Tie, rounded to even
+	EXPECT_EQ(bfloat16(fromBits(0x3F818000u)).bits, 0x3F82);
+	EXPECT_EQ(bfloat16(fromBits(0x7F800001u)).bits, 0x7FC0); // NaN stays NaN, quieted
+	EXPECT_EQ(bfloat16(std::numeric_limits<float>::max()).bits, 0x7F80);
+}
+
+TEST(HalfScalar, RoundTrip)
+{
+	// Widening is exact, so every value comes back unchanged, NaN
+	// being quieted
+	for (std::uint32_t i = 0; i < 65536; ++i)
+	{
+		const half h = half::from_bits(static_cast<std::uint16_t>(i));
+		const half r = half(static_cast<float>(h));
+		const bool nan = (i & 0x7FFF) > 0x7C00;
+		ASSERT_EQ(r.bits, nan ? (i | 0x0200) : i) << std::hex << i;
+
+		const bfloat16 b = bfloat16::from_bits(static_cast<std::uint16_t>(i));
+		const bfloat16 s = bfloat16(static_cast<float>(b));
+		const bool bnan = (i & 0x7FFF) > 0x7F80;
+		ASSERT_EQ(s.bits, bnan ? (i | 0x0040) : i) << std::hex << i;
+	}
+
+	EXPECT_EQ(static_cast<float>(half::from_bits(0x0001)), 0x1p-24f);
+	EXPECT_EQ(static_cast<float>(half::from_bits(0x7BFF)), 65504.f);
+}
+
+#if defined(__F16C__)
+TEST(HalfScalar, MatchesF16C)
+{
+	for (float x : floats(1 << 20))
+	{
+		ASSERT_EQ(half(x).bits, _cvtss_sh(x, _MM_FROUND_TO_NEAREST_INT)) << std::hex << bits(x);
+
+		const half h = half::from_bits(static_cast<std::uint16_t>(bits(x)));
+		ASSERT_EQ(bits(static_cast<float>(h)), bits(_cvtsh_ss(h.bits))) << std::hex << h.bits;
+	}
+}
+#endif
+
+VECTRA_LEVEL_TEST_SUITE(Half, vectra::test::Levels);
+
+TYPED_TEST(Half, Conversions) { checkAll<TypeParam::value>(); }
@@ -0,0 +1,266 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+
+
+namespace
+{
+
+template <typename T>
+using floating_t = std::conditional_t<sizeof(T) == 4, float, double>;
+
+// Scalar references, wrapping around like the backends
+template <typename T>
+T wrap(std::make_unsigned_t<T> x) { return static_cast<T>(x); }
+
+template <typename T> T addRef(T a, T b) { return wrap<T>(std::make_unsigned_t<T>(a) + std::make_unsigned_t<T>(b)); }
+template <typename T> T subRef(T a, T b) { return wrap<T>(std::make_unsigned_t<T>(a) - std::make_unsigned_t<T>(b)); }
+template <typename T> T mulRef(T a, T b) { return wrap<T>(std::make_unsigned_t<T>(a) * std::make_unsigned_t<T>(b)); }
+template <typename T> T absRef(T x)      { return x < 0 ? subRef<T>(0, x) : x; }
+
+// Random values of every magnitude, with the extremes and small ones
+// that make equal pairs likely
+template <typename T>
+std::vector<T> integers(std::size_t n, unsigned seed)
+{
+	std::mt19937_64 generator(seed);
+	std::uniform_int_distribution<T> any(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+	std::uniform_int_distribution<int> bits(0, int(8 * sizeof(T)) - 1);
+	std::uniform_int_distribution<T> small(-3, 3);
+
+	std::vector<T> x;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		switch (i % 3)
+		{
+		case 0:  x.push_back(any(generator)); break;
+		case 1:  x.push_back(small(generator)); break;
+		default: x.push_back(static_cast<T>(any(generator) >> bits(generator))); break;
+		}
+	}
+
+	for (T v : { std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), T(0), T(-1), T(1) })
+		x.push_back(v);
+
+	return x;
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkArithmetic()
+{
+	using backend = vectra::ComputeBackend<T, level>;
+	using vct     = vectra::Vectratype<T, level>;
+
+	constexpr std::size_t w = backend::width();
+	constexpr int bits = int(8 * sizeof(T));
+
+	std::vector<T> a = integers<T>(4096, 3);
+	std::vector<T> b = integers<T>(4096, 5);
+	a.resize(a.size() / w * w);
+	b.resize(a.size());
+
+	T out[w];
+	for (std::size_t i = 0; i < a.size(); i += w)
+	{
+		const vct x = vct::loadu(a.data() + i);
+		const vct y = vct::loadu(b.data() + i);
+		const int n = int(i / w) % bits;
+
+		const auto expect = [&](vct r, auto ref, const char* op)
+		{
+			backend::unloadu(out, r.value);
+			for (std::size_t j = 0; j < w; ++j)
+				ASSERT_EQ(out[j], ref(a[i + j], b[i + j])) << op << "(" << a[i + j] << ", " << b[i + j] << "), n = " << n;
+		};
+
+		expect(x + y,                [](T p, T q) { return addRef(p, q); }, "add");
+		expect(x - y,                [](T p, T q) { return subRef(p, q); }, "sub");
+		expect(x * y,                [](T p, T q) { return mulRef(p, q); }, "mul");
+		expect(vct::min(x, y),       [](T p, T q) { return std::min(p, q); }, "min");
+		expect(vct::max(x, y),       [](T p, T q) { return std::max(p, q); }, "max");
+		expect(vct::abs(x),          [](T p, T)   { return absRef(p); }, "abs");
+		expect(-x,                   [](T p, T)   { return subRef<T>(0, p); }, "neg");
+		expect(x & y,                [](T p, T q) { return T(p & q); }, "and");
+		expect(x | y,                [](T p, T q) { return T(p | q); }, "or");
+		expect(x ^ y,                [](T p, T q) { return T(p ^ q); }, "xor");
+		expect(~x,                   [](T p, T)   { return T(~p); }, "not");
+		expect(x << n,               [n](T p, T)  { return wrap<T>(std::make_unsigned_t<T>(p) << n); }, "shl");
+		expect(x >> n,               [n](T p, T)  { return T(p >> n); }, "shr");
+		expect(vct::shr_logical(x, n), [n](T p, T) { return wrap<T>(std::make_unsigned_t<T>(p) >> n); }, "shr_logical");
+
+		// Comparisons, as lane bits
+		const auto lanes = [&](auto cmp)
+		{
+			unsigned m = 0;
+			for (std::size_t j = 0; j < w; ++j)
+				m |= cmp(a[i + j], b[i + j]) ? 1u << j : 0u;
+			return m;
+		};
+
+		EXPECT_EQ((x == y).movemask(), lanes([](T p, T q) { return p == q; }));
+		EXPECT_EQ((x != y).movemask(), lanes([](T p, T q) { return p != q; }));
+		EXPECT_EQ((x <  y).movemask(), lanes([](T p, T q) { return p <  q; }));
+		EXPECT_EQ((x <= y).movemask(), lanes([](T p, T q) { return p <= q; }));
+		EXPECT_EQ((x >  y).movemask(), lanes([](T p, T q) { return p >  q; }));
+		EXPECT_EQ((x >= y).movemask(), lanes([](T p, T q) { return p >= q; }));
+
+		expect(vct::select(x < y, y, x), [](T p, T q) { return std::max(p, q); }, "select");
+
+		T sum = 0;
+		for (std::size_t j = 0; j < w; ++j)
+			sum = addRef(sum, a[i + j]);
+		EXPECT_EQ(x.hsum(), sum);
+	}
+
+	EXPECT_TRUE((vct(T(7)) == vct(T(7))).all());
+	EXPECT_FALSE((vct::one() == vct::zero()).any());
+}
+
+// from_float() rounds to nearest even, from_float_trunc() toward zero,
+// to_float() like static_cast, on in-range values and rounding ties
+template <typename T, vectra::SIMDLevel level>
+void checkConversions()
+{
+	using F       = floating_t<T>;
+	using backend = vectra::ComputeBackend<T, level>;
+	using vct     = vectra::Vectratype<T, level>;
+	using vcf     = vectra::Vectratype<F, level>;
+
+	constexpr std::size_t w = backend::width();
+
+	// Below 2^51 for int64_t, the range of the emulated conversion
+	const F range = sizeof(T) == 4 ? F(0x1p30) : F(0x1p50);
+
+	std::mt19937_64 generator(11);
+	std::uniform_real_distribution<F> uniform(-range, range);
+	std::uniform_real_distribution<F> exponent(-2, std::log2(range));
+
+	std::vector<F> f;
+	for (std::size_t i = 0; i < 4096; ++i)
+	{
+		const F magnitude = std::exp2(exponent(generator));
+		f.push_back(i % 2 ? uniform(generator) : (i % 4 ? -magnitude : magnitude));
+	}
+	for (F v : { F(0), F(-0.), F(0.5), F(-0.5), F(1.5), F(2.5), F(-2.5), F(-3.5), F(0.49999997), F(-range), F(range) })
+		f.push_back(v);
+	f.resize(f.size() / w * w);
+
+	std::vector<T> x = integers<T>(4096, 7);
+	x.resize(x.size() / w * w);
+
+	T out[w];
+	F outf[w];
+	for (std::size_t i = 0; i < f.size(); i += w)
+	{
+		const vcf v = vcf::loadu(f.data() + i);
+
+		backend::unloadu(out, vct::from_float(v).value);
+		for (std::size_t j = 0; j < w; ++j)
+			ASSERT_EQ(out[j], static_cast<T>(std::nearbyint(f[i + j]))) << "from_float(" << f[i + j] << ")";
+
+		backend::unloadu(out, vct::from_float_trunc(v).value);
+		for (std::size_t j = 0; j < w; ++j)
+			ASSERT_EQ(out[j], static_cast<T>(f[i + j])) << "from_float_trunc(" << f[i + j] << ")";
+	}
+
+	for (std::size_t i = 0; i < x.size(); i += w)
+	{
+		vectra::ComputeBackend<F, level>::unloadu(outf, vct::loadu(x.data() + i).to_float().value);
+		for (std::size_t j = 0; j < w; ++j)
+			ASSERT_EQ(outf[j], static_cast<F>(x[i + j])) << "to_float(" << x[i + j] << ")";
+	}
+}
+
+// Tails: lanes past n are neither read nor written, and load as zeros
+template <typename T, vectra::SIMDLevel level>
+void checkPartial()
+{
+	using backend = vectra::ComputeBackend<T, level>;
+
+	constexpr std::size_t w = backend::width();
+
+	T in[w], out[w], full[w];
+	for (std::size_t i = 0; i < w; ++i)
+		in[i] = T(i + 1);
+
+	for (std::size_t n = 0; n < w; ++n)
+	{
+		for (std::size_t i = 0; i < w; ++i)
+			out[i] = T(-5);
+
+		const typename backend::type x = backend::loadu_partial(in, n);
+		backend::unloadu(full, x);
+		backend::unloadu_partial(out, x, n);
+
+		for (std::size_t i = 0; i < w; ++i)
+		{
+			EXPECT_EQ(full[i], i < n ? in[i] : T(0));
+			EXPECT_EQ(out[i],  i < n ? in[i] : T(-5));
+		}
+	}
+}
+
+// Integer kernels run through transform(), e.g. a hash of indices
+// and the bucket of a value
+template <typename T, vectra::SIMDLevel level>
+void checkTransform()
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	const std::vector<T> x = integers<T>(1000, 13);
+	std::vector<T> out(x.size());
+
+	vectra::transform<level>(x.data(), out.data(), x.size(), [](vct v)
+	{
+		v = v * vct(T(0x2545F491)) ^ (v >> 7);
+		return vct::min(vct::max(v, vct(T(-1000))), vct(T(1000)));
+	});
+
+	for (std::size_t i = 0; i < x.size(); ++i)
+	{
+		const T h = T(mulRef(x[i], T(0x2545F491)) ^ T(x[i] >> 7));
+		ASSERT_EQ(out[i], std::min(std::max(h, T(-1000)), T(1000)));
+	}
+
+	using vcf = vectra::Vectratype<floating_t<T>, level>;
+	using F   = floating_t<T>;
+
+	// Quantization of [0 ; 1[ into 10 buckets
+	std::vector<F> u(vct::width());
+	for (std::size_t i = 0; i < u.size(); ++i)
+		u[i] = F(i) / F(u.size());
+
+	T bucket[vct::width()];
+	vectra::ComputeBackend<T, level>::unloadu(bucket, vct::from_float_trunc(vcf::loadu(u.data()) * vcf(F(10))).value);
+	for (std::size_t i = 0; i < u.size(); ++i)
+		EXPECT_EQ(bucket[i], static_cast<T>(u[i] * F(10)));
+}
+
+template <vectra::SIMDLevel level>
+void checkAll()
+{
+	checkArithmetic<std::int32_t, level>();
+	checkArithmetic<std::int64_t, level>();
+	checkConversions<std::int32_t, level>();
+	checkConversions<std::int64_t, level>();
+	checkPartial<std::int32_t, level>();
+	checkPartial<std::int64_t, level>();
+	checkTransform<std::int32_t, level>();
+	checkTransform<std::int64_t, level>();
+}
+
+}
+
+VECTRA_LEVEL_TEST_SUITE(Integer, vectra::test::Levels);
+
+TYPED_TEST(Integer, Operations) { checkAll<TypeParam::value>(); }
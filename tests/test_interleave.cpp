@@ -0,0 +1,61 @@
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+
+
+namespace
+{
+
+// Round trips every size up to a few registers, for each stride.
+// Values encode (record, component), so any misplaced lane shows.
+template <typename T, vectra::SIMDLevel level>
+void checkInterleave()
+{
+	const std::size_t maxSize = 4 * vectra::ComputeBackend<T, level>::width() + 3;
+
+	for (std::size_t n = 0; n <= maxSize; ++n)
+	{
+		std::vector<T> in(4 * n), out(4 * n + 1, T(-1));
+		std::vector<T> c[4];
+		for (auto& v : c)
+			v.assign(n + 1, T(-1));
+
+		for (std::size_t stride = 2; stride <= 4; ++stride)
+		{
+			for (std::size_t i = 0; i < n * stride; ++i)
+				in[i] = T(10 * (i / stride) + i % stride);
+
+			if (stride == 2) vectra::deinterleave<level>(in.data(), c[0].data(), c[1].data(), n);
+			if (stride == 3) vectra::deinterleave<level>(in.data(), c[0].data(), c[1].data(), c[2].data(), n);
+			if (stride == 4) vectra::deinterleave<level>(in.data(), c[0].data(), c[1].data(), c[2].data(), c[3].data(), n);
+
+			for (std::size_t k = 0; k < stride; ++k)
+			{
+				for (std::size_t i = 0; i < n; ++i)
+					ASSERT_EQ(c[k][i], T(10 * i + k)) << "stride = " << stride << ", n = " << n;
+				ASSERT_EQ(c[k][n], T(-1)) << "stride = " << stride << ", n = " << n;
+			}
+
+			if (stride == 2) vectra::interleave<level>(c[0].data(), c[1].data(), out.data(), n);
+			if (stride == 3) vectra::interleave<level>(c[0].data(), c[1].data(), c[2].data(), out.data(), n);
+			if (stride == 4) vectra::interleave<level>(c[0].data(), c[1].data(), c[2].data(), c[3].data(), out.data(), n);
+
+			for (std::size_t i = 0; i < n * stride; ++i)
+				ASSERT_EQ(out[i], in[i]) << "stride = " << stride << ", n = " << n;
+			ASSERT_EQ(out[n * stride], T(-1)) << "stride = " << stride << ", n = " << n;
+		}
+	}
+}
+
+}
+
+
+VECTRA_LEVEL_TEST_SUITE(Interleave, vectra::test::Levels);
+
+TYPED_TEST(Interleave, Float)  { checkInterleave<float,  TypeParam::value>(); }
+TYPED_TEST(Interleave, Double) { checkInterleave<double, TypeParam::value>(); }
@@ -0,0 +1,113 @@
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "ulp.hpp"
+
+#ifdef VECTRA_HAS_KERNELS
+#include <vectra/dispatch/kernels.hpp>
+
+
+namespace
+{
+
+using vectra::SIMDLevel;
+using vectra::test::ulpError;
+
+// Odd sizes exercise both full registers and the partial tail
+constexpr std::size_t size = 37;
+
+template <typename T>
+void checkTable(const vectra::kernels::kernel_table<T>& table)
+{
+	// Tolerances also cover the libm functions used by SIMDLevel::None
+	std::vector<T> x(size), y(size), out(size);
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		x[i] = T(-0.9) + T(1.8) * T(i) / T(size);
+		y[i] = T(0.25) + T(i) / T(8);
+	}
+
+	auto unary = [&](const char* name, auto kernel, auto reference, const std::vector<T>& in, double maxUlp)
+	{
+		kernel(in.data(), out.data(), size);
+		for (std::size_t i = 0; i < size; ++i)
+			ASSERT_LE(ulpError(out[i], reference(static_cast<long double>(in[i]))), maxUlp) << name << "(" << in[i] << "), level = " << table.level;
+	};
+
+	unary("sin",   table.sin,   [](long double v) { return std::sin  (v); }, x, 2.5);
+	unary("cos",   table.cos,   [](long double v) { return std::cos  (v); }, x, 2.5);
+	unary("asin",  table.asin,  [](long double v) { return std::asin (v); }, x, 1.0);
+	unary("acos",  table.acos,  [](long double v) { return std::acos (v); }, x, 1.1);
+	unary("atan",  table.atan,  [](long double v) { return std::atan (v); }, y, 1.1);
+	unary("sqrt",  table.sqrt,  [](long double v) { return std::sqrt (v); }, y, 0.5);
+	unary("cbrt",  table.cbrt,  [](long double v) { return std::cbrt (v); }, x, 2.0);
+	unary("exp",   table.exp,   [](long double v) { return std::exp  (v); }, y, 1.1);
+	unary("exp2",  table.exp2,  [](long double v) { return std::exp2 (v); }, y, 1.1);
+	unary("expm1", table.expm1, [](long double v) { return std::expm1(v); }, x, 2.0);
+	unary("log",   table.log,   [](long double v) { return std::log  (v); }, y, 1.0);
+	unary("log2",  table.log2,  [](long double v) { return std::log2 (v); }, y, 1.0);
+	unary("log1p", table.log1p, [](long double v) { return std::log1p(v); }, x, 1.0);
+
+	table.atan2(x.data(), y.data(), out.data(), size);
+	for (std::size_t i = 0; i < size; ++i)
+		ASSERT_LE(ulpError(out[i], std::atan2(static_cast<long double>(x[i]), static_cast<long double>(y[i]))), 2.0);
+
+	table.pow(y.data(), x.data(), out.data(), size);
+	for (std::size_t i = 0; i < size; ++i)
+		ASSERT_LE(ulpError(out[i], std::pow(static_cast<long double>(y[i]), static_cast<long double>(x[i]))), 2.0);
+}
+
+}
+
+
+TEST(Kernels, ActiveLevelIsSupported) {
+	EXPECT_LE(vectra::kernels::activeLevel(), vectra::highestRuntimeSIMDLevel());
+	EXPECT_EQ(&vectra::kernels::table<float>(),  &vectra::kernels::table<float> (vectra::kernels::activeLevel()));
+	EXPECT_EQ(&vectra::kernels::table<double>(), &vectra::kernels::table<double>(vectra::kernels::activeLevel()));
+}
+
+TEST(Kernels, EveryLevelUpToHighest) {
+	for (SIMDLevel level : { SIMDLevel::None, SIMDLevel::SSE41, SIMDLevel::AVX, SIMDLevel::AVX2, SIMDLevel::AVX512 })
+	{
+		if (level > vectra::highestRuntimeSIMDLevel())
+			break;
+
+		checkTable(vectra::kernels::table<float> (level));
+		checkTable(vectra::kernels::table<double>(level));
+	}
+}
+
+TEST(Kernels, IntermediateLevelsFallBack) {
+	EXPECT_EQ(vectra::kernels::table<float>(SIMDLevel::SSE2).level,  SIMDLevel::None);
+	EXPECT_EQ(vectra::kernels::table<float>(SIMDLevel::SSE42).level, SIMDLevel::SSE41);
+}
+
+TEST(Kernels, DispatchedEntryPoints) {
+	std::vector<double> x(size, 0.5), out(size);
+	vectra::kernels::exp(x.data(), out.data(), size);
+	for (double v : out)
+		EXPECT_NEAR(v, std::exp(0.5), 1e-15);
+
+	// In place
+	vectra::kernels::log(out.data(), out.data(), size);
+	for (double v : out)
+		EXPECT_NEAR(v, 0.5, 1e-15);
+}
+
+#endif
+
+TEST(SIMDLevel, FromString) {
+	EXPECT_EQ(vectra::fromString("AVX2",   vectra::SIMDLevel::None), vectra::SIMDLevel::AVX2);
+	EXPECT_EQ(vectra::fromString("avx512", vectra::SIMDLevel::None), vectra::SIMDLevel::AVX512);
+	EXPECT_EQ(vectra::fromString("sse41",  vectra::SIMDLevel::None), vectra::SIMDLevel::SSE41);
+	EXPECT_EQ(vectra::fromString("none",   vectra::SIMDLevel::AVX),  vectra::SIMDLevel::None);
+	EXPECT_EQ(vectra::fromString("AVX",    vectra::SIMDLevel::None), vectra::SIMDLevel::AVX);
+	EXPECT_EQ(vectra::fromString("AVX3",   vectra::SIMDLevel::SSE),  vectra::SIMDLevel::SSE);
+	EXPECT_EQ(vectra::fromString("",       vectra::SIMDLevel::SSE),  vectra::SIMDLevel::SSE);
+	EXPECT_EQ(vectra::fromString(nullptr,  vectra::SIMDLevel::SSE2), vectra::SIMDLevel::SSE2);
+}
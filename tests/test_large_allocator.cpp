@@ -0,0 +1,95 @@
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+
+namespace
+{
+
+std::size_t alignmentOf(const void* p)
+{
+	const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(p);
+	return address & (~address + 1);
+}
+
+void checkPolicy(vectra::large_buffer_policy policy)
+{
+	using allocator = vectra::large_allocator<float>;
+
+	// Large buffers are mapped, small ones come from operator new
+	for (std::size_t n : { std::size_t(100), std::size_t(1) << 19, (std::size_t(3) << 20) + 5 })
+	{
+		std::vector<float, allocator> x(n, 1.f, allocator(policy));
+		const bool large = n * sizeof(float) >= vectra::huge_page_size;
+
+		EXPECT_GE(alignmentOf(x.data()), vectra::max_simd_alignment);
+#if defined(__linux__)
+		if (large && policy.pages != vectra::page_size::standard)
+		{
+			EXPECT_GE(alignmentOf(x.data()), vectra::huge_page_size);
+		}
+#endif
+
+		vectra::transform(vectra::execution::parallel, x.data(), x.data(), n, [](auto v) { return v + v; });
+		EXPECT_EQ(vectra::sum(x.data(), n), float(2 * n)) << "n = " << n << ", large = " << large;
+	}
+}
+
+}
+
+TEST(LargeAllocator, PagePolicies)
+{
+	checkPolicy({ vectra::page_size::standard,         vectra::numa_placement::none,        0 });
+	checkPolicy({ vectra::page_size::transparent_huge, vectra::numa_placement::first_touch, 0 });
+	checkPolicy({ vectra::page_size::explicit_huge,    vectra::numa_placement::none,        0 });
+}
+
+TEST(LargeAllocator, NumaPlacements)
+{
+	checkPolicy({ vectra::page_size::transparent_huge, vectra::numa_placement::bind, 0 });
+
+	// Nodes that do not exist leave the default placement
+	checkPolicy({ vectra::page_size::transparent_huge, vectra::numa_placement::bind, 63 });
+	checkPolicy({ vectra::page_size::standard,         vectra::numa_placement::bind, -1 });
+}
+
+TEST(LargeAllocator, RawBuffers)
+{
+	const std::size_t bytes = (std::size_t(5) << 20) + 123;
+
+	void* p = vectra::allocate_large(bytes);
+	static_cast<char*>(p)[0]         = 1;
+	static_cast<char*>(p)[bytes - 1] = 2;
+	vectra::deallocate_large(p, bytes);
+
+	vectra::deallocate_large(nullptr, bytes);
+}
+
+TEST(LargeAllocator, EqualityAndPropagation)
+{
+	using allocator = vectra::large_allocator<double>;
+
+	const vectra::large_buffer_policy standard{ vectra::page_size::standard, vectra::numa_placement::none, 0 };
+
+	EXPECT_EQ(allocator(), allocator());
+	EXPECT_EQ(allocator(), vectra::large_allocator<float>());
+	EXPECT_NE(allocator(), allocator(standard));
+
+	// Only bound placements depend on the node
+	EXPECT_EQ(allocator({ vectra::page_size::standard, vectra::numa_placement::none, 1 }), allocator(standard));
+	EXPECT_NE(allocator({ vectra::page_size::standard, vectra::numa_placement::bind, 1 }),
+	          allocator({ vectra::page_size::standard, vectra::numa_placement::bind, 0 }));
+
+	std::vector<double, allocator> x(1 << 20, 1., allocator(standard));
+	std::vector<double, allocator> y(1 << 20, 2.);
+
+	const double* data = x.data();
+	y = std::move(x);
+	EXPECT_EQ(y.data(), data);
+	EXPECT_EQ(y.get_allocator(), allocator(standard));
+}
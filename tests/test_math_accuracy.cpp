@@ -0,0 +1,158 @@
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+#include "ulp.hpp"
+
+
+namespace
+{
+
+using vectra::test::ulpError;
+
+enum class function { sin, cos, exp, exp2, log, log2 };
+
+template <typename Policy, typename Vct>
+Vct evaluate(function f, Vct x)
+{
+	switch (f)
+	{
+	case function::sin:  return Vct::template sin <Policy>(x);
+	case function::cos:  return Vct::template cos <Policy>(x);
+	case function::exp:  return Vct::template exp <Policy>(x);
+	case function::exp2: return Vct::template exp2<Policy>(x);
+	case function::log:  return Vct::template log <Policy>(x);
+	default:             return Vct::template log2<Policy>(x);
+	}
+}
+
+long double reference(function f, long double x)
+{
+	switch (f)
+	{
+	case function::sin:  return std::sin(x);
+	case function::cos:  return std::cos(x);
+	case function::exp:  return std::exp(x);
+	case function::exp2: return std::exp2(x);
+	case function::log:  return std::log(x);
+	default:             return std::log2(x);
+	}
+}
+
+// Maximum relative error (fast) or ULP error (balanced) of a policy
+// on random arguments of [lo ; hi], or of [2^lo ; 2^hi] for logs
+template <typename T, vectra::SIMDLevel level, typename Policy>
+void checkPolicy(function f, T lo, T hi, double maxUlp, double maxRelative)
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	const bool logarithm = f == function::log || f == function::log2;
+
+	std::mt19937 generator(11);
+	std::uniform_real_distribution<T> distribution(lo, hi);
+
+	alignas(64) T input[vct::width()];
+	alignas(64) T out[vct::width()];
+
+	for (int i = 0; i < 20000; ++i)
+	{
+		for (std::size_t k = 0; k < vct::width(); ++k)
+			input[k] = logarithm ? std::exp2(distribution(generator)) : distribution(generator);
+
+		vct::backend::unloadu(out, evaluate<Policy>(f, vct::loadu(input)).value);
+
+		for (std::size_t k = 0; k < vct::width(); ++k)
+		{
+			const long double r = reference(f, input[k]);
+			if (maxUlp > 0)
+			{
+				ASSERT_LE(ulpError(out[k], r), maxUlp) << "f = " << int(f) << ", x = " << input[k];
+			}
+			if (maxRelative > 0 && r != 0)
+			{
+				ASSERT_LE(std::fabs((out[k] - r) / r), maxRelative) << "f = " << int(f) << ", x = " << input[k];
+			}
+		}
+	}
+}
+
+template <typename T, vectra::SIMDLevel level, typename Policy>
+void checkSpecialValues()
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+
+	const auto first = [](vct v) {
+		alignas(64) T out[vct::width()];
+		vct::backend::unloadu(out, v.value);
+		return out[0];
+	};
+
+	EXPECT_EQ(first(vct::template exp <Policy>(vct(-inf))),   T(0));
+	EXPECT_EQ(first(vct::template exp <Policy>(vct(inf))),    inf);
+	EXPECT_EQ(first(vct::template exp <Policy>(vct(T(0)))),   T(1));
+	EXPECT_EQ(first(vct::template exp2<Policy>(vct(T(3)))),   T(8));
+	EXPECT_EQ(first(vct::template log <Policy>(vct(T(0)))),   -inf);
+	EXPECT_EQ(first(vct::template log <Policy>(vct(inf))),    inf);
+	EXPECT_EQ(first(vct::template log <Policy>(vct(T(1)))),   T(0));
+	EXPECT_EQ(first(vct::template log2<Policy>(vct(T(8)))),   T(3));
+	EXPECT_TRUE(std::isnan(first(vct::template log<Policy>(vct(T(-1))))));
+	EXPECT_TRUE(std::isnan(first(vct::template sin<Policy>(vct(inf)))));
+	EXPECT_TRUE(std::isnan(first(vct::template cos<Policy>(vct(nan)))));
+	EXPECT_TRUE(std::isnan(first(vct::template exp<Policy>(vct(nan)))));
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkPolicies()
+{
+	using vectra::accuracy::fast;
+	using vectra::accuracy::balanced;
+	using vectra::accuracy::precise;
+
+	constexpr bool single = sizeof(T) == 4;
+
+	const T expRange  = single ? T(87) : T(700);
+	const T trigRange = single ? T(8192) : T(1e6);
+
+	// fast: relative error below 2^-12
+	const double fastBound = std::ldexp(1., -12);
+	checkPolicy<T, level, fast>(function::sin,  -trigRange, trigRange, 0, fastBound);
+	checkPolicy<T, level, fast>(function::cos,  -trigRange, trigRange, 0, fastBound);
+	checkPolicy<T, level, fast>(function::exp,  -expRange,  expRange,  0, fastBound);
+	checkPolicy<T, level, fast>(function::exp2, -expRange,  expRange,  0, fastBound);
+	checkPolicy<T, level, fast>(function::log,  -expRange,  expRange,  0, fastBound);
+	checkPolicy<T, level, fast>(function::log2, -expRange,  expRange,  0, fastBound);
+
+	// balanced: 4 ULP
+	checkPolicy<T, level, balanced>(function::sin,  -trigRange, trigRange, 4, 0);
+	checkPolicy<T, level, balanced>(function::cos,  -trigRange, trigRange, 4, 0);
+	checkPolicy<T, level, balanced>(function::exp,  -expRange,  expRange,  4, 0);
+	checkPolicy<T, level, balanced>(function::exp2, -expRange,  expRange,  4, 0);
+	checkPolicy<T, level, balanced>(function::log,  -expRange,  expRange,  4, 0);
+	checkPolicy<T, level, balanced>(function::log2, -expRange,  expRange,  4, 0);
+
+	// precise: the default functions
+	checkPolicy<T, level, precise>(function::sin, -T(3.14), T(3.14), 2, 0);
+	checkPolicy<T, level, precise>(function::exp, -expRange, expRange, 1.1, 0);
+	checkPolicy<T, level, precise>(function::log, -expRange, expRange, 1, 0);
+
+	checkSpecialValues<T, level, fast>();
+	checkSpecialValues<T, level, balanced>();
+	checkSpecialValues<T, level, precise>();
+}
+
+}
+
+
+VECTRA_LEVEL_TEST_SUITE(MathAccuracy, vectra::test::Levels);
+
+TYPED_TEST(MathAccuracy, Float)  { checkPolicies<float,  TypeParam::value>(); }
+TYPED_TEST(MathAccuracy, Double) { checkPolicies<double, TypeParam::value>(); }
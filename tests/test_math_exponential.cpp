@@ -0,0 +1,125 @@
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+#include "ulp.hpp"
+
+
+namespace
+{
+
+using vectra::test::ulpError;
+
+// Sweeps random arguments, drawn uniformly in [lo ; hi], or as 2^u
+// with u uniform in [lo ; hi] when logScale is set, and checks the
+// vectorized function against the long double reference.
+template <typename T, vectra::SIMDLevel level, typename Function, typename Reference>
+void checkUnary(Function function, Reference reference, T lo, T hi, bool logScale, double maxUlp)
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<T> distribution(lo, hi);
+
+	alignas(64) T input [vct::width()];
+	alignas(64) T output[vct::width()];
+
+	for (int i = 0; i < 20000; ++i)
+	{
+		for (std::size_t k = 0; k < vct::width(); ++k)
+			input[k] = logScale ? std::exp2(distribution(generator)) : distribution(generator);
+
+		vct::backend::unloadu(output, function(vct::loadu(input)).value);
+
+		for (std::size_t k = 0; k < vct::width(); ++k)
+			ASSERT_LE(ulpError(output[k], reference(static_cast<long double>(input[k]))), maxUlp) << "x = " << input[k];
+	}
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkFamily()
+{
+	using vct = vectra::Vectratype<T, level>;
+	constexpr bool single = sizeof(T) == 4;
+
+	const T expLo  = single ? T(-104)  : T(-746);
+	const T expHi  = single ? T(88.7)  : T(709.7);
+	const T log2Lo = single ? T(-149)  : T(-1074);
+	const T log2Hi = single ? T(127.9) : T(1023.9);
+
+	checkUnary<T, level>([](vct x) { return vct::exp  (x); }, [](long double x) { return std::exp  (x); }, expLo, expHi, false, 1.1);
+	checkUnary<T, level>([](vct x) { return vct::exp2 (x); }, [](long double x) { return std::exp2 (x); }, log2Lo, log2Hi, false, 1.1);
+	checkUnary<T, level>([](vct x) { return vct::expm1(x); }, [](long double x) { return std::expm1(x); }, T(-1), T(1), false, 2.0);
+	checkUnary<T, level>([](vct x) { return vct::expm1(x); }, [](long double x) { return std::expm1(x); }, expLo, expHi, false, 2.0);
+	checkUnary<T, level>([](vct x) { return vct::log  (x); }, [](long double x) { return std::log  (x); }, log2Lo, log2Hi, true, 1.0);
+	checkUnary<T, level>([](vct x) { return vct::log2 (x); }, [](long double x) { return std::log2 (x); }, log2Lo, log2Hi, true, 1.0);
+	checkUnary<T, level>([](vct x) { return vct::log1p(x); }, [](long double x) { return std::log1p(x); }, T(-0.999), T(10), false, 1.0);
+	checkUnary<T, level>([](vct x) { return vct::log1p(x); }, [](long double x) { return std::log1p(x); }, log2Lo, log2Hi, true, 1.0);
+	checkUnary<T, level>([](vct x) { return vct::cbrt (x); }, [](long double x) { return std::cbrt (x); }, log2Lo, log2Hi, true, 1.0);
+	checkUnary<T, level>([](vct x) { return vct::cbrt (x); }, [](long double x) { return std::cbrt (x); }, T(-100), T(100), false, 1.0);
+
+	// pow with a fixed base, and with a fixed exponent
+	checkUnary<T, level>([](vct y) { return vct::pow(vct(T(1.37)), y); }, [](long double y) { return std::pow(static_cast<long double>(T(1.37)), y); }, T(-100), T(100), false, single ? 2.5 : 2.0);
+	checkUnary<T, level>([](vct x) { return vct::pow(x, vct(T(2.5))); }, [](long double x) { return std::pow(x, 2.5L); }, T(0), T(1000), false, 2.0);
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkSpecialValues()
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+
+	const auto first = [](vct v) {
+		alignas(64) T out[vct::width()];
+		vct::backend::unloadu(out, v.value);
+		return out[0];
+	};
+
+	EXPECT_EQ(first(vct::exp  (vct(-inf))), T(0));
+	EXPECT_EQ(first(vct::exp  (vct( inf))), inf);
+	EXPECT_EQ(first(vct::exp2 (vct(T(10)))), T(1024));
+	EXPECT_EQ(first(vct::expm1(vct(-inf))), T(-1));
+	EXPECT_TRUE(std::signbit(first(vct::expm1(vct(T(-0.))))));
+
+	EXPECT_EQ(first(vct::log  (vct(T(0)))), -inf);
+	EXPECT_EQ(first(vct::log  (vct(inf))),   inf);
+	EXPECT_TRUE(std::isnan(first(vct::log(vct(T(-1))))));
+	EXPECT_TRUE(std::isnan(first(vct::log(vct(nan)))));
+	EXPECT_EQ(first(vct::log2 (vct(T(0.125)))), T(-3));
+	EXPECT_EQ(first(vct::log1p(vct(T(-1)))), -inf);
+	EXPECT_TRUE(std::signbit(first(vct::log1p(vct(T(-0.))))));
+
+	EXPECT_EQ(first(vct::cbrt(vct(T(-27)))), T(-3));
+	EXPECT_EQ(first(vct::cbrt(vct(-inf))), -inf);
+	EXPECT_TRUE(std::signbit(first(vct::cbrt(vct(T(-0.))))));
+
+	EXPECT_EQ(first(vct::pow(vct(T(-2)),  vct(T(3)))),  T(-8));
+	EXPECT_EQ(first(vct::pow(vct(T(-2)),  vct(T(-2)))), T(0.25));
+	EXPECT_EQ(first(vct::pow(vct(T(-1)),  vct(inf))),   T(1));
+	EXPECT_EQ(first(vct::pow(vct(T(1)),   vct(nan))),   T(1));
+	EXPECT_EQ(first(vct::pow(vct(nan),    vct(T(0)))),  T(1));
+	EXPECT_EQ(first(vct::pow(vct(T(-0.)), vct(T(-3)))), -inf);
+	EXPECT_EQ(first(vct::pow(vct(T(0.5)), vct(inf))),   T(0));
+	EXPECT_EQ(first(vct::pow(vct(T(2)),   vct(inf))),   inf);
+	EXPECT_TRUE(std::isnan(first(vct::pow(vct(T(-8)), vct(T(1) / T(3))))));
+}
+
+}
+
+VECTRA_LEVEL_TEST_SUITE(MathExponential, vectra::test::SIMDLevels);
+
+TYPED_TEST(MathExponential, Float)          { checkFamily<float,  TypeParam::value>(); }
+TYPED_TEST(MathExponential, Double)         { checkFamily<double, TypeParam::value>(); }
+TYPED_TEST(MathExponential, SpecialValues)
+{
+	checkSpecialValues<float,  TypeParam::value>();
+	checkSpecialValues<double, TypeParam::value>();
+}
@@ -0,0 +1,140 @@
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+#include "ulp.hpp"
+
+
+namespace
+{
+
+using vectra::test::ulpError;
+
+template <typename T, vectra::SIMDLevel level>
+void checkUnary(T lo, T hi, double maxUlp)
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<T> distribution(lo, hi);
+
+	alignas(64) T input[vct::width()];
+	alignas(64) T asins[vct::width()];
+	alignas(64) T acoss[vct::width()];
+	alignas(64) T atans[vct::width()];
+
+	for (int i = 0; i < 20000; ++i)
+	{
+		for (std::size_t k = 0; k < vct::width(); ++k)
+			input[k] = distribution(generator);
+
+		const vct x = vct::loadu(input);
+		vct::backend::unloadu(asins, vct::asin(x).value);
+		vct::backend::unloadu(acoss, vct::acos(x).value);
+		vct::backend::unloadu(atans, vct::atan(x).value);
+
+		for (std::size_t k = 0; k < vct::width(); ++k)
+		{
+			const long double reference = input[k];
+			if (std::fabs(input[k]) <= T(1))
+			{
+				ASSERT_LE(ulpError(asins[k], std::asin(reference)), maxUlp) << "asin(" << input[k] << ")";
+				ASSERT_LE(ulpError(acoss[k], std::acos(reference)), maxUlp) << "acos(" << input[k] << ")";
+			}
+			ASSERT_LE(ulpError(atans[k], std::atan(reference)), maxUlp) << "atan(" << input[k] << ")";
+		}
+	}
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkAtan2(T range, double maxUlp)
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	std::mt19937 generator(7);
+	std::uniform_real_distribution<T> distribution(-range, range);
+
+	alignas(64) T ys[vct::width()];
+	alignas(64) T xs[vct::width()];
+	alignas(64) T out[vct::width()];
+
+	for (int i = 0; i < 20000; ++i)
+	{
+		for (std::size_t k = 0; k < vct::width(); ++k)
+		{
+			ys[k] = distribution(generator);
+			xs[k] = distribution(generator);
+		}
+
+		vct::backend::unloadu(out, vct::atan2(vct::loadu(ys), vct::loadu(xs)).value);
+
+		for (std::size_t k = 0; k < vct::width(); ++k)
+			ASSERT_LE(ulpError(out[k], std::atan2(static_cast<long double>(ys[k]), static_cast<long double>(xs[k]))), maxUlp)
+				<< "atan2(" << ys[k] << ", " << xs[k] << ")";
+	}
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkSpecialValues()
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+
+	const auto first = [](vct v) {
+		alignas(64) T out[vct::width()];
+		vct::backend::unloadu(out, v.value);
+		return out[0];
+	};
+
+	EXPECT_TRUE(std::signbit(first(vct::asin(vct(T(-0.))))));
+	EXPECT_TRUE(std::signbit(first(vct::atan(vct(T(-0.))))));
+	EXPECT_EQ(first(vct::asin(vct(T(1)))),  static_cast<T>(std::asin(1.L)));
+	EXPECT_EQ(first(vct::acos(vct(T(1)))),  T(0));
+	EXPECT_EQ(first(vct::acos(vct(T(-1)))), static_cast<T>(std::acos(-1.L)));
+	EXPECT_EQ(first(vct::atan(vct(-inf))),  static_cast<T>(-std::atan(1.L) * 2));
+	EXPECT_TRUE(std::isnan(first(vct::asin(vct(T(1.5))))));
+	EXPECT_TRUE(std::isnan(first(vct::acos(vct(T(-1.5))))));
+	EXPECT_TRUE(std::isnan(first(vct::atan(vct(nan)))));
+
+	const T pi = static_cast<T>(std::acos(-1.L));
+
+	const auto atan2 = [&](T y, T x) { return first(vct::atan2(vct(y), vct(x))); };
+	EXPECT_TRUE (atan2(T( 0.), T( 0.)) == T(0) && !std::signbit(atan2(T(0.), T(0.))));
+	EXPECT_TRUE (atan2(T(-0.), T( 0.)) == T(0) &&  std::signbit(atan2(T(-0.), T(0.))));
+	EXPECT_EQ   (atan2(T( 0.), T(-0.)),  pi);
+	EXPECT_EQ   (atan2(T(-0.), T(-0.)), -pi);
+	EXPECT_EQ   (atan2(T(-0.), T(-1.)), -pi);
+	EXPECT_EQ   (atan2(T( 1.), -inf),    pi);
+	EXPECT_EQ   (atan2(T( 1.),  inf),    T(0));
+	EXPECT_EQ   (atan2(-inf,   T(3.)),   static_cast<T>(-std::atan(1.L) * 2));
+	EXPECT_EQ   (atan2( inf,    inf),    static_cast<T>( std::atan(1.L)));
+	EXPECT_EQ   (atan2(-inf,   -inf),    static_cast<T>(-std::atan(1.L) * 3));
+	EXPECT_TRUE (std::isnan(atan2(nan, T(1.))));
+	EXPECT_TRUE (std::isnan(atan2(T(1.), nan)));
+	EXPECT_TRUE (std::isnan(atan2(T( 0.), nan)));
+	EXPECT_TRUE (std::isnan(atan2(T(-0.), nan)));
+	EXPECT_TRUE (std::isnan(atan2(nan,    T(0.))));
+	EXPECT_TRUE (std::isnan(atan2( inf,   nan)));
+	EXPECT_TRUE (std::isnan(atan2(nan,   -inf)));
+	EXPECT_TRUE (std::isnan(atan2(nan,    nan)));
+}
+
+}
+
+VECTRA_LEVEL_TEST_SUITE(MathInverseTrigonometric, vectra::test::SIMDLevels);
+
+TYPED_TEST(MathInverseTrigonometric, Float)  { checkUnary<float,  TypeParam::value>(-4.f, 4.f, 1.1); checkAtan2<float,  TypeParam::value>(100.f, 2.0); }
+TYPED_TEST(MathInverseTrigonometric, Double) { checkUnary<double, TypeParam::value>(-4.,  4.,  1.1); checkAtan2<double, TypeParam::value>(100.,  2.0); }
+TYPED_TEST(MathInverseTrigonometric, SpecialValues)
+{
+	checkSpecialValues<float,  TypeParam::value>();
+	checkSpecialValues<double, TypeParam::value>();
+}
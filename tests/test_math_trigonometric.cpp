@@ -0,0 +1,136 @@
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+#include "ulp.hpp"
+
+
+namespace
+{
+
+using vectra::test::ulpError;
+
+template <typename T, vectra::SIMDLevel level>
+void checkSinCos(T range, double maxUlp)
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<T> distribution(-range, range);
+
+	alignas(64) T input [vct::width()];
+	alignas(64) T sines [vct::width()];
+	alignas(64) T cosines[vct::width()];
+
+	for (int i = 0; i < 20000; ++i)
+	{
+		for (std::size_t k = 0; k < vct::width(); ++k)
+			input[k] = distribution(generator);
+
+		const vct x = vct::loadu(input);
+		vct::backend::unloadu(sines,   vct::sin(x).value);
+		vct::backend::unloadu(cosines, vct::cos(x).value);
+
+		for (std::size_t k = 0; k < vct::width(); ++k)
+		{
+			ASSERT_LE(ulpError(sines  [k], std::sin(static_cast<long double>(input[k]))), maxUlp) << "sin(" << input[k] << ")";
+			ASSERT_LE(ulpError(cosines[k], std::cos(static_cast<long double>(input[k]))), maxUlp) << "cos(" << input[k] << ")";
+		}
+	}
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkSpecialValues()
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	alignas(64) T out[vct::width()];
+
+	vct::backend::unloadu(out, vct::sin(vct(T(-0.))).value);
+	EXPECT_TRUE(out[0] == T(0) && std::signbit(out[0]));
+
+	vct::backend::unloadu(out, vct::cos(vct(T(0.))).value);
+	EXPECT_EQ(out[0], T(1));
+
+	vct::backend::unloadu(out, vct::sin(vct(std::numeric_limits<T>::infinity())).value);
+	EXPECT_TRUE(std::isnan(out[0]));
+
+	vct::backend::unloadu(out, vct::cos(vct(std::numeric_limits<T>::quiet_NaN())).value);
+	EXPECT_TRUE(std::isnan(out[0]));
+}
+
+// Past the range of the vectorized reduction, up to the largest
+// finite values: lanes go through the standard library, and the
+// other lanes of the register are unchanged. Same with the accuracy
+// policies, which share the reduction.
+template <typename T, vectra::SIMDLevel level>
+void checkLargeArguments()
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	constexpr std::size_t w = vct::width();
+
+	const T large[] = { T(1e4), T(-3e5), T(1e7) * T(1.5), T(1e10), T(-1e10), T(1e20), T(1e30), T(-1e38),
+	                    std::numeric_limits<T>::max(), -std::numeric_limits<T>::max(), T(std::ldexp(T(1), 60)), T(12345.678) };
+
+	alignas(64) T input[w];
+	alignas(64) T out[w];
+
+	const auto check = [&](vct y, auto reference, const char* name)
+	{
+		vct::backend::unloadu(out, y.value);
+		for (std::size_t k = 0; k < w; ++k)
+			ASSERT_LE(ulpError(out[k], reference(static_cast<long double>(input[k]))), 2.5) << name << "(" << input[k] << ")";
+	};
+
+	for (std::size_t i = 0; i < std::size(large); ++i)
+	{
+		// Large arguments in every other lane, next to small ones
+		for (std::size_t k = 0; k < w; ++k)
+			input[k] = k % 2 ? T(0.5) * T(k) : large[(i + k) % std::size(large)];
+
+		const vct x = vct::loadu(input);
+		const auto sinl = [](long double v) { return std::sin(v); };
+		const auto cosl = [](long double v) { return std::cos(v); };
+
+		check(vct::sin(x), sinl, "sin");
+		check(vct::cos(x), cosl, "cos");
+		check(vct::template sin<vectra::accuracy::balanced>(x), sinl, "balanced sin");
+		check(vct::template cos<vectra::accuracy::balanced>(x), cosl, "balanced cos");
+
+		// The fast policy is accurate to 2^-12 only, but its large lanes
+		// are computed by the standard library as well
+		vct::backend::unloadu(out, vct::template sin<vectra::accuracy::fast>(x).value);
+		for (std::size_t k = 0; k < w; ++k)
+		{
+			if (std::fabs(input[k]) > vectra::math::detail::sincos_constants<T>::reduction_limit)
+			{
+				ASSERT_LE(ulpError(out[k], sinl(static_cast<long double>(input[k]))), 1.0) << "fast sin(" << input[k] << ")";
+			}
+		}
+	}
+}
+
+}
+
+VECTRA_LEVEL_TEST_SUITE(MathTrigonometric, vectra::test::SIMDLevels);
+
+TYPED_TEST(MathTrigonometric, SinCosFloat)  { checkSinCos<float,  TypeParam::value>(8192.f, 2.5); }
+TYPED_TEST(MathTrigonometric, SinCosDouble) { checkSinCos<double, TypeParam::value>(1e7,    2.0); }
+TYPED_TEST(MathTrigonometric, SpecialValues)
+{
+	checkSpecialValues<float,  TypeParam::value>();
+	checkSpecialValues<double, TypeParam::value>();
+}
+TYPED_TEST(MathTrigonometric, LargeArguments)
+{
+	checkLargeArguments<float,  TypeParam::value>();
+	checkLargeArguments<double, TypeParam::value>();
+}
@@ -0,0 +1,171 @@
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+
+
+namespace
+{
+
+template <typename T>
+using aligned_vector = std::vector<T, vectra::aligned_allocator<T>>;
+
+template <typename T, vectra::SIMDLevel level>
+void checkChunks()
+{
+	vectra::thread_pool pool(4);
+
+	constexpr std::size_t line = vectra::detail::cache_line;
+	const std::size_t w = vectra::ComputeBackend<T, level>::width();
+
+	aligned_vector<T> x(1 << 20);
+
+	// Shifted starts, so that the first chunk has a head
+	for (std::size_t offset : { 0, 1, 3 })
+	for (std::size_t n : { std::size_t(0), std::size_t(1), std::size_t(1000), std::size_t(40000), x.size() - offset })
+	{
+		const T* data = x.data() + offset;
+
+		std::vector<std::atomic<int>> covered(n);
+		std::atomic<bool> aligned{ true };
+
+		vectra::parallel_for<level>(data, n, [&](std::size_t begin, std::size_t end)
+		{
+			if (begin != 0 && reinterpret_cast<std::uintptr_t>(data + begin) % line != 0)
+				aligned = false;
+			if (begin != 0 && end != n && (end - begin) % w != 0)
+				aligned = false;
+			for (std::size_t i = begin; i < end; ++i)
+				covered[i].fetch_add(1);
+		}, pool);
+
+		EXPECT_TRUE(aligned.load()) << "offset = " << offset << ", n = " << n;
+		for (std::size_t i = 0; i < n; ++i)
+			ASSERT_EQ(covered[i].load(), 1) << "offset = " << offset << ", n = " << n << ", i = " << i;
+	}
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkAlgorithms()
+{
+	using vectra::execution;
+
+	const std::size_t n = 1000003;
+
+	aligned_vector<T> x(n), y(n), seq(n), par(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		x[i] = T((i * 7) % 13) - T(6);
+		y[i] = T(i % 5) * T(0.5);
+	}
+
+	// Same kernel on every element, whatever the chunk
+	auto op = [](auto a, auto b) { return decltype(a)::exp(a * decltype(a)(T(0.1))) + b; };
+	vectra::transform<level>(x.data(), y.data(), seq.data(), n, op);
+	vectra::transform<level>(execution::parallel, x.data(), y.data(), par.data(), n, op);
+	for (std::size_t i = 0; i < n; ++i)
+		ASSERT_EQ(par[i], seq[i]) << "i = " << i;
+
+	// Unaligned arrays take the unaligned path in every chunk
+	vectra::transform<level>(execution::parallel, x.data() + 1, par.data() + 1, n - 1, [](auto a) { return a * a; });
+	for (std::size_t i = 1; i < n; ++i)
+		ASSERT_EQ(par[i], x[i] * x[i]) << "i = " << i;
+
+	// Small integers and halves: every partial sum is exact
+	T sum = 0, dot = 0;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		sum += x[i];
+		dot += x[i] * y[i];
+	}
+
+	EXPECT_EQ(vectra::sum<level>(execution::parallel, x.data(), n), sum);
+	EXPECT_EQ(vectra::sum<level>(execution::parallel, x.data(), n, vectra::accumulation::compensated), sum);
+	EXPECT_EQ(vectra::dot<level>(execution::parallel, x.data(), y.data(), n), dot);
+	EXPECT_EQ(vectra::dot<level>(execution::parallel, x.data(), y.data(), n, vectra::accumulation::compensated), dot);
+	EXPECT_EQ(vectra::norm<level>(execution::sequential, x.data(), n), vectra::norm<level>(x.data(), n));
+
+	// Extrema placed far from the start, after NaN only chunks
+	for (std::size_t i = 0; i < 100000; ++i)
+		x[i] = std::numeric_limits<T>::quiet_NaN();
+	x[700001] = T(-50);
+	x[800001] = T(-50);
+	x[900001] = T(50);
+
+	EXPECT_EQ(vectra::min<level>(execution::parallel, x.data(), n), T(-50));
+	EXPECT_EQ(vectra::max<level>(execution::parallel, x.data(), n), T(50));
+	EXPECT_EQ(vectra::argmin<level>(execution::parallel, x.data(), n), std::size_t(700001));
+	EXPECT_EQ(vectra::argmax<level>(execution::parallel, x.data(), n), std::size_t(900001));
+
+	for (std::size_t i = 0; i < n; ++i)
+		x[i] = std::numeric_limits<T>::quiet_NaN();
+	EXPECT_EQ(vectra::argmin<level>(execution::parallel, x.data(), n), n);
+	EXPECT_EQ(vectra::min<level>(execution::parallel, x.data(), n), std::numeric_limits<T>::infinity());
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkAll()
+{
+	checkChunks<T, level>();
+	checkAlgorithms<T, level>();
+}
+
+}
+
+TEST(ThreadPool, RunsEveryTaskOnce)
+{
+	for (std::size_t threads : { 1, 2, 3, 8 })
+	{
+		vectra::thread_pool pool(threads);
+		EXPECT_EQ(pool.size(), threads);
+
+		for (std::size_t tasks : { 0, 1, 2, 7, 100, 1000 })
+		{
+			std::vector<std::atomic<int>> calls(tasks);
+			pool.run(tasks, [&](std::size_t i) { calls[i].fetch_add(1); });
+
+			for (std::size_t i = 0; i < tasks; ++i)
+				ASSERT_EQ(calls[i].load(), 1) << "threads = " << threads << ", tasks = " << tasks << ", i = " << i;
+		}
+	}
+}
+
+TEST(ThreadPool, NestedRuns)
+{
+	vectra::thread_pool pool(4);
+
+	std::atomic<int> calls{ 0 };
+	pool.run(16, [&](std::size_t)
+	{
+		pool.run(16, [&](std::size_t) { calls.fetch_add(1); });
+	});
+	EXPECT_EQ(calls.load(), 256);
+}
+
+TEST(ThreadPool, ConcurrentCallers)
+{
+	vectra::thread_pool pool(4);
+
+	std::atomic<int> calls{ 0 };
+	std::vector<std::thread> callers;
+	for (int k = 0; k < 4; ++k)
+		callers.emplace_back([&] { for (int r = 0; r < 50; ++r) pool.run(20, [&](std::size_t) { calls.fetch_add(1); }); });
+	for (std::thread& caller : callers)
+		caller.join();
+
+	EXPECT_EQ(calls.load(), 4 * 50 * 20);
+}
+
+VECTRA_LEVEL_TEST_SUITE(Parallel, vectra::test::Levels);
+
+TYPED_TEST(Parallel, Float)  { checkAll<float,  TypeParam::value>(); }
+TYPED_TEST(Parallel, Double) { checkAll<double, TypeParam::value>(); }
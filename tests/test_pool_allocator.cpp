@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+
+TEST(PoolAllocator, BlocksAreAlignedAndRecycled)
+{
+	vectra::aligned_pool pool(40, 8);
+	EXPECT_EQ(pool.block_size(), 64u);
+
+	std::set<void*> blocks;
+	for (int i = 0; i < 20; ++i)
+	{
+		void* p = pool.allocate();
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % vectra::max_simd_alignment, 0u);
+		EXPECT_TRUE(blocks.insert(p).second);
+	}
+	EXPECT_EQ(pool.capacity(), 24u);
+
+	// The last block given back is the next one given out
+	void* p = *blocks.begin();
+	pool.deallocate(p);
+	EXPECT_EQ(pool.allocate(), p);
+
+	// After a reset, every block is available without a new chunk
+	pool.reset();
+	std::set<void*> again;
+	for (int i = 0; i < 24; ++i)
+		again.insert(pool.allocate());
+	EXPECT_EQ(again.size(), 24u);
+	EXPECT_TRUE(std::includes(again.begin(), again.end(), blocks.begin(), blocks.end()));
+	EXPECT_EQ(pool.capacity(), 24u);
+
+	pool.release();
+	EXPECT_EQ(pool.capacity(), 0u);
+}
+
+TEST(PoolAllocator, NodeContainers)
+{
+	vectra::aligned_pool pool(64);
+
+	{
+		std::list<double, vectra::pool_allocator<double>> l(pool);
+		std::map<int, float, std::less<int>, vectra::pool_allocator<std::pair<const int, float>>> m(pool);
+
+		for (int i = 0; i < 1000; ++i)
+		{
+			l.push_back(i);
+			m[i] = float(i) * 0.5f;
+		}
+
+		EXPECT_EQ(l.size(), 1000u);
+		EXPECT_EQ(m[999], 499.5f);
+		EXPECT_GE(pool.capacity(), 2000u);
+	}
+
+	// Bucket arrays fall back to operator new, nodes use the pool
+	const std::size_t capacity = pool.capacity();
+	std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, vectra::pool_allocator<std::pair<const int, int>>> u(16, std::hash<int>(), std::equal_to<int>(), pool);
+	for (int i = 0; i < 1000; ++i)
+		u[i] = i;
+	EXPECT_EQ(u.at(500), 500);
+	EXPECT_EQ(pool.capacity(), capacity);
+}
+
+TEST(PoolAllocator, EqualityAndPropagation)
+{
+	using allocator = vectra::pool_allocator<double>;
+
+	vectra::aligned_pool a(64), b(64);
+
+	EXPECT_EQ(allocator(a), allocator(a));
+	EXPECT_NE(allocator(a), allocator(b));
+	EXPECT_EQ(allocator(a), vectra::pool_allocator<float>(a));
+
+	std::list<double, allocator> x(10, 1., a);
+	std::list<double, allocator> y(20, 2., b);
+
+	y = std::move(x);
+	EXPECT_EQ(&y.get_allocator().pool(), &a);
+	EXPECT_EQ(y.size(), 10u);
+
+	std::list<double, allocator> z(5, 3., b);
+	y.swap(z);
+	EXPECT_EQ(&y.get_allocator().pool(), &b);
+	EXPECT_EQ(&z.get_allocator().pool(), &a);
+}
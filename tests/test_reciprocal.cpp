@@ -0,0 +1,138 @@
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+#include "ulp.hpp"
+
+
+namespace
+{
+
+using vectra::test::ulpError;
+
+// Relative error of the hardware estimates: 1.5 * 2^-12 for rcpps and
+// rsqrtps, 2^-14 for the AVX-512 rcp14 and rsqrt14
+template <vectra::SIMDLevel level>
+constexpr double estimateBound = level == vectra::SIMDLevel::AVX512 ? 0x1p-14 : 1.5 * 0x1p-12;
+
+template <typename T, typename Vct>
+T first(Vct v)
+{
+	alignas(64) T out[Vct::width()];
+	Vct::backend::unloadu(out, v.value);
+	return out[0];
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkReciprocals()
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	// The whole exponent range, beyond the float one for double, with
+	// subnormal arguments and results at both ends
+	constexpr T range = T(std::numeric_limits<T>::max_exponent - 1);
+
+	std::mt19937 generator(5);
+	std::uniform_real_distribution<T> exponent(-range, range);
+
+	alignas(64) T input[vct::width()];
+	alignas(64) T out[4][vct::width()];
+
+	const bool exact = level == vectra::SIMDLevel::None;
+
+	for (int i = 0; i < 20000; ++i)
+	{
+		for (std::size_t k = 0; k < vct::width(); ++k)
+			input[k] = std::exp2(exponent(generator));
+
+		const vct x = vct::loadu(input);
+		vct::backend::unloadu(out[0], vct::rcp(x).value);
+		vct::backend::unloadu(out[1], vct::rsqrt(x).value);
+		vct::backend::unloadu(out[2], vct::rcp_refined(x).value);
+		vct::backend::unloadu(out[3], vct::rsqrt_refined(x).value);
+
+		for (std::size_t k = 0; k < vct::width(); ++k)
+		{
+			const long double r = 1.0L / static_cast<long double>(input[k]);
+			const long double s = 1.0L / std::sqrt(static_cast<long double>(input[k]));
+
+			// The scalar backend is bit-exact with the division
+			if (exact)
+			{
+				ASSERT_EQ(out[0][k], T(1) / input[k]);
+				ASSERT_EQ(out[1][k], T(1) / std::sqrt(input[k]));
+			}
+			else
+			{
+				ASSERT_LE(std::fabs((out[0][k] - r) / r), estimateBound<level>) << "x = " << input[k];
+				ASSERT_LE(std::fabs((out[1][k] - s) / s), estimateBound<level>) << "x = " << input[k];
+			}
+
+			// One Newton step on a 12 bits estimate leaves float a few ULP
+			// short, the divisions being rounded once (rcp) or twice (rsqrt)
+			ASSERT_LE(ulpError(out[2][k], r), exact ? 0.5 : 3.0) << "x = " << input[k];
+			ASSERT_LE(ulpError(out[3][k], s), exact ? 1.5 : 4.0) << "x = " << input[k];
+		}
+	}
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkSpecialValues()
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	const T inf = std::numeric_limits<T>::infinity();
+
+	const T x = T(0);
+	EXPECT_EQ(first<T>(vct::rcp(vct(x))),           inf);
+	EXPECT_EQ(first<T>(vct::rsqrt(vct(x))),         inf);
+	EXPECT_EQ(first<T>(vct::rcp_refined(vct(x))),   inf);
+	EXPECT_EQ(first<T>(vct::rsqrt_refined(vct(x))), inf);
+
+	EXPECT_EQ(first<T>(vct::rcp_refined(vct(-x))), -inf);
+
+	EXPECT_EQ(first<T>(vct::rcp_refined(vct(inf))),   T(0));
+	EXPECT_EQ(first<T>(vct::rsqrt_refined(vct(inf))), T(0));
+
+	EXPECT_TRUE(std::isnan(first<T>(vct::rsqrt_refined(vct(T(-1))))));
+
+	// Subnormal arguments are not read as zeros
+	const T tiny = std::numeric_limits<T>::denorm_min();
+	EXPECT_LE(ulpError(first<T>(vct::rsqrt_refined(vct(tiny))), 1.0L / std::sqrt(static_cast<long double>(tiny))), 4.0);
+	EXPECT_EQ(first<T>(vct::rcp_refined(vct(tiny))), inf);
+	EXPECT_EQ(first<T>(vct::rcp_refined(vct(-std::numeric_limits<T>::max()))), T(-1) / std::numeric_limits<T>::max());
+	EXPECT_TRUE(std::isnan(first<T>(vct::rcp_refined(vct(std::numeric_limits<T>::quiet_NaN())))));
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkPolicies()
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	const vct x(T(3));
+	EXPECT_EQ(first<T>(vct::template rcp  <vectra::accuracy::precise>(x)), T(1) / T(3));
+	EXPECT_EQ(first<T>(vct::template rsqrt<vectra::accuracy::precise>(x)), T(1) / std::sqrt(T(3)));
+	EXPECT_EQ(first<T>(vct::template rcp  <vectra::accuracy::balanced>(x)), first<T>(vct::rcp_refined(x)));
+	EXPECT_EQ(first<T>(vct::template rsqrt<vectra::accuracy::fast>(x)), first<T>(vct::rsqrt(x)));
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkAll()
+{
+	checkReciprocals<T, level>();
+	checkSpecialValues<T, level>();
+	checkPolicies<T, level>();
+}
+
+}
+
+VECTRA_LEVEL_TEST_SUITE(Reciprocal, vectra::test::Levels);
+
+TYPED_TEST(Reciprocal, Float)  { checkAll<float,  TypeParam::value>(); }
+TYPED_TEST(Reciprocal, Double) { checkAll<double, TypeParam::value>(); }
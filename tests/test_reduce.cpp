@@ -0,0 +1,111 @@
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+
+
+namespace
+{
+
+template <typename T, vectra::SIMDLevel level>
+void checkSizes()
+{
+	for (std::size_t n = 0; n <= 131; ++n)
+	{
+		std::vector<T> x(n), y(n);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			x[i] = T((i * 7) % 13) - T(6);
+			y[i] = T(i % 5) * T(0.5);
+		}
+
+		// Small integers and halves: every partial sum is exact
+		T sum = 0, dot = 0, lo = std::numeric_limits<T>::infinity(), hi = -std::numeric_limits<T>::infinity();
+		std::size_t argLo = n, argHi = n;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			sum += x[i];
+			dot += x[i] * y[i];
+			if (x[i] < lo) { lo = x[i]; argLo = i; }
+			if (x[i] > hi) { hi = x[i]; argHi = i; }
+		}
+
+		ASSERT_EQ(vectra::sum<level>(x.data(), n), sum) << "n = " << n;
+		ASSERT_EQ(vectra::sum<level>(x.data(), n, vectra::accumulation::compensated), sum) << "n = " << n;
+		ASSERT_EQ(vectra::dot<level>(x.data(), y.data(), n), dot) << "n = " << n;
+		ASSERT_EQ(vectra::dot<level>(x.data(), y.data(), n, vectra::accumulation::compensated), dot) << "n = " << n;
+		ASSERT_EQ(vectra::min<level>(x.data(), n), lo) << "n = " << n;
+		ASSERT_EQ(vectra::max<level>(x.data(), n), hi) << "n = " << n;
+		ASSERT_EQ(vectra::argmin<level>(x.data(), n), argLo) << "n = " << n;
+		ASSERT_EQ(vectra::argmax<level>(x.data(), n), argHi) << "n = " << n;
+	}
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkCompensated()
+{
+	// Ill-conditioned sum: large values cancel, leaving the small ones
+	std::vector<T> x;
+	for (int i = 0; i < 1000; ++i)
+	{
+		x.push_back(T(1) / std::numeric_limits<T>::epsilon());
+		x.push_back(T(1));
+		x.push_back(-T(1) / std::numeric_limits<T>::epsilon());
+	}
+
+	EXPECT_EQ(vectra::sum<level>(x.data(), x.size(), vectra::accumulation::compensated), T(1000));
+
+	// Dot2 recovers the product error: (1 + e)(1 - e) - 1 = -e^2,
+	// with e^2 too small for 1 - e^2 to be representable
+	const T e = std::ldexp(T(1), -(std::numeric_limits<T>::digits / 2 + 2));
+	std::vector<T> a = { T(1) + e, T(-1) }, b = { T(1) - e, T(1) };
+	EXPECT_EQ(vectra::dot<level>(a.data(), b.data(), a.size(), vectra::accumulation::compensated), -e * e);
+
+	std::vector<T> v = { T(3), T(4), T(12) };
+	EXPECT_EQ(vectra::norm<level>(v.data(), v.size()), T(13));
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkArg()
+{
+	// Extrema in a late block, with ties and NaN elements
+	std::vector<T> x(5000, T(1));
+	x[10]   = std::numeric_limits<T>::quiet_NaN();
+	x[3000] = T(-2);
+	x[4000] = T(-2);
+	x[4500] = T(7);
+	x[4999] = T(7);
+
+	EXPECT_EQ(vectra::argmin<level>(x.data(), x.size()), 3000u);
+	EXPECT_EQ(vectra::argmax<level>(x.data(), x.size()), 4500u);
+	EXPECT_EQ(vectra::min   <level>(x.data(), x.size()), T(-2));
+	EXPECT_EQ(vectra::max   <level>(x.data(), x.size()), T(7));
+
+	std::vector<T> nan(2100, std::numeric_limits<T>::quiet_NaN());
+	EXPECT_EQ(vectra::argmin<level>(nan.data(), nan.size()), nan.size());
+	nan[2050] = std::numeric_limits<T>::infinity();
+	EXPECT_EQ(vectra::argmin<level>(nan.data(), nan.size()), 2050u);
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkAll()
+{
+	checkSizes<T, level>();
+	checkCompensated<T, level>();
+	checkArg<T, level>();
+}
+
+}
+
+
+VECTRA_LEVEL_TEST_SUITE(Reduce, vectra::test::Levels);
+
+TYPED_TEST(Reduce, Float)  { checkAll<float,  TypeParam::value>(); }
+TYPED_TEST(Reduce, Double) { checkAll<double, TypeParam::value>(); }
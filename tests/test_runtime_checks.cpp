@@ -12,4 +12,48 @@ TEST(RuntimeChecks, HighestLevel) {
 		      << level << std::endl;
 
 	EXPECT_GE(static_cast<int>(level), 0);
-}
\ No newline at end of file
+}
+namespace
+{
+
+// Haswell to Skylake client, Zen 1 to 3: AVX2 and FMA, no AVX-512, and
+// an OS saving the YMM state only
+vectra::detail::cpu_features avx2Host()
+{
+	vectra::detail::cpu_features f;
+	f.sse = f.sse2 = f.sse3 = f.ssse3 = f.sse41 = f.sse42 = true;
+	f.avx = f.fma = f.osxsave = f.avx2 = true;
+	f.xcr0 = 0x7;
+	return f;
+}
+
+}
+
+TEST(RuntimeChecks, LevelFromFeatures) {
+	using vectra::SIMDLevel;
+	using vectra::detail::levelFromFeatures;
+
+	vectra::detail::cpu_features f = avx2Host();
+	EXPECT_EQ(levelFromFeatures(f), SIMDLevel::AVX2);
+
+	// AVX-512 needs both the instructions and the ZMM state
+	f.avx512f = f.avx512dq = true;
+	EXPECT_EQ(levelFromFeatures(f), SIMDLevel::AVX2);
+	f.xcr0 = 0xE7;
+	EXPECT_EQ(levelFromFeatures(f), SIMDLevel::AVX512);
+
+	// AVX2 without FMA runs the AVX backend
+	f = avx2Host();
+	f.fma = false;
+	EXPECT_EQ(levelFromFeatures(f), SIMDLevel::AVX);
+
+	// Without the YMM state, or without OSXSAVE, only SSE is usable
+	f = avx2Host();
+	f.xcr0 = 0x3;
+	EXPECT_EQ(levelFromFeatures(f), SIMDLevel::SSE42);
+	f = avx2Host();
+	f.osxsave = false;
+	EXPECT_EQ(levelFromFeatures(f), SIMDLevel::SSE42);
+
+	EXPECT_EQ(levelFromFeatures(vectra::detail::cpu_features{}), SIMDLevel::None);
+}
@@ -0,0 +1,95 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+
+
+namespace
+{
+
+template <typename T, vectra::SIMDLevel level>
+void checkSoA()
+{
+	using points = vectra::basic_soa_vector<level, T, T, T>;
+	using vct    = typename points::template vct<0>;
+
+	points p;
+	EXPECT_TRUE(p.empty());
+
+	for (std::size_t i = 0; i < 37; ++i)
+		p.push_back(T(i), T(2 * i), T(3));
+
+	ASSERT_EQ(p.size(), 37u);
+	EXPECT_EQ(p.padded_size() % points::width(), 0u);
+	EXPECT_GE(p.padded_size(), p.size());
+	EXPECT_LT(p.padded_size() - p.size(), points::width());
+
+	// Columns are aligned, and padding is zeroed
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p.template data<1>()) % vct::alignment(), 0u);
+	for (std::size_t i = p.size(); i < p.padded_size(); ++i)
+		EXPECT_EQ(p.template get<2>(i), T(0));
+
+	auto [x, y, z] = p[5];
+	EXPECT_EQ(x, T(5));
+	EXPECT_EQ(y, T(10));
+	EXPECT_EQ(z, T(3));
+	std::get<2>(p[5]) = T(4);
+	EXPECT_EQ(p.template get<2>(5), T(4));
+
+	// Full-width blocks: z = x + y everywhere, padding included
+	std::size_t records = 0;
+	for (auto b : p.blocks())
+	{
+		b.template store<2>(b.template load<0>() + b.template load<1>());
+		records += b.count();
+	}
+	EXPECT_EQ(records, p.size());
+	EXPECT_EQ(static_cast<std::size_t>(p.blocks().end() - p.blocks().begin()), p.padded_size() / points::width());
+
+	for (std::size_t i = 0; i < p.size(); ++i)
+		EXPECT_EQ(p.template get<2>(i), T(3 * i));
+
+	// Growing into the padding zeroes the new records
+	p.resize(p.size() - 1);
+	p.resize(p.size() + 1);
+	EXPECT_EQ(p.template get<0>(36), T(0));
+	EXPECT_EQ(p.template get<2>(36), T(0));
+
+	p.resize(1000);
+	EXPECT_EQ(p.size(), 1000u);
+	EXPECT_EQ(p.template get<1>(999), T(0));
+	EXPECT_EQ(p.template get<1>(7), T(14));
+
+	p.pop_back();
+	EXPECT_EQ(p.size(), 999u);
+
+	p.clear();
+	EXPECT_TRUE(p.empty());
+	EXPECT_EQ(p.blocks().begin(), p.blocks().end());
+}
+
+}
+
+
+TEST(SoAVector, DefaultLevel)
+{
+	vectra::soa_vector<float, float> v(3);
+	v.push_back(1.f, 2.f);
+
+	const auto& c = v;
+	float sum = 0.f;
+	for (auto b : c.blocks())
+		sum += (b.template load<0>() + b.template load<1>()).hsum();
+	EXPECT_EQ(sum, 3.f);
+}
+
+VECTRA_LEVEL_TEST_SUITE(SoAVector, vectra::test::Levels);
+
+TYPED_TEST(SoAVector, Float)  { checkSoA<float,  TypeParam::value>(); }
+TYPED_TEST(SoAVector, Double) { checkSoA<double, TypeParam::value>(); }
@@ -0,0 +1,126 @@
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#include "simd_levels.hpp"
+
+
+namespace
+{
+
+template <typename T>
+using aligned_vector = std::vector<T, vectra::aligned_allocator<T>>;
+
+// Every size up to a few unrolled iterations, on aligned buffers
+// and on buffers shifted by one element (unaligned path).
+template <typename T, vectra::SIMDLevel level>
+void checkTransform()
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	const std::size_t maxSize = 5 * vectra::detail::transform_unroll * vct::width() + 3;
+
+	for (std::size_t offset : { std::size_t(0), std::size_t(1) })
+	{
+		aligned_vector<T> a(maxSize + offset), b(maxSize + offset), c(maxSize + offset);
+		for (std::size_t i = 0; i < a.size(); ++i)
+		{
+			a[i] = T(i) * T(0.5);
+			b[i] = T(3) - T(i);
+			c[i] = T(i % 7);
+		}
+
+		for (std::size_t n = 0; n <= maxSize; ++n)
+		{
+			// Guard elements past the end must never be written
+			aligned_vector<T> out(maxSize + offset + 1, T(-42));
+
+			vectra::transform<level>(a.data() + offset, out.data() + offset, n, [](vct x) { return x * x; });
+			for (std::size_t i = 0; i < n; ++i)
+				ASSERT_EQ(out[offset + i], a[offset + i] * a[offset + i]) << "n = " << n;
+			ASSERT_EQ(out[offset + n], T(-42)) << "n = " << n;
+
+			vectra::transform<level>(a.data() + offset, b.data() + offset, out.data() + offset, n, [](vct x, vct y) { return x - y; });
+			for (std::size_t i = 0; i < n; ++i)
+				ASSERT_EQ(out[offset + i], a[offset + i] - b[offset + i]) << "n = " << n;
+			ASSERT_EQ(out[offset + n], T(-42)) << "n = " << n;
+
+			vectra::transform<level>(a.data() + offset, b.data() + offset, c.data() + offset, out.data() + offset, n,
+				[](vct x, vct y, vct z) { return x * y + z; });
+			for (std::size_t i = 0; i < n; ++i)
+				ASSERT_EQ(out[offset + i], a[offset + i] * b[offset + i] + c[offset + i]) << "n = " << n;
+			ASSERT_EQ(out[offset + n], T(-42)) << "n = " << n;
+		}
+	}
+}
+
+template <typename T, vectra::SIMDLevel level>
+void checkInPlace()
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	aligned_vector<T> x(101);
+	for (std::size_t i = 0; i < x.size(); ++i)
+		x[i] = T(i) / T(10);
+
+	vectra::transform<level>(x.data(), x.data(), x.size(), [](vct v) { return vct::exp(v); });
+	for (std::size_t i = 0; i < x.size(); ++i)
+		EXPECT_NEAR(x[i], std::exp(T(i) / T(10)), std::exp(T(i) / T(10)) * T(1e-6));
+}
+
+// Outputs above the streaming threshold, aligned or not, with and
+// without aligned inputs, and the same through array expressions
+template <typename T, vectra::SIMDLevel level>
+void checkStreaming()
+{
+	using vct = vectra::Vectratype<T, level>;
+
+	const std::size_t n = vectra::detail::stream_threshold / sizeof(T) + 5;
+
+	aligned_vector<T> a(n + 1), out(n + 2, T(-42));
+	for (std::size_t i = 0; i < a.size(); ++i)
+		a[i] = T(i % 1000) * T(0.5);
+
+	for (std::size_t in : { std::size_t(0), std::size_t(1) })
+	for (std::size_t offset : { std::size_t(0), std::size_t(1) })
+	{
+		vectra::transform<level>(a.data() + in, out.data() + offset, n, [](vct x) { return x + x; });
+		for (std::size_t i = 0; i < n; ++i)
+			ASSERT_EQ(out[offset + i], a[in + i] + a[in + i]) << "i = " << i;
+		ASSERT_EQ(out[offset + n], T(-42));
+
+		vectra::transform<level>(vectra::execution::parallel, a.data() + in, out.data() + offset, n, [](vct x) { return x * x; });
+		for (std::size_t i = 0; i < n; ++i)
+			ASSERT_EQ(out[offset + i], a[in + i] * a[in + i]) << "i = " << i;
+		ASSERT_EQ(out[offset + n], T(-42));
+
+		out[n] = out[n + 1] = T(-42);
+	}
+
+	vectra::array<T, level> x(n), y(n);
+	for (std::size_t i = 0; i < n; ++i)
+		x[i] = a[i];
+	y = x * x + x;
+	for (std::size_t i = 0; i < n; ++i)
+		ASSERT_EQ(y[i], a[i] * a[i] + a[i]) << "i = " << i;
+}
+
+}
+
+
+VECTRA_LEVEL_TEST_SUITE(Transform, vectra::test::Levels);
+
+TYPED_TEST(Transform, Float)  { checkTransform<float,  TypeParam::value>(); checkInPlace<float,  TypeParam::value>(); checkStreaming<float,  TypeParam::value>(); }
+TYPED_TEST(Transform, Double) { checkTransform<double, TypeParam::value>(); checkInPlace<double, TypeParam::value>(); checkStreaming<double, TypeParam::value>(); }
+
+TEST(Transform, DefaultLevel)
+{
+	std::vector<float> in(19, 2.f), out(19);
+	vectra::transform(in.data(), out.data(), in.size(), [](auto x) { return x + x; });
+	for (float v : out)
+		EXPECT_EQ(v, 4.f);
+}
@@ -0,0 +1,158 @@
+#include <cstddef>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#if defined(__AVX2__) && defined(__FMA__)
+TEST(VectratypeAVX2Float, Arithmetic)
+{
+    using vct = vectra::Vectratype<float, vectra::SIMDLevel::AVX2>;
+
+    vct a(2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f);
+    vct b(3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f);
+
+    vct c = a + b;
+    vct d = a * b;
+    vct e = b - a;
+    vct f = vct::fma(a, b, e);
+
+    EXPECT_FLOAT_EQ(c.hsum(), 96.f);
+    EXPECT_FLOAT_EQ(d.hsum(), 328.f);
+    EXPECT_FLOAT_EQ(e.hsum(), 8.f);
+    EXPECT_FLOAT_EQ(f.hsum(), 336.f);
+}
+
+TEST(VectratypeAVX2Float, FusedMultiplyAdd)
+{
+    using vct = vectra::Vectratype<float, vectra::SIMDLevel::AVX2>;
+
+    // (1 + 2^-12)^2 = 1 + 2^-11 + 2^-24, where the last term is lost
+    // when the product is rounded before the subtraction
+    const float x = 1.f + 1.f / 4096.f;
+    vct r = vct::fma(vct(x), vct(x), vct(-(1.f + 1.f / 2048.f)));
+
+    EXPECT_FLOAT_EQ(r.hsum(), 8.f / 16777216.f);
+}
+
+TEST(VectratypeAVX2Double, Arithmetic)
+{
+    using vct = vectra::Vectratype<double, vectra::SIMDLevel::AVX2>;
+
+    vct a(2., 3., 4., 5.);
+    vct b(3., 4., 5., 6.);
+
+    EXPECT_DOUBLE_EQ((a + b).hsum(), 32.);
+    EXPECT_DOUBLE_EQ((a * b).hsum(), 68.);
+    EXPECT_DOUBLE_EQ(vct::fma(a, b, a).hsum(), 82.);
+
+    const double x = 1. + 1. / 67108864.; // 1 + 2^-26
+    vct r = vct::fma(vct(x), vct(x), vct(-(1. + 1. / 33554432.)));
+    EXPECT_DOUBLE_EQ(r.hsum(), 4. / 4503599627370496.);
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+TEST(BackendAVX2, PartialLoadStore)
+{
+    using backend = vectra::ComputeBackend<float, vectra::SIMDLevel::AVX2>;
+
+    float in [8] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f };
+    float out[8];
+
+    for (std::size_t n = 0; n < backend::width(); ++n)
+    {
+        for (float& v : out) v = -1.f;
+
+        backend::type x = backend::loadu_partial(in, n);
+        EXPECT_FLOAT_EQ(backend::hsum(x), float(n * (n + 1) / 2));
+
+        backend::unloadu_partial(out, x, n);
+        for (std::size_t i = 0; i < 8; ++i)
+            EXPECT_FLOAT_EQ(out[i], i < n ? in[i] : -1.f);
+    }
+}
+
+TEST(VectratypeAVX2Float, Comparisons)
+{
+    using vct = vectra::Vectratype<float, vectra::SIMDLevel::AVX2>;
+
+    // Lane i holds i, compared against the middle lane. The last
+    // lane is NaN, unless it is the middle one (two lanes only).
+    const bool hasNaN = vct::width() > 2;
+    alignas(64) float in[vct::width()];
+    for (std::size_t i = 0; i < vct::width(); ++i)
+        in[i] = float(i);
+    if (hasNaN)
+        in[vct::width() - 1] = std::numeric_limits<float>::quiet_NaN();
+
+    const vct x = vct::loadu(in);
+    const vct m(float(vct::width() / 2));
+    const unsigned full = (1u << vct::width()) - 1u;
+    const unsigned low  = (1u << (vct::width() / 2)) - 1u;
+    const unsigned nan  = hasNaN ? 1u << (vct::width() - 1) : 0u;
+
+    EXPECT_EQ((x <  m).movemask(), low);
+    EXPECT_EQ((x <= m).movemask(), low | (low + 1u));
+    EXPECT_EQ((x >  m).movemask(), full & ~(low | (low + 1u)) & ~nan);
+    EXPECT_EQ((x >= m).movemask(), full & ~low & ~nan);
+    EXPECT_EQ((x == x).movemask(), full & ~nan);
+    EXPECT_EQ((x != x).movemask(), nan);
+    EXPECT_EQ((!(x < m)).movemask(), full & ~low);
+    EXPECT_EQ(((x < m) | (x == m)).movemask(), (x <= m).movemask());
+    EXPECT_EQ(((x <= m) & (x >= m)).movemask(), low + 1u);
+
+    EXPECT_TRUE ((x < m).any());
+    EXPECT_FALSE((x < m).all());
+    EXPECT_TRUE ((m == m).all());
+    EXPECT_FALSE((m != m).any());
+
+    // Branch-free piecewise function: x < m ? -x : x (NaN lane kept)
+    alignas(64) float out[vct::width()];
+    vct::backend::unloadu(out, vct::select(x < m, -x, x).value);
+    for (std::size_t i = 0; i + 1 < vct::width(); ++i)
+        EXPECT_EQ(out[i], i < vct::width() / 2 ? -float(i) : float(i));
+}
+
+TEST(VectratypeAVX2Double, Comparisons)
+{
+    using vct = vectra::Vectratype<double, vectra::SIMDLevel::AVX2>;
+
+    // Lane i holds i, compared against the middle lane. The last
+    // lane is NaN, unless it is the middle one (two lanes only).
+    const bool hasNaN = vct::width() > 2;
+    alignas(64) double in[vct::width()];
+    for (std::size_t i = 0; i < vct::width(); ++i)
+        in[i] = double(i);
+    if (hasNaN)
+        in[vct::width() - 1] = std::numeric_limits<double>::quiet_NaN();
+
+    const vct x = vct::loadu(in);
+    const vct m(double(vct::width() / 2));
+    const unsigned full = (1u << vct::width()) - 1u;
+    const unsigned low  = (1u << (vct::width() / 2)) - 1u;
+    const unsigned nan  = hasNaN ? 1u << (vct::width() - 1) : 0u;
+
+    EXPECT_EQ((x <  m).movemask(), low);
+    EXPECT_EQ((x <= m).movemask(), low | (low + 1u));
+    EXPECT_EQ((x >  m).movemask(), full & ~(low | (low + 1u)) & ~nan);
+    EXPECT_EQ((x >= m).movemask(), full & ~low & ~nan);
+    EXPECT_EQ((x == x).movemask(), full & ~nan);
+    EXPECT_EQ((x != x).movemask(), nan);
+    EXPECT_EQ((!(x < m)).movemask(), full & ~low);
+    EXPECT_EQ(((x < m) | (x == m)).movemask(), (x <= m).movemask());
+    EXPECT_EQ(((x <= m) & (x >= m)).movemask(), low + 1u);
+
+    EXPECT_TRUE ((x < m).any());
+    EXPECT_FALSE((x < m).all());
+    EXPECT_TRUE ((m == m).all());
+    EXPECT_FALSE((m != m).any());
+
+    // Branch-free piecewise function: x < m ? -x : x (NaN lane kept)
+    alignas(64) double out[vct::width()];
+    vct::backend::unloadu(out, vct::select(x < m, -x, x).value);
+    for (std::size_t i = 0; i + 1 < vct::width(); ++i)
+        EXPECT_EQ(out[i], i < vct::width() / 2 ? -double(i) : double(i));
+}
+#endif
@@ -0,0 +1,138 @@
+#include <cstddef>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include <vectra/vectra.hpp>
+
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+TEST(VectratypeAVX512Float, Arithmetic)
+{
+    using vct = vectra::Vectratype<float, vectra::SIMDLevel::AVX512>;
+
+    vct a( 1.f,  2.f,  3.f,  4.f,  5.f,  6.f,  7.f,  8.f,
+           9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f, 16.f);
+    vct b(2.f);
+
+    EXPECT_FLOAT_EQ((a + b).hsum(), 168.f);
+    EXPECT_FLOAT_EQ((a * b).hsum(), 272.f);
+    EXPECT_FLOAT_EQ((a - b).hsum(), 104.f);
+    EXPECT_FLOAT_EQ((a / b).hsum(), 68.f);
+    EXPECT_FLOAT_EQ(vct::fma(a, b, b).hsum(), 304.f);
+}
+
+TEST(VectratypeAVX512Double, Arithmetic)
+{
+    using vct = vectra::Vectratype<double, vectra::SIMDLevel::AVX512>;
+
+    vct a(1., 2., 3., 4., 5., 6., 7., 8.);
+    vct b(3.);
+
+    EXPECT_DOUBLE_EQ((a + b).hsum(), 60.);
+    EXPECT_DOUBLE_EQ((a * b).hsum(), 108.);
+    EXPECT_DOUBLE_EQ(vct::abs(-a).hsum(), 36.);
+}
+
+TEST(BackendAVX512, PartialLoadStore)
+{
+    using backend = vectra::ComputeBackend<float, vectra::SIMDLevel::AVX512>;
+
+    // Guard values after the tail must be left untouched
+    float in [16] = {};
+    float out[16] = {};
+    for (int i = 0; i < 16; ++i) { in[i] = float(i + 1); out[i] = -1.f; }
+
+    for (std::size_t n = 0; n < backend::width(); ++n)
+    {
+        backend::type x = backend::loadu_partial(in, n);
+        EXPECT_FLOAT_EQ(backend::hsum(x), float(n * (n + 1) / 2));
+
+        backend::unloadu_partial(out, x, n);
+        for (std::size_t i = 0; i < 16; ++i)
+            EXPECT_FLOAT_EQ(out[i], i < n ? in[i] : -1.f);
+        for (float& v : out) v = -1.f;
+    }
+}
+
+TEST(VectratypeAVX512Float, Comparisons)
+{
+    using vct = vectra::Vectratype<float, vectra::SIMDLevel::AVX512>;
+
+    // Lane i holds i, compared against the middle lane. The last
+    // lane is NaN, unless it is the middle one (two lanes only).
+    const bool hasNaN = vct::width() > 2;
+    alignas(64) float in[vct::width()];
+    for (std::size_t i = 0; i < vct::width(); ++i)
+        in[i] = float(i);
+    if (hasNaN)
+        in[vct::width() - 1] = std::numeric_limits<float>::quiet_NaN();
+
+    const vct x = vct::loadu(in);
+    const vct m(float(vct::width() / 2));
+    const unsigned full = (1u << vct::width()) - 1u;
+    const unsigned low  = (1u << (vct::width() / 2)) - 1u;
+    const unsigned nan  = hasNaN ? 1u << (vct::width() - 1) : 0u;
+
+    EXPECT_EQ((x <  m).movemask(), low);
+    EXPECT_EQ((x <= m).movemask(), low | (low + 1u));
+    EXPECT_EQ((x >  m).movemask(), full & ~(low | (low + 1u)) & ~nan);
+    EXPECT_EQ((x >= m).movemask(), full & ~low & ~nan);
+    EXPECT_EQ((x == x).movemask(), full & ~nan);
+    EXPECT_EQ((x != x).movemask(), nan);
+    EXPECT_EQ((!(x < m)).movemask(), full & ~low);
+    EXPECT_EQ(((x < m) | (x == m)).movemask(), (x <= m).movemask());
+    EXPECT_EQ(((x <= m) & (x >= m)).movemask(), low + 1u);
+
+    EXPECT_TRUE ((x < m).any());
+    EXPECT_FALSE((x < m).all());
+    EXPECT_TRUE ((m == m).all());
+    EXPECT_FALSE((m != m).any());
+
+    // Branch-free piecewise function: x < m ? -x : x (NaN lane kept)
+    alignas(64) float out[vct::width()];
+    vct::backend::unloadu(out, vct::select(x < m, -x, x).value);
+    for (std::size_t i = 0; i + 1 < vct::width(); ++i)
+        EXPECT_EQ(out[i], i < vct::width() / 2 ? -float(i) : float(i));
+}
+
+TEST(VectratypeAVX512Double, Comparisons)
+{
+    using vct = vectra::Vectratype<double, vectra::SIMDLevel::AVX512>;
+
+    // Lane i holds i, compared against the middle lane. The last
+    // lane is NaN, unless it is the middle one (two lanes only).
+    const bool hasNaN = vct::width() > 2;
+    alignas(64) double in[vct::width()];
+    for (std::size_t i = 0; i < vct::width(); ++i)
+        in[i] = double(i);
+    if (hasNaN)
+        in[vct::width() - 1] = std::numeric_limits<double>::quiet_NaN();
+
+    const vct x = vct::loadu(in);
+    const vct m(double(vct::width() / 2));
+    const unsigned full = (1u << vct::width()) - 1u;
+    const unsigned low  = (1u << (vct::width() / 2)) - 1u;
+    const unsigned nan  = hasNaN ? 1u << (vct::width() - 1) : 0u;
+
+    EXPECT_EQ((x <  m).movemask(), low);
+    EXPECT_EQ((x <= m).movemask(), low | (low + 1u));
+    EXPECT_EQ((x >  m).movemask(), full & ~(low | (low + 1u)) & ~nan);
+    EXPECT_EQ((x >= m).movemask(), full & ~low & ~nan);
+    EXPECT_EQ((x == x).movemask(), full & ~nan);
+    EXPECT_EQ((x != x).movemask(), nan);
+    EXPECT_EQ((!(x < m)).movemask(), full & ~low);
+    EXPECT_EQ(((x < m) | (x == m)).movemask(), (x <= m).movemask());
+    EXPECT_EQ(((x <= m) & (x >= m)).movemask(), low + 1u);
+
+    EXPECT_TRUE ((x < m).any());
+    EXPECT_FALSE((x < m).all());
+    EXPECT_TRUE ((m == m).all());
+    EXPECT_FALSE((m != m).any());
+
+    // Branch-free piecewise function: x < m ? -x : x (NaN lane kept)
+    alignas(64) double out[vct::width()];
+    vct::backend::unloadu(out, vct::select(x < m, -x, x).value);
+    for (std::size_t i = 0; i + 1 < vct::width(); ++i)
+        EXPECT_EQ(out[i], i < vct::width() / 2 ? -double(i) : double(i));
+}
+#endif
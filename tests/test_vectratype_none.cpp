@@ -1,3 +1,5 @@
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include <vectra/vectra.hpp>
@@ -19,4 +21,24 @@ TEST(VectratypeNoneFloat, Arithmetic)
     EXPECT_FLOAT_EQ(d.hsum(), 6.f);
     EXPECT_FLOAT_EQ(e.hsum(), 4.f);
     EXPECT_FLOAT_EQ(f.hsum(), 2.f);
-}
\ No newline at end of file
+}
+
+TEST(VectratypeNoneFloat, Comparisons)
+{
+    using vct = vectra::Vectratype<float, vectra::SIMDLevel::None>;
+
+    vct a(1.f);
+    vct b(2.f);
+    vct n(std::numeric_limits<float>::quiet_NaN());
+
+    EXPECT_TRUE ((a <  b).all());
+    EXPECT_TRUE ((a <= a).all());
+    EXPECT_FALSE((a >  b).any());
+    EXPECT_TRUE ((a != n).all());
+    EXPECT_FALSE((n == n).any());
+    EXPECT_EQ((a < b).movemask(), 1u);
+    EXPECT_EQ((!(a < b)).movemask(), 0u);
+    EXPECT_EQ(vct::select(a < b, a, b).hsum(), 1.f);
+    EXPECT_EQ(vct::clamp(vct(5.f), a, b).hsum(), 2.f);
+    EXPECT_EQ(vct::clamp(n, a, b).hsum(), 1.f);
+}
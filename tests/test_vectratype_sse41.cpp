@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include <vectra/vectra.hpp>
@@ -18,4 +22,103 @@ TEST(VectratypeSSE41Float, Arithmetic)
     EXPECT_FLOAT_EQ(d.hsum(), 68.f);
     EXPECT_FLOAT_EQ(e.hsum(), 4.f);
     EXPECT_FLOAT_EQ(f.hsum(), 3.05f);
-}
\ No newline at end of file
+}
+TEST(BackendSSE41, PartialLoadStore)
+{
+    using backend = vectra::ComputeBackend<double, vectra::SIMDLevel::SSE41>;
+
+    double in [2] = { 3., 4. };
+    double out[2] = { -1., -1. };
+
+    EXPECT_DOUBLE_EQ(backend::hsum(backend::loadu_partial(in, 1)), 3.);
+    backend::unloadu_partial(out, backend::loadu_partial(in, 1), 1);
+    EXPECT_DOUBLE_EQ(out[0],  3.);
+    EXPECT_DOUBLE_EQ(out[1], -1.);
+}
+
+TEST(VectratypeSSE41Float, Comparisons)
+{
+    using vct = vectra::Vectratype<float, vectra::SIMDLevel::SSE41>;
+
+    // Lane i holds i, compared against the middle lane. The last
+    // lane is NaN, unless it is the middle one (two lanes only).
+    const bool hasNaN = vct::width() > 2;
+    alignas(64) float in[vct::width()];
+    for (std::size_t i = 0; i < vct::width(); ++i)
+        in[i] = float(i);
+    if (hasNaN)
+        in[vct::width() - 1] = std::numeric_limits<float>::quiet_NaN();
+
+    const vct x = vct::loadu(in);
+    const vct m(float(vct::width() / 2));
+    const unsigned full = (1u << vct::width()) - 1u;
+    const unsigned low  = (1u << (vct::width() / 2)) - 1u;
+    const unsigned nan  = hasNaN ? 1u << (vct::width() - 1) : 0u;
+
+    EXPECT_EQ((x <  m).movemask(), low);
+    EXPECT_EQ((x <= m).movemask(), low | (low + 1u));
+    EXPECT_EQ((x >  m).movemask(), full & ~(low | (low + 1u)) & ~nan);
+    EXPECT_EQ((x >= m).movemask(), full & ~low & ~nan);
+    EXPECT_EQ((x == x).movemask(), full & ~nan);
+    EXPECT_EQ((x != x).movemask(), nan);
+    EXPECT_EQ((!(x < m)).movemask(), full & ~low);
+    EXPECT_EQ(((x < m) | (x == m)).movemask(), (x <= m).movemask());
+    EXPECT_EQ(((x <= m) & (x >= m)).movemask(), low + 1u);
+
+    EXPECT_TRUE ((x < m).any());
+    EXPECT_FALSE((x < m).all());
+    EXPECT_TRUE ((m == m).all());
+    EXPECT_FALSE((m != m).any());
+
+    // Branch-free piecewise function: x < m ? -x : x (NaN lane kept)
+    alignas(64) float out[vct::width()];
+    vct::backend::unloadu(out, vct::select(x < m, -x, x).value);
+    for (std::size_t i = 0; i + 1 < vct::width(); ++i)
+        EXPECT_EQ(out[i], i < vct::width() / 2 ? -float(i) : float(i));
+
+    // Clamping to [1 ; 2], the NaN lane to lo
+    vct::backend::unloadu(out, vct::clamp(x, vct(1.f), vct(2.f)).value);
+    for (std::size_t i = 0; i < vct::width(); ++i)
+        EXPECT_EQ(out[i], hasNaN && i + 1 == vct::width() ? 1.f : std::min(std::max(float(i), 1.f), 2.f));
+}
+
+TEST(VectratypeSSE41Double, Comparisons)
+{
+    using vct = vectra::Vectratype<double, vectra::SIMDLevel::SSE41>;
+
+    // Lane i holds i, compared against the middle lane. The last
+    // lane is NaN, unless it is the middle one (two lanes only).
+    const bool hasNaN = vct::width() > 2;
+    alignas(64) double in[vct::width()];
+    for (std::size_t i = 0; i < vct::width(); ++i)
+        in[i] = double(i);
+    if (hasNaN)
+        in[vct::width() - 1] = std::numeric_limits<double>::quiet_NaN();
+
+    const vct x = vct::loadu(in);
+    const vct m(double(vct::width() / 2));
+    const unsigned full = (1u << vct::width()) - 1u;
+    const unsigned low  = (1u << (vct::width() / 2)) - 1u;
+    const unsigned nan  = hasNaN ? 1u << (vct::width() - 1) : 0u;
+
+    EXPECT_EQ((x <  m).movemask(), low);
+    EXPECT_EQ((x <= m).movemask(), low | (low + 1u));
+    EXPECT_EQ((x >  m).movemask(), full & ~(low | (low + 1u)) & ~nan);
+    EXPECT_EQ((x >= m).movemask(), full & ~low & ~nan);
+    EXPECT_EQ((x == x).movemask(), full & ~nan);
+    EXPECT_EQ((x != x).movemask(), nan);
+    EXPECT_EQ((!(x < m)).movemask(), full & ~low);
+    EXPECT_EQ(((x < m) | (x == m)).movemask(), (x <= m).movemask());
+    EXPECT_EQ(((x <= m) & (x >= m)).movemask(), low + 1u);
+
+    EXPECT_TRUE ((x < m).any());
+    EXPECT_FALSE((x < m).all());
+    EXPECT_TRUE ((m == m).all());
+    EXPECT_FALSE((m != m).any());
+
+    // Branch-free piecewise function: x < m ? -x : x (NaN lane kept)
+    alignas(64) double out[vct::width()];
+    vct::backend::unloadu(out, vct::select(x < m, -x, x).value);
+    for (std::size_t i = 0; i + 1 < vct::width(); ++i)
+        EXPECT_EQ(out[i], i < vct::width() / 2 ? -double(i) : double(i));
+}
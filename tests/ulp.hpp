@@ -0,0 +1,31 @@
+#pragma once
+
+
+#include <cmath>
+#include <limits>
+
+
+namespace vectra::test
+{
+
+// Distance in ULP between a result and a long double reference.
+// Matching infinities and NaN are considered exact, a NaN matching
+// anything else infinitely wrong.
+template <typename T>
+double ulpError(T value, long double reference)
+{
+	if (std::isnan(value) || std::isnan(reference))
+		return std::isnan(value) && std::isnan(reference) ? 0. : std::numeric_limits<double>::infinity();
+
+	const T rounded = static_cast<T>(reference);
+	if (std::isinf(rounded) || std::isinf(value))
+		return value == rounded ? 0. : std::numeric_limits<double>::infinity();
+
+	const T spacing = rounded == T(0)
+		? std::numeric_limits<T>::denorm_min()
+		: std::nextafter(std::fabs(rounded), std::numeric_limits<T>::infinity()) - std::fabs(rounded);
+
+	return static_cast<double>(std::fabs(static_cast<long double>(value) - reference) / spacing);
+}
+
+}